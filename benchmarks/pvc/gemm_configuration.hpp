@@ -52,7 +52,7 @@ namespace cutlass {
 namespace gemm {
 namespace device {
 
-enum class Scheduler { Gemm, GemmSplitK, GemmStreamK };
+enum class Scheduler { Gemm, GemmPersistent, GemmSplitK, GemmStreamK, GemmSlicedK };
 
 template<
   class ArchTag,
@@ -80,7 +80,8 @@ struct GemmConfiguration<
       float, LayoutC,
       float, TileShape, TiledMma,
       GmemTiledCopyA, GmemTiledCopyB, TileScheduler> {
-  using DispatchPolicy = MainloopIntelPVC<3>;
+  using DispatchPolicy = std::conditional_t<TileScheduler == Scheduler::GemmSlicedK,
+    MainloopIntelPVCSlicedK<3, 4>, MainloopIntelPVC<3>>;
 
   // Mainloop
   using CollectiveMainloop = collective::CollectiveMma<
@@ -115,7 +116,9 @@ struct GemmConfiguration<
     Shape<int, int, int, int>,
     CollectiveMainloop,
     CollectiveEpilogue,
-    std::conditional_t<TileScheduler == Scheduler::Gemm, void, cutlass::gemm::StreamKScheduler>
+    std::conditional_t<TileScheduler == Scheduler::Gemm || TileScheduler == Scheduler::GemmSlicedK, void,
+      std::conditional_t<TileScheduler == Scheduler::GemmPersistent,
+        cutlass::gemm::PersistentScheduler, cutlass::gemm::StreamKScheduler>>
   >;
 
   using Gemm = GemmUniversalAdapter<GemmKernel>;
@@ -123,7 +126,8 @@ struct GemmConfiguration<
   constexpr static typename GemmKernel::Arguments defaultArguments() {
     using StreamKMode =
       cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
-    if constexpr (TileScheduler == Scheduler::Gemm) {
+    if constexpr (TileScheduler == Scheduler::Gemm || TileScheduler == Scheduler::GemmPersistent ||
+                  TileScheduler == Scheduler::GemmSlicedK) {
       return {};
     } else if constexpr (TileScheduler == Scheduler::GemmStreamK) {
       typename GemmKernel::Arguments arguments{};
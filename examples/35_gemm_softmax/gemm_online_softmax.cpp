@@ -59,7 +59,7 @@
 #include "cutlass/util/reference/device/tensor_fill.h"
 #endif
 #include "helper.h"
-#include "softmax_epilogue.hpp"
+#include "cutlass/epilogue/collective/softmax_epilogue.hpp"
 #include "gemm_softmax_adapter.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
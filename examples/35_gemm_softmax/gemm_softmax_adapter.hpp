@@ -56,7 +56,7 @@
 #include "cutlass/util/sycl_event_manager.hpp"
 #endif
 
-#include "softmax_finalize.hpp"
+#include "cutlass/reduction/kernel/softmax_finalize.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,435 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Device-agnostic example recording a chain of two GEMMs into a SYCL command graph.
+
+    The chain D1 = A * B, D2 = D1 * B2 is captured once with cutlass::SyclGraph and replayed, so
+    the host-side argument conversion and kernel submission are only paid at capture time. The
+    chain is then re-captured with a different A, which updates the finalized graph in place.
+
+    The example uses the device-agnostic mainloop and also runs on the SYCL CPU device.
+*/
+
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/gemm/device/gemm_universal.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "cutlass/util/GPU_Clock.hpp"
+#include "cutlass/util/sycl_graph.hpp"
+
+#include <cute/tensor.hpp>
+#include <vector>
+#include <random>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "helper.h"
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+  bool error;
+
+  int m, n, k, iterations;
+  float alpha, beta;
+
+  Options():
+    help(false),
+    error(false),
+    m(64), n(64), k(64), iterations(100),
+    alpha(1.f), beta(0.f)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m, 64);
+    cmd.get_cmd_line_argument("n", n, 64);
+    cmd.get_cmd_line_argument("k", k, 64);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("iterations", iterations, 100);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "Device Agnostic GEMM Graph Example\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of both GEMMs\n"
+      << "  --n=<int>                   Sets the N extent of both GEMMs and the K extent of the second\n"
+      << "  --k=<int>                   Sets the K extent of the first GEMM\n"
+      << "  --alpha=<s32>               Epilogue scalar alpha\n"
+      << "  --beta=<s32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Iterations\n\n";
+
+    return out;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Gemm>
+struct ExampleRunner {
+
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  using LayoutA = typename Gemm::LayoutA;
+  using LayoutB = typename Gemm::LayoutB;
+  using LayoutC = typename Gemm::LayoutC;
+  using LayoutD = typename Gemm::LayoutD;
+
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+
+  using CollectiveEpilogue = typename Gemm::CollectiveEpilogue;
+  using ElementC = typename Gemm::ElementC;
+  using ElementOutput = typename CollectiveEpilogue::ElementOutput;
+  using ElementCompute = typename CollectiveEpilogue::ElementCompute;
+  using ElementAccumulator = typename CollectiveEpilogue::ElementAccumulator;
+
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  static_assert(cute::is_same_v<ElementOutput, ElementA>,
+    "The output of the first GEMM is the A operand of the second");
+
+  //
+  // Data members
+  //
+
+  uint64_t seed = 0;
+
+  cutlass::DeviceAllocation<ElementA> block_A[2];
+  cutlass::DeviceAllocation<ElementB> block_B;
+  cutlass::DeviceAllocation<ElementB> block_B2;
+  cutlass::DeviceAllocation<ElementC> block_C;
+  cutlass::DeviceAllocation<ElementOutput> block_D1;
+  cutlass::DeviceAllocation<ElementOutput> block_D2;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D1;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D2;
+
+  //
+  // Methods
+  //
+
+  void reference_gemm(int M, int N, int K, ElementCompute alpha, ElementCompute beta,
+                      ElementA const* ptr_A, ElementB const* ptr_B, ElementOutput* ptr_D) {
+    cutlass::TensorRef ref_A(const_cast<ElementA*>(ptr_A), LayoutA::packed({M, K}));
+    cutlass::TensorRef ref_B(const_cast<ElementB*>(ptr_B), LayoutB::packed({K, N}));
+    cutlass::TensorRef ref_C(block_C.get(), LayoutC::packed({M, N}));
+    cutlass::TensorRef ref_D(ptr_D, LayoutD::packed({M, N}));
+
+    cutlass::reference::device::GemmComplex(
+          {M, N, K},
+          alpha,
+          ref_A,
+          cutlass::ComplexTransform::kNone,
+          ref_B,
+          cutlass::ComplexTransform::kNone,
+          beta,
+          ref_C,
+          ref_D,
+          ElementAccumulator(0));
+  }
+
+  bool verify(Options const& options, ElementA const* ptr_A) {
+    reference_gemm(options.m, options.n, options.k, options.alpha, options.beta,
+                   ptr_A, block_B.get(), block_ref_D1.get());
+    syclcompat::wait();
+    reference_gemm(options.m, options.n, options.n, options.alpha, options.beta,
+                   block_ref_D1.get(), block_B2.get(), block_ref_D2.get());
+    syclcompat::wait();
+
+    // The second GEMM consumes the first one's output, so allow for rounding differences
+    bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(
+      block_ref_D1.get(), block_D1.get(), block_D1.size(), ElementOutput(1e-4f), ElementOutput(1e-6f));
+    passed &= cutlass::reference::device::BlockCompareRelativelyEqual(
+      block_ref_D2.get(), block_D2.get(), block_D2.size(), ElementOutput(1e-4f), ElementOutput(1e-6f));
+
+    return passed;
+  }
+
+  template <typename T>
+  void initialize_block(cutlass::DeviceAllocation<T>& block_device, uint64_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<> dist(0.0f, 1.0f);
+
+    auto block_host = std::vector<T>(block_device.size());
+    for (auto& element : block_host) {
+      element = static_cast<T>(dist(rng));
+    }
+
+    block_device.copy_from_host(block_host.data());
+  }
+
+  /// Initialize operands to be used in the GEMMs and reference GEMMs
+  void initialize(Options const& options) {
+    int const M = options.m, N = options.n, K = options.k;
+
+    block_A[0].reset(M * K);
+    block_A[1].reset(M * K);
+    block_B.reset(K * N);
+    block_B2.reset(N * N);
+    block_C.reset(M * N);
+    block_D1.reset(M * N);
+    block_D2.reset(M * N);
+    block_ref_D1.reset(M * N);
+    block_ref_D2.reset(M * N);
+
+    initialize_block(block_A[0], seed + 2023);
+    initialize_block(block_A[1], seed + 2024);
+    initialize_block(block_B, seed + 2022);
+    initialize_block(block_B2, seed + 2025);
+    initialize_block(block_C, seed + 2021);
+  }
+
+  typename Gemm::Arguments make_arguments(
+      int M, int N, int K, Options const& options, cutlass::KernelHardwareInfo const& hw_info,
+      ElementA const* ptr_A, ElementB const* ptr_B, ElementOutput* ptr_D) {
+    auto stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, 1));
+    auto stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, 1));
+    auto stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, 1));
+    auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, 1));
+
+    return typename Gemm::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      ProblemShapeType{M, N, K, 1},
+      {ptr_A, stride_A, ptr_B, stride_B},
+      {{options.alpha, options.beta}, block_C.get(), stride_C, ptr_D, stride_D},
+      hw_info
+    };
+  }
+
+  cutlass::Status run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
+    int const M = options.m, N = options.n, K = options.k;
+
+    initialize(options);
+
+    Gemm gemm_op1;
+    Gemm gemm_op2;
+
+    auto arguments1 = make_arguments(M, N, K, options, hw_info, block_A[0].get(), block_B.get(), block_D1.get());
+    auto arguments2 = make_arguments(M, N, N, options, hw_info, block_D1.get(), block_B2.get(), block_D2.get());
+
+    CUTLASS_CHECK(gemm_op1.can_implement(arguments1));
+    CUTLASS_CHECK(gemm_op2.can_implement(arguments2));
+
+    cutlass::device_memory::allocation<uint8_t> workspace1(Gemm::get_workspace_size(arguments1));
+    cutlass::device_memory::allocation<uint8_t> workspace2(Gemm::get_workspace_size(arguments2));
+
+    cutlass::SyclGraph graph;
+    std::cout << "Command graphs supported: " << (cutlass::SyclGraph::is_supported(graph.queue()) ? "yes" : "no") << std::endl;
+
+    // Records the chain with copies of the operators and arguments; launches are only submitted
+    // on replay
+    auto capture = [&]() {
+      graph.capture([](sycl::queue& queue,
+                       Gemm& gemm_op1, typename Gemm::Arguments& arguments1, uint8_t* workspace1,
+                       Gemm& gemm_op2, typename Gemm::Arguments& arguments2, uint8_t* workspace2) {
+        CUTLASS_CHECK(gemm_op1.initialize(arguments1, workspace1, queue));
+        gemm_op1.run(queue);
+        CUTLASS_CHECK(gemm_op2.initialize(arguments2, workspace2, queue));
+        gemm_op2.run(queue);
+      }, gemm_op1, arguments1, workspace1.get(), gemm_op2, arguments2, workspace2.get());
+    };
+
+    capture();
+    graph.replay().wait();
+
+    bool passed = verify(options, block_A[0].get());
+    std::cout << "Disposition (capture): " << (passed ? "Passed" : "Failed") << std::endl;
+    if (!passed) return cutlass::Status::kErrorInternal;
+
+    // Point the first GEMM at another A and update the captured graph
+    arguments1 = make_arguments(M, N, K, options, hw_info, block_A[1].get(), block_B.get(), block_D1.get());
+    capture();
+    graph.replay().wait();
+
+    passed = verify(options, block_A[1].get());
+    std::cout << "Disposition (update):  " << (passed ? "Passed" : "Failed") << std::endl;
+    if (!passed) return cutlass::Status::kErrorInternal;
+
+    if (options.iterations > 0) {
+      CUTLASS_CHECK(gemm_op1.initialize(arguments1, workspace1.get()));
+      CUTLASS_CHECK(gemm_op2.initialize(arguments2, workspace2.get()));
+
+      GPU_Clock timer;
+      timer.start();
+      for (int i = 0; i < options.iterations; ++i) {
+        gemm_op1.run();
+        gemm_op2.run();
+      }
+      syclcompat::wait();
+      float eager_time = timer.seconds() / options.iterations;
+
+      timer.start();
+      for (int i = 0; i < options.iterations; ++i) {
+        graph.replay();
+      }
+      graph.queue().wait();
+      float graph_time = timer.seconds() / options.iterations;
+
+      std::cout << "Problem Size: " << M << 'x' << N << 'x' << K << " -> " << M << 'x' << N << 'x' << N << std::endl;
+      printf("Eager launches:   (%6.4f)ms per chain\n", eager_time * 1000);
+      printf("Graph replay:     (%6.4f)ms per chain\n", graph_time * 1000);
+    }
+
+    return cutlass::Status::kSuccess;
+  }
+
+};
+
+int main(int argc, const char** argv)
+{
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    std::cerr << "Aborting execution." << std::endl;
+    return -1;
+  }
+
+  //
+  // Run examples
+  //
+
+  // The KernelHardwareInfo struct holds the number of CUs on the GPU with a given device ID. This
+  // information is used by the underlying kernel.
+  cutlass::KernelHardwareInfo hw_info;
+
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  // The code section below describes datatype for input, output matrices and computation between
+  // elements in input matrices.
+  using ElementAccumulator = float;                   // <- data type of accumulator
+  using ElementComputeEpilogue = float;               // <- data type of epilogue operations
+  using ElementInputA = float;                        // <- data type of elements in input matrix A
+  using ElementInputB = float;                        // <- data type of elements in input matrix B
+  using ElementOutput = float;                        // <- data type of elements in output matrix D
+
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape = Shape<_4, _4, _8>;
+
+  using TiledMma = TiledMMA<MMA_Atom<UniversalFMA<ElementOutput, ElementInputA, ElementInputB, ElementAccumulator>>,
+                            Layout<Shape<_4, _4, _1>>>;
+
+  using GmemTiledCopyA = decltype(
+        make_tiled_copy(Copy_Atom<UniversalCopy<ElementInputA>, ElementInputA>{},
+                        Layout<Shape<_4, _4>, Stride<_4, _1>>{},
+                        Layout<Shape<_1, _1>>{}
+        ));
+
+  using GmemTiledCopyB = decltype(
+        make_tiled_copy(Copy_Atom<UniversalCopy<ElementInputB>, ElementInputB>{},
+                        Layout<Shape<_4, _4>, Stride <_1, _4>>{},
+                        Layout<Shape<_1, _1>>{}
+        ));
+
+  using SmemLayoutAtomA = Layout<Shape<_4, _8>, Stride<_1, _4>>;
+  using SmemLayoutAtomB = Layout<Shape<_4, _8>, Stride<_1, _4>>;
+
+  using GEMMDispatchPolicy = cutlass::gemm::MainloopDeviceAgnostic;
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+          ElementAccumulator,
+          1,
+          ElementComputeEpilogue,
+          ElementOutput>;
+
+  using CollectiveEpilogue = cutlass::epilogue::collective::DefaultEpilogue<
+          cutlass::detail::TagToStrideC_t<LayoutC>,
+          cutlass::detail::TagToStrideC_t<LayoutD>,
+          EpilogueOp,
+          cutlass::gemm::EpilogueDefault>;
+
+  using SmemCopyAtomA = Copy_Atom<UniversalCopy<ElementInputA>, ElementInputA>;
+  using SmemCopyAtomB = Copy_Atom<UniversalCopy<ElementInputB>, ElementInputB>;
+
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+          GEMMDispatchPolicy,
+          TileShape,
+          ElementInputA,
+          cutlass::gemm::TagToStrideA_t<LayoutA>,
+          ElementInputB,
+          cutlass::gemm::TagToStrideB_t<LayoutB>,
+          TiledMma,
+          GmemTiledCopyA, SmemLayoutAtomA, SmemCopyAtomA, cute::identity,  // A
+          GmemTiledCopyB, SmemLayoutAtomB, SmemCopyAtomB, cute::identity   // B
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int, int, int, int>,
+    CollectiveMainloop,
+    CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  ExampleRunner<Gemm> runner;
+
+  CUTLASS_CHECK(runner.run(options, hw_info));
+
+  return 0;
+}
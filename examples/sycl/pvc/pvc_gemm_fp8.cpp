@@ -0,0 +1,493 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief PVC GEMM with FP8 (E4M3) inputs, per-tensor or per-block scaling and an amax output.
+
+    PVC has no FP8 DPAS, so the mainloop loads A and B as FP8, which halves the global memory
+    traffic compared to bf16, and upconverts them in registers to bf16 before each MMA.
+    Every FP8 value is exactly representable in bf16, so the conversion adds no error.
+
+    With --scaling=block one FP32 scale factor is applied per 128x128 block of A and B, as used
+    by DeepSeek-style FP8 training recipes. Partial products of each 128-wide K block are scaled
+    in the accumulators before they are summed. With --scaling=tensor a single scale factor is
+    used per operand.
+
+    The epilogue computes D = alpha * acc + beta * C and the absolute maximum of D, which is the
+    statistic needed to choose the scale factor when D is quantized to FP8 by the next layer.
+*/
+
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/collective/xe_epilogue.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/device/gemm_universal.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/collective/collective_mma.hpp"
+#include "cutlass/util/GPU_Clock.hpp"
+
+#include <cute/tensor.hpp>
+#include <random>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "common.hpp"
+#include "helper.h"
+
+using namespace cute;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+  bool error;
+  bool block_scaling;
+
+  int m, n, k, l, iterations;
+  float alpha, beta;
+
+  Options():
+    help(false),
+    error(false),
+    block_scaling(true),
+    m(5120), n(4096), k(4096), l(1), iterations(20),
+    alpha(1.f), beta(0.f)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    std::string scaling;
+    cmd.get_cmd_line_argument("scaling", scaling, std::string("block"));
+    if (scaling == "block") {
+      block_scaling = true;
+    } else if (scaling == "tensor") {
+      block_scaling = false;
+    } else {
+      std::cerr << "Invalid scaling mode: " << scaling << std::endl;
+      error = true;
+    }
+
+    cmd.get_cmd_line_argument("m", m, 5120);
+    cmd.get_cmd_line_argument("n", n, 4096);
+    cmd.get_cmd_line_argument("k", k, 4096);
+    cmd.get_cmd_line_argument("l", l, 1);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("iterations", iterations, 100);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "PVC FP8 GEMM Example\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --scaling=<block|tensor>    Applies one scale factor per 128x128 block or per tensor\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM\n"
+      << "  --l=<int>                   Sets the L extent (batch count) of the GEMM\n"
+      << "  --alpha=<s32>               Epilogue scalar alpha\n"
+      << "  --beta=<s32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Iterations\n\n";
+
+    return out;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class Gemm
+>
+struct ExampleRunner {
+
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  using LayoutA = typename Gemm::LayoutA;
+  using LayoutB = typename Gemm::LayoutB;
+  using LayoutC = typename Gemm::LayoutC;
+  using LayoutD = typename Gemm::LayoutD;
+
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementAcc = typename Gemm::ElementAccumulator;
+
+  using CollectiveMainloop = typename Gemm::CollectiveMainloop;
+  using ElementScale = typename CollectiveMainloop::ElementScale;
+  static constexpr bool IsBlockScaled = CollectiveMainloop::IsBlockScaled;
+  static constexpr int ScaleBlockM = CollectiveMainloop::ScaleBlockM;
+  static constexpr int ScaleBlockN = CollectiveMainloop::ScaleBlockN;
+  static constexpr int ScaleBlockK = CollectiveMainloop::ScaleBlockK;
+
+  using CollectiveEpilogue = typename Gemm::CollectiveEpilogue;
+  using ElementC = typename Gemm::ElementC;
+  using ElementOutput = typename CollectiveEpilogue::ElementOutput;
+  using ElementCompute = typename CollectiveEpilogue::ElementCompute;
+  using ElementAccumulator = typename CollectiveEpilogue::ElementAccumulator;
+  using ElementAmax = typename CollectiveEpilogue::FusionCallbacks::ElementAmax;
+
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  //
+  // Data members
+  //
+
+  /// Initialization
+  StrideA stride_A;
+  StrideB stride_B;
+  StrideC stride_C;
+  StrideD stride_D;
+  uint64_t seed = 0;
+
+  cutlass::DeviceAllocation<ElementA> block_A;
+  cutlass::DeviceAllocation<ElementB> block_B;
+  cutlass::DeviceAllocation<ElementScale> block_scale_A;
+  cutlass::DeviceAllocation<ElementScale> block_scale_B;
+  cutlass::DeviceAllocation<float> block_A_dq; // Scaled copy of A for validation
+  cutlass::DeviceAllocation<float> block_B_dq; // Scaled copy of B for validation
+  cutlass::DeviceAllocation<ElementC> block_C;
+  cutlass::DeviceAllocation<ElementOutput> block_D;
+  cutlass::DeviceAllocation<ElementOutput> block_ref_D;
+  cutlass::DeviceAllocation<ElementAmax> block_amax_D;
+
+  //
+  // Methods
+  //
+
+  bool verify(const ProblemShapeType& problem_size, ElementCompute alpha, ElementCompute beta) {
+    auto [M, N, K, L] = problem_size;
+
+    cutlass::TensorRef ref_A(block_A_dq.get(), LayoutA::packed({M, K}));
+    cutlass::TensorRef ref_B(block_B_dq.get(), LayoutB::packed({K, N}));
+    cutlass::TensorRef ref_C(block_C.get(), LayoutC::packed({M, N}));
+    cutlass::TensorRef ref_D(block_ref_D.get(), LayoutD::packed({M, N}));
+
+    cutlass::reference::device::GemmComplex(
+          {M, N, K},
+          alpha,
+          ref_A,
+          cutlass::ComplexTransform::kNone,
+          ref_B,
+          cutlass::ComplexTransform::kNone,
+          beta,
+          ref_C,
+          ref_D,
+          ElementAccumulator(0),
+          L,     // batch_count
+          M * K, // batch_stride_A
+          K * N, // batch_stride_B
+          M * N, // batch_stride_C
+          M * N  // batch_stride_D
+        );
+
+    syclcompat::wait();
+
+    // The kernel scales partial sums instead of the operands, so results differ in rounding only
+    ElementOutput const epsilon(1e-2f);
+    ElementOutput const non_zero_floor(1e-4f);
+    bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(
+      block_ref_D.get(), block_D.get(), block_D.size(), epsilon, non_zero_floor);
+
+    // amax of the reference output
+    std::vector<ElementOutput> ref_D_host(block_ref_D.size());
+    block_ref_D.copy_to_host(ref_D_host.data());
+    ElementAmax ref_amax = ElementAmax(0);
+    for (auto const& d : ref_D_host) {
+      ref_amax = std::max(ref_amax, static_cast<ElementAmax>(std::abs(d)));
+    }
+
+    ElementAmax amax;
+    block_amax_D.copy_to_host(&amax);
+    bool amax_passed = std::abs(amax - ref_amax) <= 1e-2f * ref_amax;
+    if (!amax_passed) {
+      std::cerr << "amax mismatch: " << amax << " vs reference " << ref_amax << std::endl;
+    }
+
+    return passed && amax_passed;
+  }
+
+  /// Initialize FP8 operands, their scale factors and the scaled FP32 copies used by the reference
+  void initialize(const ProblemShapeType& problem_size) {
+    auto problem_shape_MNKL = cute::append<4>(problem_size, 1);
+    auto [M, N, K, L] = problem_shape_MNKL;
+
+    stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+    stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, L));
+    stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, L));
+    stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L));
+
+    int scale_blocks_M = cute::ceil_div(M, ScaleBlockM);
+    int scale_blocks_N = cute::ceil_div(N, ScaleBlockN);
+    int scale_blocks_K = cute::ceil_div(K, ScaleBlockK);
+    size_t scale_A_size = IsBlockScaled ? size_t(scale_blocks_M) * scale_blocks_K * L : 1;
+    size_t scale_B_size = IsBlockScaled ? size_t(scale_blocks_N) * scale_blocks_K * L : 1;
+
+    block_A.reset(M * K * L);
+    block_B.reset(K * N * L);
+    block_scale_A.reset(scale_A_size);
+    block_scale_B.reset(scale_B_size);
+    block_A_dq.reset(M * K * L);
+    block_B_dq.reset(K * N * L);
+    block_C.reset(M * N * L);
+    block_D.reset(M * N * L);
+    block_ref_D.reset(M * N * L);
+    block_amax_D.reset(1);
+
+    std::ranlux24_base rng(seed + 2023);
+    std::uniform_real_distribution<float> value_dist(-2.f, 2.f);
+    std::uniform_real_distribution<float> scale_dist(0.5f, 2.f);
+
+    std::vector<ElementScale> scale_A(scale_A_size), scale_B(scale_B_size);
+    for (auto& s : scale_A) { s = scale_dist(rng); }
+    for (auto& s : scale_B) { s = scale_dist(rng); }
+
+    auto scale_index = [&](int l, int mn_block, int k, int mn_blocks) {
+      return IsBlockScaled ? (size_t(l) * mn_blocks + mn_block) * scale_blocks_K + k / ScaleBlockK : 0;
+    };
+
+    // A is (M, K) row-major
+    std::vector<ElementA> A(block_A.size());
+    std::vector<float> A_dq(block_A.size());
+    for (int l = 0; l < L; ++l) {
+      for (int m = 0; m < M; ++m) {
+        for (int k = 0; k < K; ++k) {
+          size_t idx = (size_t(l) * M + m) * K + k;
+          A[idx] = ElementA(value_dist(rng));
+          A_dq[idx] = float(A[idx]) * scale_A[scale_index(l, m / ScaleBlockM, k, scale_blocks_M)];
+        }
+      }
+    }
+
+    // B is (K, N) row-major
+    std::vector<ElementB> B(block_B.size());
+    std::vector<float> B_dq(block_B.size());
+    for (int l = 0; l < L; ++l) {
+      for (int k = 0; k < K; ++k) {
+        for (int n = 0; n < N; ++n) {
+          size_t idx = (size_t(l) * K + k) * N + n;
+          B[idx] = ElementB(value_dist(rng));
+          B_dq[idx] = float(B[idx]) * scale_B[scale_index(l, n / ScaleBlockN, k, scale_blocks_N)];
+        }
+      }
+    }
+
+    block_A.copy_from_host(A.data());
+    block_B.copy_from_host(B.data());
+    block_scale_A.copy_from_host(scale_A.data());
+    block_scale_B.copy_from_host(scale_B.data());
+    block_A_dq.copy_from_host(A_dq.data());
+    block_B_dq.copy_from_host(B_dq.data());
+    initialize_block(block_C, seed + 2021);
+  }
+
+  void run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
+    ProblemShapeType problem_size = ProblemShapeType{options.m, options.n, options.k, options.l};
+
+    initialize(problem_size);
+
+    typename Gemm::GemmKernel::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {block_A.get(), stride_A, block_B.get(), stride_B, block_scale_A.get(), block_scale_B.get()},
+      {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D},
+      hw_info
+    };
+    arguments.epilogue.thread.amax_D_ptr = block_amax_D.get();
+
+    Gemm gemm_op;
+
+    size_t workspace_size = Gemm::get_workspace_size(arguments);
+    cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+    CUTLASS_CHECK(gemm_op.can_implement(arguments));
+    CUTLASS_CHECK(gemm_op.initialize(arguments, workspace.get()));
+
+    // Run the GEMM
+    CUTLASS_CHECK(gemm_op.run());
+
+    syclcompat::wait();
+
+    // Verify that the result is correct
+    bool passed = verify(problem_size, options.alpha, options.beta);
+    std::cout << "Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+    if (passed && options.iterations > 0) {
+      GPU_Clock timer;
+      timer.start();
+      for (int i = 0; i < options.iterations; ++i) {
+        CUTLASS_CHECK(gemm_op.run());
+      }
+      syclcompat::wait();
+
+      float cute_time = timer.seconds() / options.iterations;
+      double tflops = (2.0 * options.m * options.n * options.k * options.l) * 1e-12;
+      std::cout << "Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << 'x' << options.l << std::endl;
+      printf("Cutlass GEMM Performance:     [%4.3f]TFlop/s  (%6.4f)ms\n", tflops / cute_time, cute_time*1000);
+    }
+
+    return;
+  }
+
+};
+
+template <class ScaleBlockShape>
+struct GemmConfiguration {
+  // The code section below describes datatype for input, output matrices and computation between
+  // elements in input matrices.
+  using ElementAccumulator = float;                   // <- data type of accumulator
+  using ElementComputeEpilogue = float;  // <- data type of epilogue operations
+  using ElementInputA = cutlass::float_e4m3_t;        // <- data type of elements in input matrix A
+  using ElementInputB = cutlass::float_e4m3_t;        // <- data type of elements in input matrix B
+  using ElementOutput = float;                        // <- data type of elements in output matrix D
+  using ElementAmax = float;                          // <- data type of the amax of D
+
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  // FP8 tiles are loaded with 1-byte block loads and upconverted to bf16 in registers
+  using GmemTiledCopyA = XE_2D_U8x32x32_LD_V;
+  using GmemTiledCopyB = XE_2D_U8x32x32_LD_V;
+
+  // Workgroup-level tile
+  using TileShape = Shape<_256, _256, _32>;
+
+  using TiledMma =
+    TiledMMA<MMA_Atom<XE_8x16x16_F32BF16BF16F32_TT>,
+              Layout<Shape<_8, _4, _1>, Stride<_4, _1, _0>>,
+              Tile<Layout<Shape<_8, _8, _4>, Stride<_1, _32, _8>>,
+                  Layout<Shape<_16, _4, _4>, Stride<_1, _64, _16>>, _32>>;
+
+  constexpr static int PipelineStages = 3;
+  using GEMMDispatchPolicy = cutlass::gemm::MainloopIntelPVCFP8<PipelineStages, ScaleBlockShape>;
+  using EpilogueDispatchPolicy = cutlass::epilogue::IntelPVCEpilogue;
+
+  using EpilogueOp = cutlass::epilogue::fusion::LinCombAmax<ElementOutput, ElementComputeEpilogue,
+          ElementAmax, ElementAccumulator, ElementAccumulator, cutlass::FloatRoundStyle::round_to_nearest>;
+
+  using FusionCallBacks = cutlass::epilogue::fusion::FusionCallbacks<EpilogueDispatchPolicy, EpilogueOp, TileShape,
+          decltype(tile_shape(TiledMma()))>;
+  using CollectiveEpilogue = cutlass::epilogue::collective::CollectiveEpilogue<
+          EpilogueDispatchPolicy,
+          TileShape,
+          ElementAccumulator,
+          cutlass::gemm::TagToStrideC_t<LayoutC>,
+          ElementOutput,
+          cutlass::gemm::TagToStrideC_t<LayoutD>,
+          FusionCallBacks,
+          XE_2D_U32x8x16_LD_N,
+          void, void,
+          XE_2D_U32x8x16_ST_N,
+          void, void>;
+
+  // Mainloop
+  using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+          GEMMDispatchPolicy,
+          TileShape,
+          ElementInputA,
+          cutlass::gemm::TagToStrideA_t<LayoutA>,
+          ElementInputB,
+          cutlass::gemm::TagToStrideB_t<LayoutB>,
+          TiledMma,
+          GmemTiledCopyA, void, void, cute::identity,  // A
+          GmemTiledCopyB, void, void, cute::identity   // B
+  >;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+  Shape<int, int, int, int>,
+  CollectiveMainloop,
+  CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+int main(int argc, const char** argv)
+{
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    std::cerr << "Aborting execution." << std::endl;
+    return -1;
+  }
+
+  //
+  // Run examples
+  //
+
+  // The KernelHardwareInfo struct holds the number of EUs on the GPU with a given device ID. This
+  // information is used by the underlying kernel.
+  cutlass::KernelHardwareInfo hw_info;
+
+  // Change device_id to another value if you are running on a machine with multiple GPUs and wish
+  // to use a GPU other than that with device ID 0.
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  if (options.block_scaling) {
+    // One scale factor per 128x128 block of A and B
+    using ScaleBlockShape = Shape<_128, _128, _128>;
+    ExampleRunner<typename GemmConfiguration<ScaleBlockShape>::Gemm> runner;
+    runner.run(options, hw_info);
+  }
+  else {
+    ExampleRunner<typename GemmConfiguration<void>::Gemm> runner;
+    runner.run(options, hw_info);
+  }
+
+  return 0;
+}
@@ -44,6 +44,9 @@ SYCL_EXTERNAL __attribute__((convergent)) void __spirv_ControlBarrierArriveINTEL
 #define EXECUTION_SCOPE_WORK_GROUP 2
 #define MEMORY_SCOPE_WORK_GROUP 2
 #define MEMORY_SEMANTICS_RELAXED 0
+#define MEMORY_SEMANTICS_ACQUIRE 0x2
+#define MEMORY_SEMANTICS_RELEASE 0x4
+#define MEMORY_SEMANTICS_WORKGROUP_MEMORY 0x100
 
 #elif defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 900 && (__CUDACC_VER_MAJOR__ >= 12)
 #define CUDA_BARRIER_ENABLED 1
@@ -231,6 +234,25 @@ class NamedBarrier {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if defined(SYCL_INTEL_TARGET)
+// Split work-group barrier of Intel Xe GPUs. Every work-item of the work-group must call
+// xe_barrier_wait() after each xe_barrier_arrive(), and before arriving again. The shared local
+// memory accesses a work-item made before arriving are visible to the others once they waited.
+CUTLASS_DEVICE
+void xe_barrier_arrive() {
+  __spirv_ControlBarrierArriveINTEL(EXECUTION_SCOPE_WORK_GROUP, MEMORY_SCOPE_WORK_GROUP,
+                                    MEMORY_SEMANTICS_RELEASE | MEMORY_SEMANTICS_WORKGROUP_MEMORY);
+}
+
+CUTLASS_DEVICE
+void xe_barrier_wait() {
+  __spirv_ControlBarrierWaitINTEL(EXECUTION_SCOPE_WORK_GROUP, MEMORY_SCOPE_WORK_GROUP,
+                                  MEMORY_SEMANTICS_ACQUIRE | MEMORY_SEMANTICS_WORKGROUP_MEMORY);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // Hopper introduces a new cluster-wide barrier which handle with Cluster-wide arrive-wait behaviour.
 // This is an extension to the Ampere arrive-wait barriers
 // Note : Ampere arrive-wait Barriers have a larger max-arrive count (2^30) than Hopper arrive-wait Barriers (2^20).
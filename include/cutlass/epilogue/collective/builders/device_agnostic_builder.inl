@@ -35,6 +35,7 @@
 #include <cute/arch/copy.hpp>
 
 #include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/collective/softmax_epilogue.hpp"
 
 
 namespace cutlass::epilogue::collective {
@@ -88,4 +89,60 @@ struct CollectiveBuilder<
           cutlass::gemm::EpilogueDefault>;
 };
 
+// D = alpha * acc + beta * C, plus the per-row softmax partials of every tile.
+// The partials are (M, ceil(N / BLK_N), L) column-major tensors of ElementCompute.
+template<
+  class TileShape_MNK,
+  class ElementAccumulator_,
+  class ElementCompute_,
+  class ElementC_,
+  class GmemLayoutTagC_,
+  int AlignmentC_,
+  class ElementD_,
+  class GmemLayoutTagD_,
+  int AlignmentD_,
+  class FusionOpOrCallbacks
+>
+struct CollectiveBuilder<
+  arch::Agnostic,
+  arch::OpMultiplyAdd,
+  TileShape_MNK,
+  Shape<_1, _1, _1>,
+  EpilogueTileAuto,
+  ElementAccumulator_,
+  ElementCompute_,
+  ElementC_,
+  GmemLayoutTagC_,
+  AlignmentC_,
+  ElementD_,
+  GmemLayoutTagD_,
+  AlignmentD_,
+  EpilogueScheduleAuto,
+  FusionOpOrCallbacks,
+  cute::enable_if_t<
+    (cute::is_same_v<FusionOpOrCallbacks,
+       cutlass::epilogue::fusion::LinCombSoftmaxRowPartials<ElementD_, ElementCompute_, ElementC_, ElementCompute_>>)
+  >
+> {
+  using ElementD = ElementD_;
+  using ElementOutput = ElementD_;
+  using ElementCompute = ElementCompute_;
+  using ElementAccumulator = ElementAccumulator_;
+
+  static_assert(cute::is_same_v<ElementAccumulator, ElementCompute>,
+    "Softmax partials are stored in the accumulator type, which must match the compute type.");
+
+  static constexpr int FragmentSize = 1;
+  using ThreadOp = thread::LinearCombination<
+    ElementD, FragmentSize, ElementAccumulator, ElementCompute>;
+
+  using CollectiveOp = cutlass::epilogue::collective::SoftmaxEpilogue<
+          cutlass::detail::TagToStrideC_t<GmemLayoutTagC_>,
+          cutlass::detail::TagToStrideC_t<GmemLayoutTagD_>,
+          cutlass::detail::TagToStrideC_t<layout::ColumnMajor>,
+          TileShape_MNK,
+          ThreadOp,
+          cutlass::gemm::EpilogueDefault>;
+};
+
 } // namespace cutlass::epilogue::collective
@@ -118,6 +118,52 @@ namespace detail {
         CopyOpG2R
       >;
   };
+
+  template <
+    class ElementD,
+    class ElementCompute,
+    class ElementC
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombSoftmaxRowPartials<
+    ElementD, ElementCompute, ElementC, ElementCompute
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombSoftmaxRowPartials<ElementD, ElementCompute, ElementC, ElementCompute>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
+
+  template <
+    class ElementD,
+    class ElementCompute,
+    class ElementC
+  >
+  struct FusionOpInfo<cutlass::epilogue::fusion::LinCombResidualRmsNorm<
+    ElementD, ElementCompute, ElementC, ElementCompute
+  >> {
+      constexpr static bool HasBuilder = true;
+
+      template <
+        class DispatchPolicy,
+        class TileShape_MNK,
+        class EpilogueTile,
+        class>
+      using FusionCallbacks = cutlass::epilogue::fusion::FusionCallbacks<
+        DispatchPolicy,
+        cutlass::epilogue::fusion::LinCombResidualRmsNorm<ElementD, ElementCompute, ElementC, ElementCompute>,
+        TileShape_MNK,
+        EpilogueTile
+      >;
+  };
 }
 
   // Intel epilogue builder
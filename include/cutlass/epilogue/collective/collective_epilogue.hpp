@@ -60,6 +60,7 @@ class CollectiveEpilogue {
 #include "default_epilogue.hpp"
 #include "default_epilogue_array.hpp"
 #include "epilogue_tensor_broadcast.hpp"
+#include "softmax_epilogue.hpp"
 #include "sm70_epilogue_vectorized.hpp"
 #include "sm70_epilogue_vectorized_array.hpp"
 #include "sm90_epilogue_tma_warpspecialized.hpp"
@@ -67,6 +68,8 @@ class CollectiveEpilogue {
 #include "sm90_epilogue_array_tma_warpspecialized.hpp"
 #if defined (SYCL_INTEL_TARGET)
 #include "xe_epilogue.hpp"
+#include "xe_array_epilogue.hpp"
+#include "xe_dual_epilogue.hpp"
 #endif
 //
 // Conv
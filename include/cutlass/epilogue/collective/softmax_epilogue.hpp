@@ -31,7 +31,10 @@
 
 #pragma once
 
+#include <limits>
+
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/epilogue/collective/detail.hpp"
 
@@ -47,8 +50,12 @@ namespace collective {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Applies an element wise operation to all elements within the fragment
-/// and writes them out to destination storage.
+/// Applies an element wise operation to all elements within the fragment and writes them out to
+/// destination storage. Also writes, for every row of the tile, the maximum of the row and the sum
+/// of its exponentials relative to that maximum to two (M, ceil(N / BLK_N), L) partial tensors,
+/// which reduction::kernel::SoftmaxFinalize combines into the row softmax of D.
+/// The partials are reduced through shared memory with one thread per row of the tile, so the
+/// tile M extent must be equal to the number of threads of the TiledMma.
 template <
   class StrideC_,
   class StrideD_,
@@ -266,6 +273,11 @@ public:
     // assumption for reductions: size<0>(sC) == block size
     assert(size<0>(sC) == BlockDimX() * BlockDimY() * BlockDimZ());
     
+    // The partials of rows past M would land in the next column of the partial tensors
+    if (thread_idx >= get<0>(residue_mnk)) {
+      return;
+    }
+
     ElementAccumulator max = std::numeric_limits<ElementAccumulator>::lowest();
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < size<1>(sC); ++i) {
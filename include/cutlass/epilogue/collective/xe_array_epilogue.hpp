@@ -0,0 +1,283 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Ptr-array batched epilogue for PVC, built on the IntelPVCEpilogue collective.
+*/
+
+#pragma once
+
+#include <sycl/sycl.hpp>
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_epilogue.hpp"
+#include "cutlass/epilogue/collective/detail.hpp"
+#include "cutlass/epilogue/collective/xe_epilogue.hpp"
+#include "cutlass/epilogue/fusion/callbacks.hpp"
+#include "cutlass/detail/layout.hpp"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace epilogue {
+namespace collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Every batch l reads C through ptr_C[l] and writes D through ptr_D[l]. All batches share the
+// problem shape and strides; the L mode of StrideC/StrideD is ignored.
+// FusionCallbacks are the ones of IntelPVCEpilogue. They see each batch as an independent
+// problem (L = 1, l = 0), so per-batch fusion operands are not supported.
+template <
+  class CtaTileMNK_,
+  class ElementC_,
+  class StrideC_,
+  class ElementD_,
+  class StrideD_,
+  class FusionCallbacks_,
+  class CopyOpG2R_,
+  class SmemLayoutAtomC_,
+  class CopyOpS2R_,
+  class CopyOpR2G_,
+  class SmemLayoutAtomD_,
+  class CopyOpR2S_
+>
+class CollectiveEpilogue<
+    IntelPVCPtrArrayEpilogue,
+    CtaTileMNK_,
+    ElementC_,
+    StrideC_,
+    ElementD_,
+    StrideD_,
+    FusionCallbacks_,
+    CopyOpG2R_,
+    SmemLayoutAtomC_,
+    CopyOpS2R_,
+    CopyOpR2G_,
+    SmemLayoutAtomD_,
+    CopyOpR2S_
+> {
+public:
+  //
+  // Type Aliases
+  //
+  using Base = CollectiveEpilogue<
+    IntelPVCEpilogue,
+    CtaTileMNK_,
+    ElementC_,
+    StrideC_,
+    ElementD_,
+    StrideD_,
+    FusionCallbacks_,
+    CopyOpG2R_,
+    SmemLayoutAtomC_,
+    CopyOpS2R_,
+    CopyOpR2G_,
+    SmemLayoutAtomD_,
+    CopyOpR2S_>;
+  using DispatchPolicy = IntelPVCPtrArrayEpilogue;
+  using CtaTileMNK = CtaTileMNK_;
+  using FusionCallbacks = FusionCallbacks_;
+  using ElementC = ElementC_;
+  using ElementAccumulator = ElementC_;
+  using StrideC = StrideC_;
+  using ElementD = ElementD_;
+  using StrideD = StrideD_;
+  using CopyOpG2R = CopyOpG2R_;
+  using CopyOpR2G = CopyOpR2G_;
+
+  using ThreadEpilogueOp = typename Base::ThreadEpilogueOp;
+  using GmemTiledCopyC = CopyOpG2R;
+  using GmemTiledCopyD = CopyOpR2G;
+  using ElementOutput = typename FusionCallbacks::ElementOutput;
+  using ElementCompute = typename FusionCallbacks::ElementCompute;
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using NonVoidElementD = typename Base::NonVoidElementD;
+  using Trait_C = typename Base::Trait_C;
+  using Trait_D = typename Base::Trait_D;
+  using XE_Copy_C = typename Base::XE_Copy_C;
+  using XE_Copy_D = typename Base::XE_Copy_D;
+
+private:
+  constexpr static bool is_source_supported = not cute::is_void_v<ElementC>;
+  constexpr static bool is_destination_supported = not cute::is_void_v<ElementD>;
+
+public:
+  using SharedStorage = typename Base::SharedStorage;
+  using TensorStorage = typename Base::TensorStorage;
+
+  // Host side epilogue arguments
+  struct Arguments {
+    typename FusionCallbacks::Arguments thread{};
+    ElementC const** ptr_C;
+    StrideC dC;
+    NonVoidElementD** ptr_D;
+    StrideD dD;
+  };
+
+  // Device side epilogue params
+  struct Params {
+    typename FusionCallbacks::Params thread{};
+    ElementC const* const* ptr_C;
+    NonVoidElementD* const* ptr_D;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      ProblemShape const& problem_shape,
+      Arguments const& args,
+      [[maybe_unused]] void* workspace) {
+    return {
+      FusionCallbacks::to_underlying_arguments(problem_shape, args.thread, workspace),
+      args.ptr_C,
+      args.ptr_D
+    };
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return FusionCallbacks::initialize_workspace(problem_shape, args.thread, workspace, stream, cuda_adapter);
+  }
+
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    bool fusion_implementable = FusionCallbacks::can_implement(problem_shape_MNKL, args.thread);
+
+    if (!fusion_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum requirements for FusionCallbacks.\n");
+    }
+
+    bool ptrs_implementable = (!is_source_supported || args.ptr_C != nullptr) &&
+                              (!is_destination_supported || args.ptr_D != nullptr);
+    if (!ptrs_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Ptr-array epilogue requires the arrays of C and D pointers.\n");
+    }
+
+    return fusion_implementable && ptrs_implementable;
+  }
+
+  CUTLASS_HOST_DEVICE
+  CollectiveEpilogue(Params const& params_, TensorStorage const& shared_storage_)
+      : params(params_), shared_storage(shared_storage_) {}
+
+  CUTLASS_DEVICE
+  bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  template<
+    class ProblemShapeMNKL,
+    class TileShapeMNK,
+    class TileCoordMNKL,
+    class Accumulator,
+    class TiledMma,
+    class ResidueMNK
+  >
+  CUTLASS_DEVICE void
+  operator() (
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShapeMNK tile_shape_MNK,
+      TileCoordMNKL tile_coord_mnkl,
+      Accumulator accumulators,
+      TiledMma tiled_mma,
+      ResidueMNK residue_mnk,
+      int thread_idx,
+      char* smem) {
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto l_coord = get<3>(tile_coord_mnkl);
+
+    // Build the 2D block copies of this batch, which then becomes batch 0
+    XE_Copy_C xe_load_c = {};
+    if constexpr (is_source_supported) {
+      xe_load_c = make_tiled_copy(Copy_Atom<Trait_C, ElementC>{}.with(
+                                  params.ptr_C[l_coord], M, N),
+                                  Layout<Shape<_1, Int<SubgroupSize>>>{},
+                                  make_layout(make_shape(get<0>(typename Trait_C::BlockShape{}),
+                                                         get<1>(typename Trait_C::BlockShape{}) / Int<SubgroupSize>{})));
+    }
+
+    XE_Copy_D xe_store_d = {};
+    if constexpr (is_destination_supported) {
+      xe_store_d = make_tiled_copy(Copy_Atom<Trait_D, NonVoidElementD>{}.with(
+                                   params.ptr_D[l_coord], M, N),
+                                   Layout<Shape<_1, Int<SubgroupSize>>>{},
+                                   make_layout(make_shape(get<0>(typename Trait_D::BlockShape{}),
+                                                          get<1>(typename Trait_D::BlockShape{}) / Int<SubgroupSize>{})));
+    }
+
+    typename Base::Params batch_params{params.thread, xe_load_c, xe_store_d};
+    Base epilogue{batch_params, shared_storage};
+    epilogue(
+      replace<3>(problem_shape_mnkl, 1),
+      tile_shape_MNK,
+      replace<3>(tile_coord_mnkl, 0),
+      accumulators,
+      tiled_mma,
+      residue_mnk,
+      thread_idx,
+      smem
+    );
+  }
+
+private:
+  Params const& params;
+  TensorStorage const& shared_storage;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace collective
+} // namespace epilogue
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
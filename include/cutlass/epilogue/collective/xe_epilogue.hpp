@@ -124,9 +124,11 @@ public:
                                              Layout<Shape<_1, Int<SubgroupSize>>>{},
                                              make_layout(make_shape(get<0>(typename Trait_C::BlockShape{}),
                                                                     get<1>(typename Trait_C::BlockShape{}) / Int<SubgroupSize>{}))));
+  // A void ElementD disables the store of D, e.g. when the fusion writes its own outputs
+  using NonVoidElementD = cute::conditional_t<cute::is_void_v<ElementD>, ElementAccumulator, ElementD>;
   using Trait_D = Copy_Traits<GmemTiledCopyD>;
-  using XE_Copy_D = decltype(make_tiled_copy(Copy_Atom<Trait_D, ElementD>{}
-                                             .with(static_cast<ElementD const*>(nullptr),int32_t(0), int32_t(0)),
+  using XE_Copy_D = decltype(make_tiled_copy(Copy_Atom<Trait_D, NonVoidElementD>{}
+                                             .with(static_cast<NonVoidElementD const*>(nullptr),int32_t(0), int32_t(0)),
                                              Layout<Shape<_1, Int<SubgroupSize>>>{},
                                              make_layout(make_shape(get<0>(typename Trait_D::BlockShape{}),
                                                                     get<1>(typename Trait_D::BlockShape{}) / Int<SubgroupSize>{}))));
@@ -196,7 +198,7 @@ public:
 
     XE_Copy_D xe_store_d = {};
     if constexpr (is_destination_supported) {
-      xe_store_d = make_tiled_copy(Copy_Atom<Copy_Traits<CopyOpR2G>, ElementD>{}.with(
+      xe_store_d = make_tiled_copy(Copy_Atom<Copy_Traits<CopyOpR2G>, NonVoidElementD>{}.with(
                                    args.ptr_D, M, N),
                                    Layout<Shape<_1, Int<SubgroupSize>>>{},
                                    make_layout(make_shape(get<0>(typename Trait_D::BlockShape{}),
@@ -210,6 +212,27 @@ public:
     };
   }
 
+  /// Replaces the C and D pointers of params built by to_underlying_arguments(). The 2D copy
+  /// descriptors keep their extents and pitch.
+  static void
+  update_pointers(Params& params, ElementC const* ptr_C, ElementD* ptr_D) {
+    if constexpr (is_source_supported) {
+      params.xe_load_c.base_ptr = ptr_C;
+    }
+    if constexpr (is_destination_supported) {
+      params.xe_store_d.base_ptr = ptr_D;
+    }
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same problem shape and
+  /// C/D strides. The fusion arguments are lowered again and the copies are retargeted.
+  template <class ProblemShape>
+  static void
+  update_params(Params& params, ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    params.thread = FusionCallbacks::to_underlying_arguments(problem_shape, args.thread, workspace);
+    update_pointers(params, args.ptr_C, const_cast<ElementD*>(args.ptr_D));
+  }
+
   template <class ProblemShape>
   static size_t
   get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
@@ -220,7 +243,7 @@ public:
   static cutlass::Status
   initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream, 
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    return FusionCallbacks::initialize_workspace(problem_shape, args.thread, workspace, stream, cuda_adapter);
   }
 
   template <class ProblemShape>
@@ -228,7 +251,14 @@ public:
   can_implement(
       ProblemShape const& problem_shape,
       [[maybe_unused]] Arguments const& args) {
-    return true;
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    bool fusion_implementable = FusionCallbacks::can_implement(problem_shape_MNKL, args.thread);
+
+    if (!fusion_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum requirements for FusionCallbacks.\n");
+    }
+
+    return fusion_implementable;
   }
 
   CUTLASS_HOST_DEVICE
@@ -378,7 +408,9 @@ public:
         for (int epi_v = 0; epi_v < size(trD_frag); ++epi_v) {
           trD_frag(epi_v) = cst_callbacks.visit(acc_frag_mn(epi_v), epi_v, epi_m, epi_n);
         }
-        copy(params.xe_store_d, trD, rw_coord(_, epi_m, epi_n));
+        if constexpr (is_destination_supported) {
+          copy(params.xe_store_d, trD, rw_coord(_, epi_m, epi_n));
+        }
       }
     }
 
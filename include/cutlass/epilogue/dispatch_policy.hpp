@@ -194,6 +194,17 @@ struct Sm90TmaWarpSpecializedBiasElementwise {
 struct IntelPVCEpilogue {
   static constexpr int SubgroupSize = 16;
 };
+
+// C and D of every batch are read from / written to device arrays of pointers
+struct IntelPVCPtrArrayEpilogue {
+  static constexpr int SubgroupSize = 16;
+};
+
+// Gated epilogue of the dual GEMM, the fusion is applied to ActivationFn(acc0) * acc1
+template <template <class> class ActivationFn_>
+struct IntelPVCDualGemmEpilogue {
+  static constexpr int SubgroupSize = 16;
+};
 #endif
 
 //////////////////////////////////////////////////////////////////////////////
@@ -137,6 +137,53 @@ struct LinCombTopKSoftmaxCol
     : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
 };
 
+// D = alpha * acc + beta * C
+// max(m, n_tile) = max of D(m, n) over the columns n of the tile
+// sum(m, n_tile) = sum of exp(D(m, n) - max(m, n_tile)) over the columns n of the tile
+// The row softmax of D is then completed by reduction::kernel::SoftmaxFinalize
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombSoftmaxRowPartials
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+};
+
+// D = alpha * acc + beta * C, with C the residual (usually beta = 1), so D is the updated residual
+// norm(m, n) = D(m, n) * rsqrt(mean_n(D(m, n)^2) + epsilon) * weight(n), written by the same epilogue
+//   when the tile spans all of N
+// sumsq(m, n_tile) = sum of D(m, n)^2 over the columns n of the tile otherwise, and the row RMSNorm
+//   of D is then completed by reduction::kernel::RmsNormFinalize
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombResidualRmsNorm
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+};
+
+// D = alpha * acc + beta * C
+// amax_D = max(abs(D))
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombAmax
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
 
 // D = alpha * acc + beta * C + per-row bias
 template<
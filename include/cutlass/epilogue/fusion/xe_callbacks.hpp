@@ -44,6 +44,9 @@
 #include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
 #include "cutlass/epilogue/fusion/sm90_visitor_tma_warpspecialized.hpp"
 #include "cutlass/epilogue/fusion/xe_visitor.hpp"
+#include "cutlass/epilogue/fusion/xe_visitor_topk_softmax.hpp"
+#include "cutlass/epilogue/fusion/xe_visitor_softmax.hpp"
+#include "cutlass/epilogue/fusion/xe_visitor_rmsnorm.hpp"
 #include "cutlass/epilogue/fusion/sm90_visitor_load_tma_warpspecialized.hpp"
 #include "cutlass/epilogue/fusion/sm90_visitor_store_tma_warpspecialized.hpp"
 #include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp"
@@ -340,6 +343,335 @@ struct FusionCallbacks<
   using Impl::Impl;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombTopKSoftmaxCol =
+  Sm90EVT<XeTopKSoftmaxColReduction<TopK, CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // softmax(top_k(beta * C + (alpha * acc)))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+// Writes the softmax weights of the top-K columns of each row and their indices,
+// typically with a void D since no other output is produced.
+template <
+  int TopK_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombTopKSoftmaxCol<TopK_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombTopKSoftmaxCol<TopK_, CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombTopKSoftmaxCol<TopK_, CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombTopKSoftmaxCol<TopK_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+
+  using TopKSoftmax = XeTopKSoftmaxColReduction<TopK_, CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, RoundStyle_>;
+  using ElementIndex = int32_t;
+  static constexpr int TopK = TopK_;
+  using StrideTopK = typename TopKSoftmax::StrideTopK;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    ElementOutput* ptr_topk_weights = nullptr;
+    ElementIndex* ptr_topk_indices = nullptr;
+    StrideTopK dTopK = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: softmax(top_k(beta * C + (alpha * acc)))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {ptr_topk_weights, ptr_topk_indices, dTopK} // unary args: top-k + softmax
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombSoftmaxRowPartials =
+  Sm90EVT<XeSoftmaxRowPartialReduction<CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // partials(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+// Writes D and the per-row softmax partials of each work-group tile, which
+// reduction::kernel::SoftmaxFinalize turns into the row softmax of D.
+template <
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombSoftmaxRowPartials<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombSoftmaxRowPartials<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombSoftmaxRowPartials<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombSoftmaxRowPartials<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+
+  using SoftmaxPartials = XeSoftmaxRowPartialReduction<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, RoundStyle_>;
+  using ElementPartial = typename SoftmaxPartials::ElementPartial;
+  using StridePartials = typename SoftmaxPartials::StridePartials;
+  static constexpr bool kRequiresWorkgroupBarrier = SoftmaxPartials::kRequiresWorkgroupBarrier;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    ElementPartial* ptr_max = nullptr;
+    ElementPartial* ptr_sum = nullptr;
+    StridePartials dPartials = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: partials(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {ptr_max, ptr_sum, dPartials} // unary args: softmax partials
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombResidualRmsNorm =
+  Sm90EVT<XeRmsNormRowReduction<CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // rmsnorm(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+// Writes the updated residual D = alpha * acc + beta * C together with its row RMSNorm. The
+// normalized output is written directly when the work-group tile spans all of N, otherwise the
+// partial sums of squares are written and reduction::kernel::RmsNormFinalize completes it.
+template <
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombResidualRmsNorm<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombResidualRmsNorm<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombResidualRmsNorm<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombResidualRmsNorm<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>;
+
+  using RmsNorm = XeRmsNormRowReduction<CtaTileShapeMNK_, typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, RoundStyle_>;
+  using ElementNorm = typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type;
+  using StrideNorm = typename RmsNorm::StrideNorm;
+  using ElementPartial = typename RmsNorm::ElementPartial;
+  using StridePartials = typename RmsNorm::StridePartials;
+  static constexpr bool kRequiresWorkgroupBarrier = RmsNorm::kRequiresWorkgroupBarrier;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(1);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    ElementNorm* ptr_norm = nullptr;
+    StrideNorm dNorm = {};
+    ElementNorm const* ptr_weight = nullptr;
+    ElementCompute epsilon = ElementCompute(1e-5);
+    ElementPartial* ptr_sumsq = nullptr;
+    StridePartials dPartials = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: rmsnorm(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {ptr_norm, dNorm, ptr_weight, epsilon, ptr_sumsq, dPartials} // unary args: rmsnorm
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using XeLinCombAmax =
+  Sm90EVT<XeScalarAbsMaxReduction<ElementOutput, ElementAmax, ElementCompute, RoundStyle>, // amax(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_,
+  class ElementSource_,
+  class ElementScalar_,
+  FloatRoundStyle RoundStyle_,
+  class CtaTileShapeMNK_,
+  class EpilogueTile_
+>
+struct FusionCallbacks<
+    epilogue::IntelPVCEpilogue,
+    fusion::LinCombAmax<ElementOutput_, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>,
+    CtaTileShapeMNK_,
+    EpilogueTile_
+> : XeLinCombAmax<typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_> {
+
+  using Impl = XeLinCombAmax<typename cutlass::detail::get_unpacked_element_type<ElementOutput_>::type, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using ElementAmax = ElementAmax_;
+  using ElementSource = ElementSource_;
+  using ElementScalar = ElementScalar_;
+  using Operation = fusion::LinCombAmax<ElementOutput_, ElementCompute_, ElementAmax_, ElementSource_, ElementScalar_, RoundStyle_>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    ElementAmax* amax_D_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: amax(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {amax_D_ptr} // unary args: amax
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
 } // namespace cutlass::epilogue::fusion
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,8 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
 
 #include "cute/tensor.hpp"
 
@@ -215,3 +217,181 @@ struct XeAuxLoad {
   }
 };
 
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Reduction Store Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Absolute maximum of the visited values over the whole problem, e.g. to derive the scale
+// factor of an FP8 output. The maximum is taken before the conversion to ElementOutput.
+// Every sub-group reduces its tile in registers and across lanes, then a single lane folds
+// the result into the global scalar with an atomic maximum.
+// The scalar is cleared by initialize_workspace unless CUTLASS_SKIP_REDUCTION_INIT is defined.
+template <
+  class ElementOutput,
+  class ElementAmax,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct XeScalarAbsMaxReduction {
+private:
+  static_assert(is_same_v<ElementAmax, float>, "Absolute maximum reduction requires an FP32 output.");
+
+  static constexpr int SubgroupSize = epilogue::IntelPVCEpilogue::SubgroupSize;
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementAmax* ptr_amax = nullptr;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return EnableNullptr || args.ptr_amax != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+  #if !defined(CUTLASS_SKIP_REDUCTION_INIT)
+    // The identity of the absolute maximum is +0, which is all bits zero
+    if (args.ptr_amax != nullptr) {
+      return zero_workspace(args.ptr_amax, sizeof(ElementAmax), stream, cuda_adapter);
+    }
+  #endif
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarAbsMaxReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeScalarAbsMaxReduction(Params const& params, SharedStorage const&) : params(params) { }
+
+  Params const params;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const&) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class ProblemShapeMNKL, class MmaAtomShape>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    ProblemShapeMNKL problem_shape_mnkl;
+    int m_offset;
+    int n_offset;
+    ElementCompute amax;
+    Params const& params;
+
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ProblemShapeMNKL problem_shape_mnkl, int m_offset, int n_offset, Params const& params)
+      : problem_shape_mnkl(problem_shape_mnkl), m_offset(m_offset), n_offset(n_offset),
+        amax(ElementCompute(0)), params(params) { }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      if constexpr (EnableNullptr) {
+        if (params.ptr_amax == nullptr) {
+          return convert_output(frg_input);
+        }
+      }
+
+      maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+      absolute_value_op<ElementCompute> abs_op{};
+
+      auto [M, N, K, L] = problem_shape_mnkl;
+      // Each lane owns one column and FragmentSize consecutive rows of the MMA atom
+      int row = m_offset + epi_m * get<0>(MmaAtomShape{}) + epi_v * FragmentSize;
+      int col = n_offset + epi_n * get<1>(MmaAtomShape{}) + int(get_sub_group_local_id());
+
+      if (col < N) {
+        Array frg_I = convert_input(frg_input);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          if (row + i < M) {
+            amax = max_op(amax, abs_op(frg_I[i]));
+          }
+        }
+      }
+
+      return convert_output(frg_input);
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if constexpr (EnableNullptr) {
+        if (params.ptr_amax == nullptr) {
+          return;
+        }
+      }
+
+      maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+      CUTLASS_PRAGMA_UNROLL
+      for (int mask = SubgroupSize / 2; mask > 0; mask /= 2) {
+        amax = max_op(amax, shfl_xor_sync(0xFFFFFFFF, amax, mask));
+      }
+
+      if (get_sub_group_local_id() == 0) {
+        atomic_maximum<ElementAmax>{}(params.ptr_amax, static_cast<ElementAmax>(amax));
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc,
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    using TiledMma = decltype(args.tiled_mma);
+    using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+    auto SG_M = get<0>(args.tile_shape_mnk);
+    auto SG_N = get<1>(args.tile_shape_mnk);
+
+    auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
+    int m_offset = m_coord * SG_M;
+    int n_offset = n_coord * SG_N;
+
+    return ConsumerStoreCallbacks<decltype(args.problem_shape_mnkl), MmaAtomShape>(
+        args.problem_shape_mnkl, m_offset, n_offset, params);
+  }
+};
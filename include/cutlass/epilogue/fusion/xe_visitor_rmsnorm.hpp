@@ -0,0 +1,267 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree row RMSNorm for the Intel PVC epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+#include "xe_visitor_row_reduction.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Row RMSNorm of the visited values, e.g. of the updated residual D = acc + C of a transformer
+// block. The visited values are passed through unchanged to D.
+//
+//   When the work-group tile spans all of N the normalization is done in the same pass: every
+//   lane keeps the values of its columns in registers, the sums of squares are reduced across
+//   the work-group tile with detail::XeRowReductionTile, and `end()` writes norm(m, n) = D(m, n) * rsqrt(mean_n(D(m, n)^2) + epsilon) * weight(n).
+//
+//   Otherwise the sums of squares of every work-group tile are written to a (M, ceil(N / CTA_N), L)
+//   column-major tensor and reduction::kernel::RmsNormFinalize completes the normalization from D.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle
+>
+struct XeRmsNormRowReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "RMSNorm row reduction requires FP32 accumulation.");
+
+  static constexpr int CtaTileN = get<1>(CtaTileShapeMNK{});
+
+public:
+  using ElementPartial = ElementCompute;
+  // (M, ceil(N / CTA_N), L) stride of the partial sums of squares
+  using StridePartials = Stride<_1, int64_t, int64_t>;
+  // (M, N, L) row-major stride of the normalized output
+  using StrideNorm = Stride<int64_t, _1, int64_t>;
+
+  // Row sums are merged across sub-groups through local memory behind work-group barriers
+  static constexpr bool kRequiresWorkgroupBarrier = true;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_norm = nullptr;            // normalized output, written when N <= CTA_N
+    StrideNorm dNorm = {};
+    ElementOutput const* ptr_weight = nullptr;    // (N) scale of the normalized output, 1 if null
+    ElementCompute epsilon = ElementCompute(1e-5);
+    ElementPartial* ptr_sumsq = nullptr;          // partial sums of squares, written when N > CTA_N
+    StridePartials dPartials = {};
+  };
+
+  using Params = Arguments;
+
+  /// Whether a problem with N columns is normalized by the epilogue itself
+  static bool
+  is_single_pass(int N) {
+    return N <= CtaTileN;
+  }
+
+  /// Extent along N of the partial tensor
+  static int
+  get_partials_extent(int N) {
+    return cute::ceil_div(N, CtaTileN);
+  }
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    return is_single_pass(int(get<1>(problem_shape_mnkl))) ? args.ptr_norm != nullptr : args.ptr_sumsq != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeRmsNormRowReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeRmsNormRowReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class Tile>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    static constexpr int SubgroupTileM = Tile::SubgroupTileM;
+    static constexpr int FragsN = Tile::FragsN;
+
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(Tile const& tile, Params const& params)
+      : tile(tile), params(params) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < SubgroupTileM; ++r) {
+        row_sumsq[r] = {ElementCompute(0)};
+      }
+    }
+
+    Tile tile;
+    Params const& params;
+
+    // Sum of squares of the columns owned by this lane, for every row of the sub-group tile
+    Array<Array<ElementCompute, 1>, SubgroupTileM> row_sumsq;
+    // Visited values of the columns owned by this lane, (SubgroupTileM, FragsN)
+    Array<ElementCompute, SubgroupTileM * FragsN> values;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      bool col_valid = tile.column(epi_n) < get<1>(tile.problem_shape_mnkl);
+      int row = Tile::template row<FragmentSize>(epi_m, epi_v);
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        ElementCompute value = col_valid ? frg_I[i] : ElementCompute(0);
+        row_sumsq[row + i][0] += value * value;
+        values[epi_n * SubgroupTileM + row + i] = value;
+      }
+
+      return convert_output(frg_input);
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      auto M = get<0>(tile.problem_shape_mnkl);
+      auto N = get<1>(tile.problem_shape_mnkl);
+
+      tile.reduce_rows(row_sumsq, [](auto& state, auto const& other) {
+        state[0] += other[0];
+      });
+
+      if (is_single_pass(N)) {
+        NumericConverter<ElementOutput, ElementCompute, RoundStyle> convert_output{};
+        int64_t offset = tile.l_coord * get<2>(params.dNorm);
+
+        Array<ElementCompute, SubgroupTileM> rstd;
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < SubgroupTileM; ++r) {
+          rstd[r] = ElementCompute(1) / cutlass::fast_sqrt(row_sumsq[r][0] / ElementCompute(N) + params.epsilon);
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int epi_n = 0; epi_n < FragsN; ++epi_n) {
+          int col = tile.column(epi_n);
+          if (col < N) {
+            ElementCompute weight = params.ptr_weight == nullptr ? ElementCompute(1)
+                                  : static_cast<ElementCompute>(params.ptr_weight[col]);
+            CUTLASS_PRAGMA_UNROLL
+            for (int r = 0; r < SubgroupTileM; ++r) {
+              int row = tile.m_offset + r;
+              if (row < M) {
+                params.ptr_norm[offset + row * get<0>(params.dNorm) + col] =
+                  convert_output(values[epi_n * SubgroupTileM + r] * rstd[r] * weight);
+              }
+            }
+          }
+        }
+      }
+      else {
+        int64_t offset = tile.partial_offset(params.dPartials);
+        tile.for_each_reduced_row([&](int r, int row) {
+          params.ptr_sumsq[offset + row] = row_sumsq[r][0];
+        });
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto tile = detail::make_xe_row_reduction_tile(args);
+    return ConsumerStoreCallbacks<decltype(tile)>(tile, params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Row reduction plumbing shared by the Intel PVC epilogue visitors that reduce across columns
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion::detail {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Position of a sub-group tile of the epilogue within the problem, and the reduction of per-row
+// states across the columns of the work-group tile.
+//
+//   Every lane owns one column and FragmentSize consecutive rows of each MMA atom it visits, and
+//   keeps a state of Components values per row of the sub-group tile. `reduce_rows()` merges the
+//   states across the sub-group with shuffles, then across the SubgroupsN sub-groups sharing the
+//   rows of the work-group tile through local memory.
+//
+template <
+  class ProblemShapeMNKL,
+  class MmaAtomShape,
+  int SubgroupTileM_,
+  int SubgroupTileN_,
+  int SubgroupsM,
+  int SubgroupsN
+>
+struct XeRowReductionTile {
+  static constexpr int SubgroupSize = epilogue::IntelPVCEpilogue::SubgroupSize;
+  static constexpr int SubgroupTileM = SubgroupTileM_;
+  // MMA atoms along N visited by every lane
+  static constexpr int FragsN = SubgroupTileN_ / get<1>(MmaAtomShape{});
+
+  ProblemShapeMNKL problem_shape_mnkl;
+  int m_offset;
+  int n_offset;
+  int sg_local_m;
+  int sg_local_n;
+  int partial_n;    // work-group tile along N, the column of the partial tensors
+  int l_coord;
+
+  /// Column of the lane in the MMA atom epi_n
+  CUTLASS_DEVICE int
+  column(int epi_n) const {
+    return n_offset + epi_n * get<1>(MmaAtomShape{}) + int(get_sub_group_local_id());
+  }
+
+  /// First row of the sub-group tile held by the lane for the fragment epi_v of the MMA atom epi_m
+  template <int FragmentSize>
+  CUTLASS_DEVICE static int
+  row(int epi_m, int epi_v) {
+    return epi_m * get<0>(MmaAtomShape{}) + epi_v * FragmentSize;
+  }
+
+  /// Offset of the column of this work-group tile in a (M, ceil(N / CTA_N), L) partial tensor
+  template <class StridePartials>
+  CUTLASS_DEVICE int64_t
+  partial_offset(StridePartials const& dPartials) const {
+    return partial_n * get<1>(dPartials) + l_coord * get<2>(dPartials);
+  }
+
+  /// Merges the row states of all columns of the work-group tile. Every lane of every sub-group
+  /// ends up with the same states, as the sub-groups merge the partials in the same order.
+  ///   merge(Array<Element, Components>& state, Array<Element, Components> const& other)
+  template <class Element, int Components, class Merge>
+  CUTLASS_DEVICE void
+  reduce_rows(Array<Array<Element, Components>, SubgroupTileM>& states, Merge merge) const {
+    int lane = int(get_sub_group_local_id());
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < SubgroupTileM; ++r) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int mask = SubgroupSize / 2; mask > 0; mask /= 2) {
+        Array<Element, Components> other;
+        CUTLASS_PRAGMA_UNROLL
+        for (int c = 0; c < Components; ++c) {
+          other[c] = shfl_xor_sync(0xFFFFFFFF, states[r][c], mask);
+        }
+        merge(states[r], other);
+      }
+    }
+
+    if constexpr (SubgroupsN > 1) {
+      constexpr int SlmSize = SubgroupsM * SubgroupsN * SubgroupTileM * Components;
+      Element* slm = syclcompat::local_mem<Element[SlmSize]>();
+      auto slm_index = [&](int sg_n, int r, int c) {
+        return ((sg_local_m * SubgroupsN + sg_n) * SubgroupTileM + r) * Components + c;
+      };
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < SubgroupTileM; ++r) {
+        if (lane == r % SubgroupSize) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int c = 0; c < Components; ++c) {
+            slm[slm_index(sg_local_n, r, c)] = states[r][c];
+          }
+        }
+      }
+
+      syncthreads();
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < SubgroupTileM; ++r) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int c = 0; c < Components; ++c) {
+          states[r][c] = slm[slm_index(0, r, c)];
+        }
+        CUTLASS_PRAGMA_UNROLL
+        for (int sg_n = 1; sg_n < SubgroupsN; ++sg_n) {
+          Array<Element, Components> other;
+          CUTLASS_PRAGMA_UNROLL
+          for (int c = 0; c < Components; ++c) {
+            other[c] = slm[slm_index(sg_n, r, c)];
+          }
+          merge(states[r], other);
+        }
+      }
+
+      // Local memory is reused by the next tile of a persistent work-group
+      syncthreads();
+    }
+  }
+
+  /// Calls store(r, row) once for every row r of the sub-group tile within M, on a single lane
+  /// of the first sub-group along N, e.g. to write the reduced rows to a partial tensor
+  template <class Store>
+  CUTLASS_DEVICE void
+  for_each_reduced_row(Store store) const {
+    if (sg_local_n != 0) {
+      return;
+    }
+    auto M = get<0>(problem_shape_mnkl);
+    int lane = int(get_sub_group_local_id());
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < SubgroupTileM; ++r) {
+      int row = m_offset + r;
+      if (lane == r % SubgroupSize && row < M) {
+        store(r, row);
+      }
+    }
+  }
+};
+
+/// Locates the sub-group tile of the consumer store callbacks
+template <class... Args>
+CUTLASS_DEVICE auto
+make_xe_row_reduction_tile(ConsumerStoreArgs<Args...> const& args) {
+  using TiledMma = decltype(args.tiled_mma);
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  constexpr int SubgroupsM = decltype(size<1>(typename TiledMma::ThrLayoutVMNK{}))::value;
+  constexpr int SubgroupsN = decltype(size<2>(typename TiledMma::ThrLayoutVMNK{}))::value;
+
+  // Arguments relate to the sub-group tile
+  auto SG_M = get<0>(args.tile_shape_mnk);
+  auto SG_N = get<1>(args.tile_shape_mnk);
+
+  auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
+
+  using Tile = XeRowReductionTile<decltype(args.problem_shape_mnkl), MmaAtomShape,
+                                  decltype(SG_M)::value, decltype(SG_N)::value, SubgroupsM, SubgroupsN>;
+  return Tile{args.problem_shape_mnkl, int(m_coord * SG_M), int(n_coord * SG_N),
+              int(m_coord % SubgroupsM), int(n_coord % SubgroupsN), int(n_coord / SubgroupsN), int(l_coord)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion::detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
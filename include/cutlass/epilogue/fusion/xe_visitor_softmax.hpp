@@ -0,0 +1,225 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree row softmax partial reduction for the Intel PVC epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+#include "xe_visitor_row_reduction.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Online softmax partial reduction across columns
+// For every row of the work-group tile, computes the maximum of the visited values and the sum
+// of their exponentials relative to that maximum, and writes both to two (M, ceil(N / CTA_N), L)
+// column-major tensors. The visited values are passed through unchanged, so D holds the logits
+// and reduction::kernel::SoftmaxFinalize combines the partials and normalizes D in place.
+//
+//   Every lane keeps a running (max, sum) pair per row for the columns it owns, rescaling the
+//   sum whenever the maximum grows. `end()` merges the pairs across the work-group tile with
+//   detail::XeRowReductionTile.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle
+>
+struct XeSoftmaxRowPartialReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Softmax partial reduction requires FP32 accumulation.");
+
+public:
+  using ElementPartial = ElementCompute;
+  // (M, ceil(N / CTA_N), L) stride shared by the partial maxima and sums
+  using StridePartials = Stride<_1, int64_t, int64_t>;
+
+  // The merge across sub-groups synchronizes the whole work-group, so every work-item of the
+  // work-group has to reach the epilogue
+  static constexpr bool kRequiresWorkgroupBarrier = true;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementPartial* ptr_max = nullptr;
+    ElementPartial* ptr_sum = nullptr;
+    StridePartials dPartials = {};
+  };
+
+  using Params = Arguments;
+
+  /// Extent along N of the partial tensors
+  static int
+  get_partials_extent(int N) {
+    return cute::ceil_div(N, int(get<1>(CtaTileShapeMNK{})));
+  }
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_max != nullptr && args.ptr_sum != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeSoftmaxRowPartialReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeSoftmaxRowPartialReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  // Merges the (max, sum) pair of another set of columns into the running pair
+  CUTLASS_DEVICE static void
+  merge(ElementCompute& max, ElementCompute& sum, ElementCompute other_max, ElementCompute other_sum) {
+    ElementCompute new_max = cutlass::fast_max(max, other_max);
+    sum = sum * fast_exp(max - new_max) + other_sum * fast_exp(other_max - new_max);
+    max = new_max;
+  }
+
+  template <class Tile>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(Tile const& tile, Params const& params)
+      : tile(tile), params(params) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < Tile::SubgroupTileM; ++r) {
+        rows[r] = {-cutlass::platform::numeric_limits<ElementCompute>::max(), ElementCompute(0)};
+      }
+    }
+
+    Tile tile;
+    Params const& params;
+
+    // Running (max, sum) of the columns owned by this lane, for every row of the sub-group tile
+    Array<Array<ElementCompute, 2>, Tile::SubgroupTileM> rows;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      int row = Tile::template row<FragmentSize>(epi_m, epi_v);
+
+      if (tile.column(epi_n) < get<1>(tile.problem_shape_mnkl)) {
+        Array frg_I = convert_input(frg_input);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          merge(rows[row + i][0], rows[row + i][1], frg_I[i], ElementCompute(1));
+        }
+      }
+
+      return convert_output(frg_input);
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      tile.reduce_rows(rows, [](auto& state, auto const& other) {
+        merge(state[0], state[1], other[0], other[1]);
+      });
+
+      int64_t offset = tile.partial_offset(params.dPartials);
+      tile.for_each_reduced_row([&](int r, int row) {
+        params.ptr_max[offset + row] = rows[r][0];
+        params.ptr_sum[offset + row] = rows[r][1];
+      });
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto tile = detail::make_xe_row_reduction_tile(args);
+    return ConsumerStoreCallbacks<decltype(tile)>(tile, params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
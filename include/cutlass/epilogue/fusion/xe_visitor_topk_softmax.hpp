@@ -0,0 +1,314 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree Top-K + Softmax fusion operation for the Intel PVC epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Top-K + Softmax reduction across columns
+// Selects the K largest values of every row, applies a softmax over them and writes
+// the resulting weights and their column indices to two (M, K, L) row-major tensors.
+// Values outside of the top-K are never written, so D is usually left as void.
+//
+//   Assumptions:
+//     1. A single sub-group spans the whole N extent of the work-group tile
+//        (the TiledMma has one sub-group along N), and CTA_N >= N.
+//     2. 1 <= K <= 8 and K <= N.
+//
+//   Every lane keeps the visited values of the columns it owns. Once all fragments
+//   have been visited, `end()` runs K rounds of a sub-group argmax for each row, so
+//   the reduction never leaves registers.
+//
+template <
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class ElementIndex = int32_t
+>
+struct XeTopKSoftmaxColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused Top-K + Softmax reduction requires FP32 accumulation.");
+  static_assert(TopK >= 1 && TopK <= 8, "Fused Top-K + Softmax reduction only supports 1 <= K <= 8.");
+
+  static constexpr int SubgroupSize = epilogue::IntelPVCEpilogue::SubgroupSize;
+
+public:
+  // (M, K, L) stride shared by the weights and the indices
+  using StrideTopK = Stride<int64_t, _1, int64_t>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_weights = nullptr;
+    ElementIndex* ptr_indices = nullptr;
+    StrideTopK dTopK = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto [M, N, K, L] = problem_shape;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    // Cross work-group reduction is not possible because there is no guarantee that all
+    // work-groups run concurrently.
+    return N <= tile_N && N >= TopK && args.ptr_weights != nullptr && args.ptr_indices != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  XeTopKSoftmaxColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  XeTopKSoftmaxColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class RTensor, class ProblemShapeMNKL, class MmaAtomShape>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(RTensor&& tCrVals, ProblemShapeMNKL problem_shape_mnkl,
+                           int m_offset, int n_offset, int l_coord, Params const& params)
+      : tCrVals(cute::forward<RTensor>(tCrVals)),
+        problem_shape_mnkl(problem_shape_mnkl),
+        m_offset(m_offset),
+        n_offset(n_offset),
+        l_coord(l_coord),
+        params(params) {}
+
+    RTensor tCrVals;                                                           // (FrgV, FragsM, FragsN)
+    ProblemShapeMNKL problem_shape_mnkl;
+    int m_offset;
+    int n_offset;
+    int l_coord;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      // Each lane of the sub-group owns one column of the MMA atom
+      auto N = get<1>(problem_shape_mnkl);
+      int col = n_offset + epi_n * get<1>(MmaAtomShape{}) + int(get_sub_group_local_id());
+      bool col_valid = col < N;
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        tCrVals(epi_v * FragmentSize + i, epi_m, epi_n) =
+          col_valid ? frg_I[i] : -cutlass::platform::numeric_limits<ElementCompute>::infinity();
+      }
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      auto [M, N, K, L] = problem_shape_mnkl;
+      int lane = int(get_sub_group_local_id());
+
+      using FrgLayout = typename cute::remove_cvref_t<RTensor>::layout_type;
+      constexpr int FragsV = decltype(size<0>(FrgLayout{}))::value;
+      constexpr int FragsM = decltype(size<1>(FrgLayout{}))::value;
+      constexpr int FragsN = decltype(size<2>(FrgLayout{}))::value;
+      constexpr int AtomM = get<0>(MmaAtomShape{});
+      constexpr int AtomN = get<1>(MmaAtomShape{});
+
+      NumericConverter<ElementOutput, ElementCompute, RoundStyle> convert_output{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_m = 0; epi_m < FragsM; ++epi_m) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < FragsV; ++v) {
+          // Rows are uniform across the sub-group
+          int row = m_offset + epi_m * AtomM + v;
+
+          Array<ElementCompute, TopK> top_k_vals;
+          Array<int, TopK> top_k_cols;
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < TopK; ++k) {
+            // Lane-local argmax over the remaining candidates
+            ElementCompute best = -cutlass::platform::numeric_limits<ElementCompute>::infinity();
+            int best_col = N;
+            CUTLASS_PRAGMA_UNROLL
+            for (int epi_n = 0; epi_n < FragsN; ++epi_n) {
+              ElementCompute val = tCrVals(v, epi_m, epi_n);
+              if (val > best) {
+                best = val;
+                best_col = n_offset + epi_n * AtomN + lane;
+              }
+            }
+
+            // Butterfly argmax across the sub-group, ties resolve to the lower column
+            CUTLASS_PRAGMA_UNROLL
+            for (int mask = SubgroupSize / 2; mask > 0; mask /= 2) {
+              ElementCompute other = shfl_xor_sync(0xFFFFFFFF, best, mask);
+              int other_col = shfl_xor_sync(0xFFFFFFFF, best_col, mask);
+              if (other > best || (other == best && other_col < best_col)) {
+                best = other;
+                best_col = other_col;
+              }
+            }
+
+            top_k_vals[k] = best;
+            top_k_cols[k] = best_col;
+
+            // The owning lane drops the selected value from its candidates
+            CUTLASS_PRAGMA_UNROLL
+            for (int epi_n = 0; epi_n < FragsN; ++epi_n) {
+              if (n_offset + epi_n * AtomN + lane == best_col) {
+                tCrVals(v, epi_m, epi_n) = -cutlass::platform::numeric_limits<ElementCompute>::infinity();
+              }
+            }
+          }
+
+          // Softmax over the selected values; top_k_vals[0] is the row maximum
+          ElementCompute sum = ElementCompute(1);
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 1; k < TopK; ++k) {
+            sum += fast_exp(top_k_vals[k] - top_k_vals[0]);
+          }
+          ElementCompute inv_sum = ElementCompute(1) / sum;
+
+          if (row >= M) {
+            continue;
+          }
+
+          // Lane k writes the k-th entry of the row
+          int64_t offset = row * get<0>(params.dTopK) + l_coord * get<2>(params.dTopK) + lane;
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < TopK; ++k) {
+            if (lane == k) {
+              ElementCompute weight = (k == 0) ? inv_sum : fast_exp(top_k_vals[k] - top_k_vals[0]) * inv_sum;
+              params.ptr_weights[offset] = convert_output(weight);
+              params.ptr_indices[offset] = static_cast<ElementIndex>(top_k_cols[k]);
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    using TiledMma = decltype(args.tiled_mma);
+    using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+    static_assert(decltype(size<2>(typename TiledMma::ThrLayoutVMNK{}))::value == 1,
+      "Fused Top-K + Softmax reduction requires a single sub-group along N.");
+
+    // Arguments relate to the sub-group tile
+    auto SG_M = get<0>(args.tile_shape_mnk);
+    auto SG_N = get<1>(args.tile_shape_mnk);
+
+    constexpr int FragsV = (get<0>(MmaAtomShape{}) * get<1>(MmaAtomShape{})) / SubgroupSize;
+    constexpr int FragsM = SG_M / get<0>(MmaAtomShape{});
+    constexpr int FragsN = SG_N / get<1>(MmaAtomShape{});
+
+    Tensor tCrVals = make_tensor<ElementCompute>(Shape<Int<FragsV>, Int<FragsM>, Int<FragsN>>{});
+
+    auto [m_coord, n_coord, k_coord, l_coord] = args.tile_coord_mnkl;
+    int m_offset = m_coord * SG_M;
+    int n_offset = n_coord * SG_N;
+
+    return ConsumerStoreCallbacks<decltype(tCrVals), decltype(args.problem_shape_mnkl), MmaAtomShape>(
+        cute::move(tCrVals), args.problem_shape_mnkl, m_offset, n_offset, l_coord, params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
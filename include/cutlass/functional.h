@@ -846,7 +846,7 @@ template <typename T>
 struct atomic_maximum {
   CUTLASS_DEVICE
   T operator()(T *ptr, T value) const {
-#if defined(__CUDA_ARCH__)
+#if defined(__CUDA_ARCH__) || defined(__SYCL_DEVICE_ONLY__)
     return atomicMax(ptr, value);
 #else
     CUTLASS_UNUSED(ptr);
@@ -871,6 +871,17 @@ struct atomic_maximum<float> {
     return ! ::signbit(value) ?
       __int_as_float(atomicMax((int*)ptr, __float_as_int(value))) :
       __uint_as_float(atomicMin((unsigned int*)ptr, __float_as_uint(value)));
+#elif defined(__SYCL_DEVICE_ONLY__)
+    // Positive floats order like signed integers, negative floats order inversely
+    // to their unsigned bit patterns.
+    if (!sycl::signbit(value)) {
+      int result = atomicMax(reinterpret_cast<int*>(ptr), reinterpret_cast<int const&>(value));
+      return reinterpret_cast<float const&>(result);
+    }
+    else {
+      unsigned int result = atomicMin(reinterpret_cast<unsigned int*>(ptr), reinterpret_cast<unsigned int const&>(value));
+      return reinterpret_cast<float const&>(result);
+    }
 #else
     CUTLASS_UNUSED(ptr);
     CUTLASS_UNUSED(value);
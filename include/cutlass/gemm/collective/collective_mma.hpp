@@ -50,6 +50,11 @@
 #if defined(SYCL_INTEL_TARGET)
 #include "cutlass/gemm/collective/xe_mma.hpp"
 #include "cutlass/gemm/collective/xe_mma_mixed_input.hpp"
+#include "cutlass/gemm/collective/xe_array_mma.hpp"
+#include "cutlass/gemm/collective/xe_dual_mma.hpp"
+#include "cutlass/gemm/collective/xe_mma_fp8.hpp"
+#include "cutlass/gemm/collective/xe_mma_slm.hpp"
+#include "cutlass/gemm/collective/xe_mma_sliced_k.hpp"
 #endif
 
 #if defined(CUTLASS_ENABLE_SYCL)
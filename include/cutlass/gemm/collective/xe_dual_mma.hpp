@@ -0,0 +1,330 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/xe_mma.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Dual GEMM mainloop for PVC, computing accum0 = A * B0 and accum1 = A * B1.
+// Each k-tile of A is loaded into registers once and consumed by the MMAs of both B operands,
+// so A is only read once from global memory. B0 and B1 share the element type, the StrideB type
+// and the copy atom, and must have the same (N, K, L) extents. Their stride values are passed
+// separately and may differ. Tile shapes and copy configuration are the ones of MainloopIntelPVC.
+template <
+  int Stages,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopIntelPVCDualGemm<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopIntelPVC<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using Base = CollectiveMma<
+    MainloopIntelPVC<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+  using DispatchPolicy = MainloopIntelPVCDualGemm<Stages>;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using TensorMKL = typename Base::TensorMKL;
+  using TensorNKL = typename Base::TensorNKL;
+
+  using atom_load_A = typename Base::atom_load_A;
+  using atom_load_B = typename Base::atom_load_B;
+  using XE_Prefetch_A = typename Base::XE_Prefetch_A;
+  using XE_Prefetch_B = typename Base::XE_Prefetch_B;
+  using PrefetchAThrShape = typename Base::PrefetchAThrShape;
+  using PrefetchBThrShape = typename Base::PrefetchBThrShape;
+  using PrefetchATileSize = typename Base::PrefetchATileSize;
+  using PrefetchBTileSize = typename Base::PrefetchBTileSize;
+
+  static constexpr int SubgroupSize = Base::SubgroupSize;
+  static constexpr auto BLK_M = Base::BLK_M;
+  static constexpr auto BLK_N = Base::BLK_N;
+  static constexpr auto BLK_K = Base::BLK_K;
+  static constexpr auto ATOM_N = Base::ATOM_N;
+  static constexpr auto SG_M = Base::SG_M;
+  static constexpr auto SG_N = Base::SG_N;
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B0;
+    StrideB dB0;
+    ElementB const* ptr_B1;
+    StrideB dB1;
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB0;
+    TensorNKL mB1;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB0_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B0)),
+                               make_layout(make_shape(N, K, L), args.dB0));
+
+    auto mB1_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B1)),
+                               make_layout(make_shape(N, K, L), args.dB1));
+
+    return Params{mA_mkl, mB0_nkl, mB1_nkl};
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_A != nullptr && args.ptr_B0 != nullptr && args.ptr_B1 != nullptr;
+  }
+
+  /// Perform a subgroup-scoped matrix multiply-accumulate of A with both B operands
+  template <
+    int PrefetchStrideA,
+    int PrefetchStrideB,
+    class FrgTensorD,
+    class TensorA,
+    class TensorB,
+    class KTileIterator,
+    class ResidueMNK,
+    class BlkCoord
+  >
+  CUTLASS_DEVICE void
+  operator() (
+      FrgTensorD &accum0,
+      FrgTensorD &accum1,
+      TensorA gA,
+      TensorB gB,
+      KTileIterator k_tile_iter, int k_tile_count,
+      ResidueMNK residue_mnk,
+      BlkCoord const &blk_coord,
+      int const &K_start,
+      int thread_idx,
+      char *smem_buf,
+      Params const& mainloop)
+  {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+
+    (void)residue_mnk;
+    (void)smem_buf;
+
+    auto tiled_copy_a = make_xe_2d_copy(atom_load_A{}.with(mainloop.mA),
+                                        Layout<Shape<_1, Int<SubgroupSize>>>{});
+    auto tiled_copy_b0 = make_xe_2d_copy(atom_load_B{}.with(mainloop.mB0),
+                                         Layout<Shape<_1, Int<SubgroupSize>>>{});
+    auto tiled_copy_b1 = make_xe_2d_copy(atom_load_B{}.with(mainloop.mB1),
+                                         Layout<Shape<_1, Int<SubgroupSize>>>{});
+
+    // Partition the copying of A and B tiles across the threads
+    auto thr_copy_A = tiled_copy_a.get_slice(thread_idx);
+    auto thr_copy_B = tiled_copy_b0.get_slice(thread_idx);
+
+    // Instantiate the MMA object and get thread slice
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(thread_idx);
+
+    // Partition fragment, B0 and B1 get a register fragment each
+    Tensor fragment_A = thr_mma.partition_fragment_A(gA(_, _, 0));
+    Tensor fragment_B0 = thr_mma.partition_fragment_B(gB(_, _, 0));
+    Tensor fragment_B1 = thr_mma.partition_fragment_B(gB(_, _, 0));
+
+    // Retile for copy
+    Tensor copy_tCrA = thr_copy_A.retile_D(fragment_A);
+    Tensor copy_tCrB0 = thr_copy_B.retile_D(fragment_B0);
+    Tensor copy_tCrB1 = thr_copy_B.retile_D(fragment_B1);
+
+    // Retile for cute::gemm
+    Tensor mma_tCrA = thr_copy_A.retile_MMA(thr_mma, fragment_A);
+    Tensor mma_tCrB0 = thr_copy_B.retile_MMA(thr_mma, fragment_B0);
+    Tensor mma_tCrB1 = thr_copy_B.retile_MMA(thr_mma, fragment_B1);
+
+    //
+    // Mainloop
+    //
+    auto [m_idx, n_idx, k_idx, l_idx] = blk_coord;
+  #ifdef CUTLASS_SYCL_SWITCH_WG
+    const int m_coord = n_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
+    const int n_coord = m_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+  #else
+    const int m_coord = m_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
+    const int n_coord = n_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+  #endif
+    const int l_coord = l_idx;
+
+    Tensor block2d_copy_iter_a = tiled_copy_a.get_pvc_tensor(make_coord(m_coord, 0, l_coord), copy_tCrA.shape());
+    auto copy_iter_a = append_pvc_tensor<1>(block2d_copy_iter_a, k_tile_count, BLK_K);
+
+    // The iterator holds logical (n, k, l) coordinates, which address B0 and B1 alike as they have
+    // the same extents. Each tiled copy applies its own operand's strides when loading.
+    Tensor block2d_copy_iter_b = tiled_copy_b0.get_pvc_tensor(make_coord(n_coord, 0, l_coord), copy_tCrB0.shape());
+    auto copy_iter_b = append_pvc_tensor<1>(block2d_copy_iter_b, k_tile_count, BLK_K);
+
+    const int k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+    int prefetch_k = 0;
+
+    Tensor block2d_prefetch_iter_a = XE_Prefetch_A{}.get_pvc_tensor(
+                               make_coord(m_coord + (get_sub_group_id() % ATOM_N) / get<1>(PrefetchAThrShape{}) * get<0>(PrefetchATileSize{}),
+                                          (k_start_idx + (get_sub_group_id() % ATOM_N) % get<1>(PrefetchAThrShape{})) * PrefetchStrideA,
+                                          l_coord),
+                               make_shape(_1{}, _1{}, _1{}));
+    auto prefetch_iter_a = append_pvc_tensor<1>(block2d_prefetch_iter_a, k_tile_count, BLK_K);
+
+    Tensor block2d_prefetch_iter_b = XE_Prefetch_B{}.get_pvc_tensor(
+                               make_coord((get_sub_group_id() / ATOM_N / get<1>(PrefetchBThrShape{}) + k_start_idx) * PrefetchStrideB,
+                                           n_coord + (get_sub_group_id() / ATOM_N) % get<1>(PrefetchBThrShape{}) * get<1>(PrefetchBTileSize{}),
+                                           l_coord),
+                               make_shape(_1{}, _1{}, _1{}));
+    auto prefetch_iter_b = append_pvc_tensor<0>(block2d_prefetch_iter_b, k_tile_count, BLK_K);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < DispatchPolicy::Stages; i++, prefetch_k++) {
+      if constexpr(cute::detail::has_prefetch<GmemTiledCopyA>) {
+        prefetch(tiled_copy_a, prefetch_iter_a(_,_,_,prefetch_k));
+      }
+      if constexpr(cute::detail::has_prefetch<GmemTiledCopyB>) {
+        prefetch(tiled_copy_b0, prefetch_iter_b(_,_,_,prefetch_k));
+        prefetch(tiled_copy_b1, prefetch_iter_b(_,_,_,prefetch_k));
+      }
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int k_tile = 0, k = k_start_idx; k_tile < k_tile_count; ++k_tile, ++k, ++prefetch_k) {
+      // Copy gmem to rmem for the first k_tile
+      copy(tiled_copy_a, copy_iter_a(_,_,_,k), copy_tCrA);
+      copy(tiled_copy_b0, copy_iter_b(_,_,_,k), copy_tCrB0);
+      copy(tiled_copy_b1, copy_iter_b(_,_,_,k), copy_tCrB1);
+
+      if(prefetch_k < k_tile_count) {
+        if constexpr(cute::detail::has_prefetch<GmemTiledCopyA>) {
+          prefetch(tiled_copy_a, prefetch_iter_a(_,_,_,prefetch_k));
+        }
+        if constexpr(cute::detail::has_prefetch<GmemTiledCopyB>) {
+          prefetch(tiled_copy_b0, prefetch_iter_b(_,_,_,prefetch_k));
+          prefetch(tiled_copy_b1, prefetch_iter_b(_,_,_,prefetch_k));
+        }
+      }
+
+      cute::gemm(tiled_mma, mma_tCrA, mma_tCrB0, accum0);
+      cute::gemm(tiled_mma, mma_tCrA, mma_tCrB1, accum1);
+    }
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
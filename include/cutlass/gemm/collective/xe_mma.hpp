@@ -178,6 +178,19 @@ struct CollectiveMma<
     return Params{mA_mkl, mB_nkl};
   }
 
+  /// Replaces the A and B pointers of params built by to_underlying_arguments(), keeping their layouts
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B) {
+    params.mA = make_tensor(make_gmem_ptr(ptr_A), params.mA.layout());
+    params.mB = make_tensor(make_gmem_ptr(ptr_B), params.mB.layout());
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same shape and strides
+  static void
+  update_params(Params& params, Arguments const& args) {
+    update_pointers(params, args.ptr_A, args.ptr_B);
+  }
+
   /// Perform a subgroup-scoped matrix multiply-accumulate
   template <
     int PrefetchStrideA,
@@ -264,12 +277,15 @@ struct CollectiveMma<
     // Mainloop
     //
     auto [m_idx, n_idx, k_idx, l_idx] = blk_coord;
+    // Index of the sub-group in the MxN grid of the TiledMma. Work-groups with several K slices
+    // (MainloopIntelPVCSlicedK) repeat that grid once per slice.
+    const int sg_idx = static_cast<int>(get_sub_group_id()) % static_cast<int>(ATOM_M * ATOM_N);
   #ifdef CUTLASS_SYCL_SWITCH_WG
-    const int m_coord = n_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
-    const int n_coord = m_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+    const int m_coord = n_idx * BLK_M + (sg_idx / ATOM_N) * SG_M;
+    const int n_coord = m_idx * BLK_N + (sg_idx % ATOM_N) * SG_N;
   #else
-    const int m_coord = m_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
-    const int n_coord = n_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+    const int m_coord = m_idx * BLK_M + (sg_idx / ATOM_N) * SG_M;
+    const int n_coord = n_idx * BLK_N + (sg_idx % ATOM_N) * SG_N;
   #endif
     const int l_coord = l_idx;
 
@@ -283,15 +299,15 @@ struct CollectiveMma<
     int prefetch_k = 0;
 
     Tensor block2d_prefetch_iter_a = XE_Prefetch_A{}.get_pvc_tensor(
-                               make_coord(m_coord + (get_sub_group_id() % ATOM_N) / get<1>(PrefetchAThrShape{}) * get<0>(PrefetchATileSize{}),
-                                          (k_start_idx + (get_sub_group_id() % ATOM_N) % get<1>(PrefetchAThrShape{})) * PrefetchStrideA,
+                               make_coord(m_coord + (sg_idx % ATOM_N) / get<1>(PrefetchAThrShape{}) * get<0>(PrefetchATileSize{}),
+                                          (k_start_idx + (sg_idx % ATOM_N) % get<1>(PrefetchAThrShape{})) * PrefetchStrideA,
                                           l_coord),
                                make_shape(_1{}, _1{}, _1{}));
     auto prefetch_iter_a = append_pvc_tensor<1>(block2d_prefetch_iter_a, k_tile_count, BLK_K);
 
     Tensor block2d_prefetch_iter_b = XE_Prefetch_B{}.get_pvc_tensor(
-                               make_coord((get_sub_group_id() / ATOM_N / get<1>(PrefetchBThrShape{}) + k_start_idx) * PrefetchStrideB,
-                                           n_coord + (get_sub_group_id() / ATOM_N) % get<1>(PrefetchBThrShape{}) * get<1>(PrefetchBTileSize{}),
+                               make_coord((sg_idx / ATOM_N / get<1>(PrefetchBThrShape{}) + k_start_idx) * PrefetchStrideB,
+                                           n_coord + (sg_idx / ATOM_N) % get<1>(PrefetchBThrShape{}) * get<1>(PrefetchBTileSize{}),
                                            l_coord),
                                make_shape(_1{}, _1{}, _1{}));
     auto prefetch_iter_b = append_pvc_tensor<0>(block2d_prefetch_iter_b, k_tile_count, BLK_K);
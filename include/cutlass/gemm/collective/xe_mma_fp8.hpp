@@ -0,0 +1,505 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// FP8 mainloop for PVC.
+// A and B are loaded from global memory as FP8 (E4M3 or E5M2) and upconverted in registers
+// to the element type of the MMA atom (bf16 or fp16, which represent every FP8 value exactly)
+// before each DPAS. Scale factors are applied to the FP32 accumulators:
+//   - ScaleBlockShape == void: one scale factor per operand, applied after the last k-tile.
+//   - ScaleBlockShape == Shape<SBM, SBN, SBK>: one scale factor per SBM x SBK block of A and
+//     per SBN x SBK block of B. Partial products of each K block are accumulated into a
+//     temporary fragment that is scaled before being added to the accumulators.
+//     The scale tensors are packed, K-fastest: scale_A is (ceil(M/SBM), ceil(K/SBK), L)
+//     with strides (ceil(K/SBK), 1, ceil(M/SBM) * ceil(K/SBK)), scale_B likewise with N.
+template <
+  int Stages,
+  class ScaleBlockShape_,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopIntelPVCFP8<Stages, ScaleBlockShape_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCFP8<Stages, ScaleBlockShape_>;
+  using WorkgroupTileShape = TileShape_;
+  using ScaleBlockShape = ScaleBlockShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using ElementMma = typename TiledMma::ValTypeA;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using ElementScale = float;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using SmemLayoutAtomA = SmemLayoutAtomA_;
+  using SmemLayoutAtomB = SmemLayoutAtomB_;
+  using SmemCopyAtomA = SmemCopyAtomA_;
+  using SmemCopyAtomB = SmemCopyAtomB_;
+  using TransformA = TransformA_;
+  using TransformB = TransformB_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+
+  static_assert(
+      (cute::is_same_v<ElementA, float_e4m3_t> || cute::is_same_v<ElementA, float_e5m2_t>) &&
+      (cute::is_same_v<ElementB, float_e4m3_t> || cute::is_same_v<ElementB, float_e5m2_t>),
+      "MainloopIntelPVCFP8 requires FP8 (E4M3 or E5M2) A and B.");
+  static_assert(cute::is_same_v<ElementMma, typename TiledMma::ValTypeB>,
+      "MainloopIntelPVCFP8 requires an MMA atom with the same A and B types.");
+  static_assert(cute::is_same_v<ElementMma, bfloat16_t> || cute::is_same_v<ElementMma, half_t>,
+      "MainloopIntelPVCFP8 upconverts FP8 to a bf16 or fp16 MMA atom.");
+  static_assert(cute::is_same_v<ElementAccumulator, float>,
+      "MainloopIntelPVCFP8 requires FP32 accumulation.");
+
+  static constexpr bool IsBlockScaled = not cute::is_void_v<ScaleBlockShape>;
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  // Every sub-group tile and every k-tile must fall within a single scale block
+  using ScaleBlockShapeMNK = cute::conditional_t<IsBlockScaled, ScaleBlockShape, Shape<_1,_1,_1>>;
+  static constexpr int ScaleBlockM = get<0>(ScaleBlockShapeMNK{});
+  static constexpr int ScaleBlockN = get<1>(ScaleBlockShapeMNK{});
+  static constexpr int ScaleBlockK = get<2>(ScaleBlockShapeMNK{});
+  static_assert(!IsBlockScaled || ScaleBlockM % SG_M == 0, "Scale block M must be a multiple of the sub-group tile M.");
+  static_assert(!IsBlockScaled || ScaleBlockN % SG_N == 0, "Scale block N must be a multiple of the sub-group tile N.");
+  static_assert(!IsBlockScaled || ScaleBlockK % BLK_K == 0, "Scale block K must be a multiple of the work-group tile K.");
+  static constexpr int KTilesPerScaleBlock = IsBlockScaled ? ScaleBlockK / BLK_K : 1;
+
+  static constexpr size_t cacheline_bytes = 64;
+  static constexpr auto block_size_w_a = cute::min(SG_K, cacheline_bytes / sizeof(ElementA));
+  static constexpr auto block_size_w_b = cute::min(SG_N, cacheline_bytes / sizeof(ElementB));
+  static constexpr auto nums_block_w_a = ceil_div(SG_K, block_size_w_a);
+  static constexpr auto nums_block_w_b = ceil_div(SG_N, block_size_w_b);
+  using PrefetchAThrShape = Shape<Int<ATOM_N /cute::gcd(ATOM_N, nums_block_w_a)>, Int<cute::gcd(ATOM_N, nums_block_w_a)>>;
+  using PrefetchBThrShape = Shape<Int<ATOM_M /cute::gcd(ATOM_M, nums_block_w_b)>, Int<cute::gcd(ATOM_M, nums_block_w_b)>>;
+  using PrefetchATileSize = decltype(ceil_div(Shape<Int<SG_M>, Int<SG_K>>{},PrefetchAThrShape{}));
+  using PrefetchBTileSize = decltype(ceil_div(Shape<Int<SG_K>, Int<SG_N>>{},PrefetchBThrShape{}));
+
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+  using traits_load_A = Copy_Traits<GmemTiledCopyA, StrideA>;
+  using atom_load_A = Copy_Atom<traits_load_A, ElementA>;
+
+  using traits_load_B = Copy_Traits<GmemTiledCopyB, StrideB>;
+  using atom_load_B = Copy_Atom<traits_load_B, ElementB>;
+
+  using XE_Prefetch_A = decltype(cute::detail::prefetch_selector<PrefetchATileSize, ElementA>());
+  using XE_Prefetch_B = decltype(cute::detail::prefetch_selector<PrefetchBTileSize, ElementB>());
+
+  using  TensorMKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementA const*>(nullptr)), make_shape(0,0,0), StrideA{}));   //(m, k)
+  using  TensorNKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementB const*>(nullptr)), make_shape(0,0,0), StrideB{}));   //(n, k)
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B;
+    StrideB dB;
+    // Per-tensor: optional pointers to a single scale factor, overriding scale_A/scale_B.
+    // Per-block: required pointers to the packed scale tensors.
+    ElementScale const* ptr_scale_A = nullptr;
+    ElementScale const* ptr_scale_B = nullptr;
+    ElementScale scale_A = ElementScale(1);
+    ElementScale scale_B = ElementScale(1);
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB;
+    ElementScale const* ptr_scale_A;
+    ElementScale const* ptr_scale_B;
+    ElementScale scale_A;
+    ElementScale scale_B;
+    int scale_blocks_M;
+    int scale_blocks_N;
+    int scale_blocks_K;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
+                              make_layout(make_shape(N, K, L), args.dB));
+
+    return Params{mA_mkl, mB_nkl,
+                  args.ptr_scale_A, args.ptr_scale_B,
+                  args.scale_A, args.scale_B,
+                  ceil_div(int(M), ScaleBlockM),
+                  ceil_div(int(N), ScaleBlockN),
+                  ceil_div(int(K), ScaleBlockK)};
+  }
+
+  /// Replaces the A and B pointers of params built by to_underlying_arguments(), keeping their layouts
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B) {
+    params.mA = make_tensor(make_gmem_ptr(ptr_A), params.mA.layout());
+    params.mB = make_tensor(make_gmem_ptr(ptr_B), params.mB.layout());
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same shape and strides
+  static void
+  update_params(Params& params, Arguments const& args) {
+    update_pointers(params, args.ptr_A, args.ptr_B);
+    params.ptr_scale_A = args.ptr_scale_A;
+    params.ptr_scale_B = args.ptr_scale_B;
+    params.scale_A = args.scale_A;
+    params.scale_B = args.scale_B;
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if constexpr (IsBlockScaled) {
+      if (args.ptr_scale_A == nullptr || args.ptr_scale_B == nullptr) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Block scaled FP8 GEMM requires scale tensors for A and B.\n");
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Helper functions to select packing for conversion
+  template <class SrcType,
+            class DstType,
+            int Cosize>
+  struct select_packing { // Naive packing policy
+    static constexpr auto value() {
+      return Int<cute::gcd(Cosize, 32 / cute::min(sizeof_bits_v<SrcType>, sizeof_bits_v<DstType>))>{};
+    }
+  };
+
+  /// Upconverts a loaded FP8 fragment to the MMA element type.
+  template <class EngineIn,
+            class EngineOut,
+            class LayoutIn,
+            class LayoutOut>
+  CUTLASS_DEVICE
+  void convert_fp8(
+    Tensor<EngineIn, LayoutIn> const& tCr_load,
+    Tensor<EngineOut, LayoutOut>& tCr_mma) {
+
+    static_assert(is_rmem<EngineIn>::value, "Input tensor for FP8 conversion must come from registers");
+    static_assert(is_rmem<EngineOut>::value, "Output tensor for FP8 conversion must come from registers");
+    static_assert(cosize_v<LayoutIn> == cosize_v<LayoutOut>);
+    static_assert(size_v<LayoutIn> == cosize_v<LayoutIn>);
+    static_assert(size_v<LayoutOut> == cosize_v<LayoutOut>);
+    using SrcType = typename EngineIn::value_type;
+    using DstType = typename EngineOut::value_type;
+
+    auto const& src = tCr_load(_, _, _);
+    auto const& dst = tCr_mma(_, _, _);
+    auto pSrc = raw_pointer_cast(src.data());
+    auto pDst = const_cast<DstType*>(raw_pointer_cast(dst.data()));
+    constexpr int num_elements = decltype(size(src))::value;
+
+    constexpr int pack = decltype(select_packing<SrcType, DstType, num_elements>::value())::value;
+    using Converter = cutlass::NumericArrayConverter<DstType, SrcType, pack, cutlass::FloatRoundStyle::round_to_nearest>;
+    using SrcArray = cutlass::Array<SrcType, pack>;
+    using DstArray = cutlass::Array<DstType, pack>;
+    constexpr int iters = num_elements / pack;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < iters; ++i) {
+      SrcArray const* pSrcArr = reinterpret_cast<SrcArray const*>(pSrc) + i;
+      DstArray* pDstArr = reinterpret_cast<DstArray*>(pDst) + i;
+      *pDstArr = Converter::convert(*pSrcArr);
+    }
+  }
+
+  /// Perform a subgroup-scoped matrix multiply-accumulate
+  template <
+    int PrefetchStrideA,
+    int PrefetchStrideB,
+    class FrgTensorD,
+    class TensorA,
+    class TensorB,
+    class FrgTensorC,
+    class KTileIterator,
+    class ResidueMNK,
+    class BlkCoord
+  >
+  CUTLASS_DEVICE void
+  operator() (
+      FrgTensorD &accum,
+      TensorA gA,
+      TensorB gB,
+      FrgTensorC const &src_accum,
+      KTileIterator k_tile_iter, int k_tile_count,
+      ResidueMNK residue_mnk,
+      BlkCoord const &blk_coord,
+      int const &K_start,
+      int thread_idx,
+      char *smem_buf,
+      Params const& mainloop)
+  {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    (void)residue_mnk;
+    (void)thread_idx;
+    (void)smem_buf;
+
+    auto tiled_copy_a = make_xe_2d_copy(atom_load_A{}.with(mainloop.mA),
+                                             Layout<Shape<_1, Int<SubgroupSize>>>{});
+    auto tiled_copy_b = make_xe_2d_copy(atom_load_B{}.with(mainloop.mB),
+                                             Layout<Shape<_1, Int<SubgroupSize>>>{});
+
+    // Partition the copying of A and B tiles across the threads
+    auto thr_copy_A = tiled_copy_a.get_slice(thread_idx);
+    auto thr_copy_B = tiled_copy_b.get_slice(thread_idx);
+
+    // Instantiate the MMA object and get thread slice
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(thread_idx);
+
+    // Partition fragment
+    Tensor fragment_A = thr_mma.partition_fragment_A(gA(_, _, 0));
+    Tensor fragment_B = thr_mma.partition_fragment_B(gB(_, _, 0));
+    // FP8 input fragments
+    Tensor tCrA_input = make_tensor<ElementA>(fragment_A.shape());
+    Tensor tCrB_input = make_tensor<ElementB>(fragment_B.shape());
+
+    static_assert(std::is_same_v<typename decltype(fragment_A)::value_type, ElementMma>);
+    static_assert(std::is_same_v<typename decltype(fragment_B)::value_type, ElementMma>);
+
+    // Retile for copy
+    auto copy_tCrA = thr_copy_A.retile_D(tCrA_input);
+    auto copy_tCrB = thr_copy_B.retile_D(tCrB_input);
+
+    // Retile for cute::gemm
+    Tensor mma_tCrA = thr_copy_A.retile_MMA(thr_mma, fragment_A);
+    Tensor mma_tCrB = thr_copy_B.retile_MMA(thr_mma, fragment_B);
+
+  #if CUTLASS_ENABLE_DEBUG_PRINTS
+    if (cutlass::thread(LOG_THREAD, LOG_GROUP)) {
+        print("======================= A: \n");
+        print("  gA : "); print(gA); print("\n");
+        print("copy_tCrA : "); print(copy_tCrA); print("\n");
+        print("  mma_tCrA : "); print(mma_tCrA); print("\n");
+
+        print("=====================  B :\n");
+        print("  gB : "); print(gB); print("\n");
+        print("copy_tCrB : "); print(copy_tCrB); print("\n");
+        print("  mma_tCrB : "); print(mma_tCrB); print("\n");
+
+        print("=====================  Config: \n");
+        print("  threads per workgroup : "); print(MaxThreadsPerBlock); print("\n");
+        print("  SubgroupTileShape : "); print(SubgroupTileShape{}); print("\n");
+        print("  ScaleBlockShape : "); print(ScaleBlockM); print("x"); print(ScaleBlockN); print("x"); print(ScaleBlockK); print("\n");
+
+        print(" PrefetchAThrShape :    ");print(PrefetchAThrShape{});print("\n");
+        print(" PrefetchBThrShape :    ");print(PrefetchBThrShape{});print("\n");
+        print(" PrefetchATileSize :    ");print(PrefetchATileSize{});print("\n");
+        print(" PrefetchBTileSize :    ");print(PrefetchBTileSize{});print("\n");
+      }
+  #endif
+
+    //
+    // Mainloop
+    //
+    auto [m_idx, n_idx, k_idx, l_idx] = blk_coord;
+  #ifdef CUTLASS_SYCL_SWITCH_WG
+    const int m_coord = n_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
+    const int n_coord = m_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+  #else
+    const int m_coord = m_idx * BLK_M + (get_sub_group_id() / ATOM_N) * SG_M;
+    const int n_coord = n_idx * BLK_N + (get_sub_group_id() % ATOM_N) * SG_N;
+  #endif
+    const int l_coord = l_idx;
+    Tensor block2d_copy_iter_a = tiled_copy_a.get_pvc_tensor(make_coord(m_coord, 0, l_coord), copy_tCrA.shape());
+    auto copy_iter_a = append_pvc_tensor<1>(block2d_copy_iter_a, k_tile_count, BLK_K);
+
+    Tensor block2d_copy_iter_b = tiled_copy_b.get_pvc_tensor(make_coord(n_coord, 0, l_coord), copy_tCrB.shape());
+    auto copy_iter_b = append_pvc_tensor<1>(block2d_copy_iter_b, k_tile_count, BLK_K);
+
+    const int k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+    int prefetch_k = 0;
+
+    Tensor block2d_prefetch_iter_a = XE_Prefetch_A{}.get_pvc_tensor(
+                               make_coord(m_coord + (get_sub_group_id() % ATOM_N) / get<1>(PrefetchAThrShape{}) * get<0>(PrefetchATileSize{}),
+                                          (k_start_idx + (get_sub_group_id() % ATOM_N) % get<1>(PrefetchAThrShape{})) * PrefetchStrideA,
+                                          l_coord),
+                               make_shape(_1{}, _1{}, _1{}));
+    auto prefetch_iter_a = append_pvc_tensor<1>(block2d_prefetch_iter_a, k_tile_count, BLK_K);
+
+    Tensor block2d_prefetch_iter_b = XE_Prefetch_B{}.get_pvc_tensor(
+                               make_coord((get_sub_group_id() / ATOM_N / get<1>(PrefetchBThrShape{}) + k_start_idx) * PrefetchStrideB,
+                                           n_coord + (get_sub_group_id() / ATOM_N) % get<1>(PrefetchBThrShape{}) * get<1>(PrefetchBTileSize{}),
+                                           l_coord),
+                               make_shape(_1{}, _1{}, _1{}));
+    auto prefetch_iter_b = append_pvc_tensor<0>(block2d_prefetch_iter_b, k_tile_count, BLK_K);
+
+    // Partial products of the current scale block along K
+    Tensor block_accum = make_fragment_like(accum);
+    ElementScale const* scale_A_row = nullptr;
+    ElementScale const* scale_B_col = nullptr;
+    if constexpr (IsBlockScaled) {
+      clear(block_accum);
+      // Sub-groups past the end of the problem still run the mainloop, keep their scale reads in bounds
+      int scale_m = cute::min(m_coord / ScaleBlockM, mainloop.scale_blocks_M - 1);
+      int scale_n = cute::min(n_coord / ScaleBlockN, mainloop.scale_blocks_N - 1);
+      scale_A_row = mainloop.ptr_scale_A + (l_coord * mainloop.scale_blocks_M + scale_m) * mainloop.scale_blocks_K;
+      scale_B_col = mainloop.ptr_scale_B + (l_coord * mainloop.scale_blocks_N + scale_n) * mainloop.scale_blocks_K;
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < DispatchPolicy::Stages; i++, prefetch_k++) {
+      if constexpr(cute::detail::has_prefetch<GmemTiledCopyA>) {
+        prefetch(tiled_copy_a, prefetch_iter_a(_,_,_,prefetch_k));
+      }
+      if constexpr(cute::detail::has_prefetch<GmemTiledCopyB>) {
+        prefetch(tiled_copy_b, prefetch_iter_b(_,_,_,prefetch_k));
+      }
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int k_tile = 0, k = k_start_idx; k_tile < k_tile_count; ++k_tile, ++k, ++prefetch_k) {
+      // Copy gmem to rmem for the first k_tile
+      copy(tiled_copy_a, copy_iter_a(_,_,_,k), copy_tCrA);
+      copy(tiled_copy_b, copy_iter_b(_,_,_,k), copy_tCrB);
+      convert_fp8(tCrA_input, mma_tCrA);
+      convert_fp8(tCrB_input, mma_tCrB);
+      if(prefetch_k < k_tile_count) {
+        if constexpr(cute::detail::has_prefetch<GmemTiledCopyA>) {
+          prefetch(tiled_copy_a, prefetch_iter_a(_,_,_,prefetch_k));
+        }
+        if constexpr(cute::detail::has_prefetch<GmemTiledCopyB>) {
+          prefetch(tiled_copy_b, prefetch_iter_b(_,_,_,prefetch_k));
+        }
+      }
+
+      if constexpr (IsBlockScaled) {
+        cute::gemm(tiled_mma, mma_tCrA, mma_tCrB, block_accum);
+
+        // Fold the partial products in once the scale block along K is complete
+        if ((k + 1) % KTilesPerScaleBlock == 0 || k_tile + 1 == k_tile_count) {
+          int scale_k = k / KTilesPerScaleBlock;
+          ElementAccumulator scale = scale_A_row[scale_k] * scale_B_col[scale_k];
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(accum); ++i) {
+            accum(i) += block_accum(i) * scale;
+          }
+          clear(block_accum);
+        }
+      }
+      else {
+        cute::gemm(tiled_mma, mma_tCrA, mma_tCrB, accum);
+      }
+    }
+
+    if constexpr (!IsBlockScaled) {
+      ElementScale scale_A = mainloop.ptr_scale_A != nullptr ? *mainloop.ptr_scale_A : mainloop.scale_A;
+      ElementScale scale_B = mainloop.ptr_scale_B != nullptr ? *mainloop.ptr_scale_B : mainloop.scale_B;
+      ElementAccumulator scale = scale_A * scale_B;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); ++i) {
+        accum(i) *= scale;
+      }
+    }
+  }
+};
+
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +177,19 @@ struct CollectiveMma<
     return Params{mA_mkl, mB_nkl};
   }
 
+  /// Replaces the A and B pointers of params built by to_underlying_arguments(), keeping their layouts
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B) {
+    params.mA = make_tensor(make_gmem_ptr(ptr_A), params.mA.layout());
+    params.mB = make_tensor(make_gmem_ptr(ptr_B), params.mB.layout());
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same shape and strides
+  static void
+  update_params(Params& params, Arguments const& args) {
+    update_pointers(params, args.ptr_A, args.ptr_B);
+  }
+
   // Helper functions to select packing for conversion
   template <class SrcType,
             class DstType,
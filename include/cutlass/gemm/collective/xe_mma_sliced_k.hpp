@@ -0,0 +1,236 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/xe_mma.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Mainloop for problems whose output has too few tiles to keep all the sub-groups busy, e.g. a
+// small M or N with a large K.
+//
+// The work-group holds KSlices copies of the ATOM_M x ATOM_N sub-group grid of the TiledMma. Slice
+// s runs the MainloopIntelPVC mainloop over the s-th contiguous range of the k-tiles of the output
+// tile. The slices then add their accumulators through shared local memory, in a fixed order, and
+// on return the work-items of slice 0 hold the result: only they may run the epilogue.
+template <
+  int Stages,
+  int KSlices_,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopIntelPVCSlicedK<Stages, KSlices_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopIntelPVC<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  using Base = CollectiveMma<
+    MainloopIntelPVC<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCSlicedK<Stages, KSlices_>;
+  using ElementAccumulator = typename Base::ElementAccumulator;
+  using Params = typename Base::Params;
+
+  static constexpr int KSlices = DispatchPolicy::KSlices;
+  static_assert(KSlices >= 1, "MainloopIntelPVCSlicedK requires at least one K slice.");
+
+  static constexpr auto BLK_M = Base::BLK_M;
+  static constexpr auto BLK_N = Base::BLK_N;
+
+  // Work-items of one slice, and of the whole work-group
+  static constexpr uint32_t ThreadsPerSlice = Base::MaxThreadsPerBlock;
+  static constexpr uint32_t MaxThreadsPerBlock = ThreadsPerSlice * KSlices;
+  static constexpr int SubgroupsPerSlice = ThreadsPerSlice / Base::SubgroupSize;
+
+  // Partial accumulators of slices 1 to KSlices - 1, interleaved across the work-items of a slice
+  struct SharedStorage {
+    cute::array_aligned<ElementAccumulator, cute::max(KSlices - 1, 1) * BLK_M * BLK_N> partials;
+  };
+
+  static_assert(sizeof(SharedStorage) <= 128 * 1024,
+      "The partial accumulators of the K slices do not fit in shared local memory, use fewer slices or a smaller tile.");
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  /// Perform a work-group-scoped matrix multiply-accumulate. All the work-items of the work-group
+  /// must call it with the same k_tile_count since it synchronizes them.
+  template <
+    int PrefetchStrideA,
+    int PrefetchStrideB,
+    class FrgTensorD,
+    class TensorA,
+    class TensorB,
+    class FrgTensorC,
+    class KTileIterator,
+    class ResidueMNK,
+    class BlkCoord
+  >
+  CUTLASS_DEVICE void
+  operator() (
+      FrgTensorD &accum,
+      TensorA gA,
+      TensorB gB,
+      FrgTensorC const &src_accum,
+      KTileIterator k_tile_iter, int k_tile_count,
+      ResidueMNK residue_mnk,
+      BlkCoord const &blk_coord,
+      int const &K_start,
+      int thread_idx,
+      char *smem_buf,
+      Params const& mainloop)
+  {
+    constexpr int FragmentSize = size(typename FrgTensorD::layout_type{});
+    static_assert(FragmentSize * ThreadsPerSlice <= BLK_M * BLK_N,
+        "The accumulators of a slice must not exceed the work-group tile.");
+
+    int const slice = static_cast<int>(get_sub_group_id()) / SubgroupsPerSlice;
+    int const slice_thread_idx = thread_idx % ThreadsPerSlice;
+
+    // Contiguous k-tile range of this slice
+    int const k_tiles_per_slice = (k_tile_count + KSlices - 1) / KSlices;
+    int const slice_k_tile_begin = cute::min(slice * k_tiles_per_slice, k_tile_count);
+    int const slice_k_tile_count = cute::min(k_tiles_per_slice, k_tile_count - slice_k_tile_begin);
+    int const k_tile_start = crd2idx((*k_tile_iter), make_shape(K_start)) + slice_k_tile_begin;
+    auto slice_k_tile_iter = cute::make_coord_iterator(idx2crd(k_tile_start, make_shape(K_start)), make_shape(K_start));
+
+    Base::template operator()<PrefetchStrideA, PrefetchStrideB>(
+      accum,
+      gA,
+      gB,
+      src_accum,
+      slice_k_tile_iter, slice_k_tile_count,
+      residue_mnk,
+      blk_coord,
+      K_start,
+      slice_thread_idx,
+      smem_buf,
+      mainloop
+    );
+
+    if constexpr (KSlices > 1) {
+      SharedStorage& storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+      ElementAccumulator* partials = storage.partials.data();
+
+      if (slice > 0) {
+        ElementAccumulator* slice_partials = partials + (slice - 1) * FragmentSize * ThreadsPerSlice;
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          slice_partials[i * ThreadsPerSlice + slice_thread_idx] = accum(i);
+        }
+      }
+      syncthreads();
+
+      if (slice == 0) {
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int s = 0; s < KSlices - 1; ++s) {
+          ElementAccumulator const* slice_partials = partials + s * FragmentSize * ThreadsPerSlice;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < FragmentSize; ++i) {
+            accum(i) += slice_partials[i * ThreadsPerSlice + slice_thread_idx];
+          }
+        }
+      }
+
+      // The next tile of a persistent work-group reuses the buffer
+      syncthreads();
+    }
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
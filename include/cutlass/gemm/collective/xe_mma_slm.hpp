@@ -0,0 +1,469 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/pipeline/pipeline.hpp"
+
+#include "cute/algorithm/functional.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+#include "cute/tensor_predicate.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Mainloop staging the A and B k-tiles of the work-group in shared local memory.
+//
+// Every k-tile is read from global memory once per work-group by all its work-items together,
+// rather than once per sub-group row/column as with the 2D block loads of MainloopIntelPVC, and the
+// sub-groups then load their MMA fragments from SLM. The tiles go through registers on their way
+// to SLM: the loads of k-tile (k + Stages - 1) are issued before the fragments of k-tile k are read
+// and stored into the free SLM buffer after them. The buffers are synchronized with PipelineXe, so
+// the MMAs of k-tile k run while the split barrier of the stage just stored is in flight.
+//
+// The global memory copies are done with 16-byte vectors along the contiguous mode of A and B, so
+// GmemTiledCopyA/B must be void. A and B must be 16-bit types (bf16 or fp16).
+template <
+  int Stages,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopIntelPVCSharedLocalMemory<Stages>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopIntelPVCSharedLocalMemory<Stages>;
+  using WorkgroupTileShape = TileShape_;
+  using ElementA = ElementA_;
+  using StrideA = StrideA_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using GmemTiledCopyA = GmemTiledCopyA_;
+  using GmemTiledCopyB = GmemTiledCopyB_;
+  using SmemLayoutAtomA = SmemLayoutAtomA_;
+  using SmemLayoutAtomB = SmemLayoutAtomB_;
+  using SmemCopyAtomA = SmemCopyAtomA_;
+  using SmemCopyAtomB = SmemCopyAtomB_;
+  using TransformA = TransformA_;
+  using TransformB = TransformB_;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+
+  static_assert(
+      platform::is_same<ElementA, ElementB>::value,
+      "MainloopIntelPVCSharedLocalMemory requires that A and B have same type.");
+  static_assert(sizeof_bits_v<ElementA> == 16, "MainloopIntelPVCSharedLocalMemory supports 16-bit A and B only.");
+  static_assert(cute::is_void_v<GmemTiledCopyA> && cute::is_void_v<GmemTiledCopyB>,
+      "MainloopIntelPVCSharedLocalMemory copies A and B with its own vector loads, GmemTiledCopyA/B must be void.");
+  static_assert(Stages >= 2, "MainloopIntelPVCSharedLocalMemory requires at least two SLM buffers.");
+
+  static constexpr int SubgroupSize = DispatchPolicy::SubgroupSize;
+
+  using MmaAtomShape = typename TiledMma::AtomShape_MNK;
+
+  static constexpr auto BLK_M = get<0>(WorkgroupTileShape{});
+  static constexpr auto BLK_N = get<1>(WorkgroupTileShape{});
+  static constexpr auto BLK_K = get<2>(WorkgroupTileShape{});
+  
+  static constexpr auto ATOM_M = get<1>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_N = get<2>(typename TiledMma::ThrLayoutVMNK{}.shape());
+  static constexpr auto ATOM_K = get<3>(typename TiledMma::ThrLayoutVMNK{}.shape());
+
+  static_assert(ATOM_K == 1, "MainloopIntelPVCSharedLocalMemory does not split K across sub-groups.");
+
+  static constexpr auto SG_M = ceil_div(BLK_M, ATOM_M);
+  static constexpr auto SG_N = ceil_div(BLK_N, ATOM_N);
+  static constexpr auto SG_K = ceil_div(BLK_K, ATOM_K);
+  using SubgroupTileShape = Shape<decltype(SG_M), decltype(SG_N), decltype(SG_K)>;
+
+  static constexpr int AtomM = get<0>(MmaAtomShape{});
+  static constexpr int AtomN = get<1>(MmaAtomShape{});
+  static constexpr int AtomK = get<2>(MmaAtomShape{});
+
+  static_assert(AtomN == SubgroupSize && AtomK == SubgroupSize,
+      "MainloopIntelPVCSharedLocalMemory requires an MMA atom of shape (M, SubgroupSize, SubgroupSize).");
+  static_assert(BLK_M % ATOM_M == 0 && SG_M % AtomM == 0, "The sub-group tile must be a multiple of the MMA atom along M.");
+  static_assert(BLK_N % ATOM_N == 0 && SG_N % AtomN == 0, "The sub-group tile must be a multiple of the MMA atom along N.");
+  static_assert(BLK_K % AtomK == 0, "The work-group tile must be a multiple of the MMA atom along K.");
+
+  static constexpr int MMA_M = SG_M / AtomM;
+  static constexpr int MMA_N = SG_N / AtomN;
+  static constexpr int MMA_K = BLK_K / AtomK;
+
+  // Not used by this mainloop, the kernels derive their prefetch strides from them
+  using PrefetchATileSize = Shape<decltype(SG_M), decltype(SG_K)>;
+  using PrefetchBTileSize = Shape<decltype(SG_K), decltype(SG_N)>;
+
+  static constexpr uint32_t MaxThreadsPerBlock = size(TiledMma{});
+
+  using  TensorMKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementA const*>(nullptr)), make_shape(0,0,0), StrideA{}));   //(m, k)
+  using  TensorNKL = decltype(make_tensor(make_gmem_ptr(static_cast<ElementB const*>(nullptr)), make_shape(0,0,0), StrideB{}));   //(n, k)
+
+  // Copy of one (Rows, BLK_K) k-tile of A or B from global memory to registers and from registers
+  // to SLM. Each work-item moves VecsPerThread vectors, running along the contiguous mode of the
+  // operand in global memory. In SLM the tile is K-major if SmemKMajor, else Rows-major.
+  template <class Element, class Stride, int Rows, bool SmemKMajor>
+  struct TileCopy {
+    static constexpr bool AlongRows = cute::is_constant<1, decltype(get<0>(Stride{}))>::value;
+    static constexpr bool AlongK = !AlongRows && cute::is_constant<1, decltype(get<1>(Stride{}))>::value;
+    static constexpr int VecElements = (AlongRows || AlongK) ? 16 / int(sizeof(Element)) : 1;
+    static constexpr int VecsPerLine = (AlongRows ? Rows : int(BLK_K)) / VecElements;
+    static constexpr int TotalVecs = Rows * int(BLK_K) / VecElements;
+    static constexpr int VecsPerThread = ceil_div(TotalVecs, int(MaxThreadsPerBlock));
+    static constexpr int SmemElements = Rows * int(BLK_K);
+
+    static_assert(Rows % VecElements == 0 && BLK_K % VecElements == 0,
+        "The work-group tile must be a multiple of 16 bytes along M, N and K.");
+
+    using Vector = cutlass::AlignedArray<Element, VecElements>;
+    using Fragment = cutlass::Array<Vector, VecsPerThread>;
+
+    // Tile coordinate of the first element of the idx-th vector
+    CUTLASS_DEVICE static void
+    coord(int idx, int& row, int& k) {
+      int const line = idx / VecsPerLine;
+      int const pos = (idx % VecsPerLine) * VecElements;
+      row = AlongRows ? pos : line;
+      k = AlongRows ? line : pos;
+    }
+
+    CUTLASS_DEVICE static int
+    smem_offset(int row, int k) {
+      return SmemKMajor ? row * int(BLK_K) + k : k * Rows + row;
+    }
+
+    // Loads the tile starting at `tile` into registers, zero-filling the rows at and past `rows`
+    CUTLASS_DEVICE static void
+    load(Fragment& frag, Element const* tile, int64_t row_stride, int64_t k_stride, int rows, int thread_idx) {
+      // Vectors are only used when every one of them is 16-byte aligned
+      int64_t const pitch = AlongRows ? k_stride : row_stride;
+      bool const vectorize = (VecElements > 1) && (pitch % VecElements == 0) &&
+                             (reinterpret_cast<uintptr_t>(tile) % sizeof(Vector) == 0);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < VecsPerThread; ++i) {
+        int const idx = thread_idx + i * int(MaxThreadsPerBlock);
+        frag[i].clear();
+        if (idx < TotalVecs) {
+          int row, k;
+          coord(idx, row, k);
+          Element const* src = tile + row * row_stride + k * k_stride;
+          int const valid = AlongRows ? rows - row : (row < rows ? VecElements : 0);
+          if (vectorize && valid >= VecElements) {
+            frag[i] = *reinterpret_cast<Vector const*>(src);
+          }
+          else {
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < VecElements; ++j) {
+              if (j < valid) {
+                frag[i][j] = src[j];
+              }
+            }
+          }
+        }
+      }
+    }
+
+    CUTLASS_DEVICE static void
+    store(Fragment const& frag, Element* smem, int thread_idx) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < VecsPerThread; ++i) {
+        int const idx = thread_idx + i * int(MaxThreadsPerBlock);
+        if (idx < TotalVecs) {
+          int row, k;
+          coord(idx, row, k);
+          if constexpr (VecElements > 1 && AlongK == SmemKMajor) {
+            *reinterpret_cast<Vector*>(smem + smem_offset(row, k)) = frag[i];
+          }
+          else {
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < VecElements; ++j) {
+              smem[AlongRows ? smem_offset(row + j, k) : smem_offset(row, k + j)] = frag[i][j];
+            }
+          }
+        }
+      }
+    }
+  };
+
+  // A is K-major in SLM so that lane k of a sub-group reads column k of the A fragment, and B is
+  // N-major so that lane n reads column n of the B fragment
+  using TileCopyA = TileCopy<ElementA, StrideA, int(BLK_M), true>;
+  using TileCopyB = TileCopy<ElementB, StrideB, int(BLK_N), false>;
+
+  using MainloopPipeline = cutlass::PipelineXe<Stages>;
+  using PipelineState = typename MainloopPipeline::PipelineState;
+
+  struct SharedStorage {
+    cute::array_aligned<ElementA, Stages * TileCopyA::SmemElements> smem_A;
+    cute::array_aligned<ElementB, Stages * TileCopyB::SmemElements> smem_B;
+  };
+ 
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A;
+    StrideA dA;
+    ElementB const* ptr_B;
+    StrideB dB;
+  };
+
+  struct Params {
+    TensorMKL mA;
+    TensorNKL mB;
+  };
+
+  //
+  // Methods
+  //
+
+  CollectiveMma() = default;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+
+    auto mA_mkl = make_tensor(make_gmem_ptr(static_cast<ElementA const*>(args.ptr_A)),
+                              make_layout(make_shape(M, K, L), args.dA));
+
+    auto mB_nkl = make_tensor(make_gmem_ptr(static_cast<ElementB const*>(args.ptr_B)),
+                              make_layout(make_shape(N, K, L), args.dB));
+
+    return Params{mA_mkl, mB_nkl};
+  }
+
+  /// Replaces the A and B pointers of params built by to_underlying_arguments(), keeping their layouts
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B) {
+    params.mA = make_tensor(make_gmem_ptr(ptr_A), params.mA.layout());
+    params.mB = make_tensor(make_gmem_ptr(ptr_B), params.mB.layout());
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same shape and strides
+  static void
+  update_params(Params& params, Arguments const& args) {
+    update_pointers(params, args.ptr_A, args.ptr_B);
+  }
+
+  /// Perform a work-group-scoped matrix multiply-accumulate. All the work-items of the work-group
+  /// must call it with the same k_tile_count since it synchronizes them.
+  template <
+    int PrefetchStrideA,
+    int PrefetchStrideB,
+    class FrgTensorD,
+    class TensorA,
+    class TensorB,
+    class FrgTensorC,
+    class KTileIterator,
+    class ResidueMNK,
+    class BlkCoord
+  >
+  CUTLASS_DEVICE void
+  operator() (
+      FrgTensorD &accum,
+      TensorA gA,
+      TensorB gB,
+      FrgTensorC const &src_accum,
+      KTileIterator k_tile_iter, int k_tile_count,
+      ResidueMNK residue_mnk,
+      BlkCoord const &blk_coord,
+      int const &K_start,
+      int thread_idx,
+      char *smem_buf,
+      Params const& mainloop) 
+  {
+    static_assert(is_rmem<FrgTensorD>::value, "D tensor must be rmem resident.");
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    (void)gA;
+    (void)gB;
+    (void)residue_mnk;
+
+    SharedStorage& storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    ElementA* smem_A = storage.smem_A.data();
+    ElementB* smem_B = storage.smem_B.data();
+
+    TiledMma tiled_mma;
+
+    // Register fragments of one k-tile, in the value order of the MMA atom: A(v, m, k) is row v
+    // and column `lane` of the atom, B(v, n, k) is row `lane` and column v
+    Tensor frag_A = make_tensor<ElementA>(Shape<Int<AtomM>, Int<MMA_M>, Int<MMA_K>>{});
+    Tensor frag_B = make_tensor<ElementB>(Shape<Int<AtomK>, Int<MMA_N>, Int<MMA_K>>{});
+
+    typename TileCopyA::Fragment staged_A;
+    typename TileCopyB::Fragment staged_B;
+
+    //
+    // Mainloop
+    //
+    auto [m_idx, n_idx, k_idx, l_idx] = blk_coord;
+  #ifdef CUTLASS_SYCL_SWITCH_WG
+    const int m_block = n_idx * BLK_M;
+    const int n_block = m_idx * BLK_N;
+  #else
+    const int m_block = m_idx * BLK_M;
+    const int n_block = n_idx * BLK_N;
+  #endif
+    const int l_coord = l_idx;
+    const int sg_m = get_sub_group_id() / ATOM_N;
+    const int sg_n = get_sub_group_id() % ATOM_N;
+    const int lane = get_sub_group_local_id();
+
+    const int k_start_idx = crd2idx((*k_tile_iter), make_shape(K_start));
+
+    const int M = get<0>(mainloop.mA.shape());
+    const int N = get<0>(mainloop.mB.shape());
+    const int64_t stride_am = get<0>(mainloop.mA.stride());
+    const int64_t stride_ak = get<1>(mainloop.mA.stride());
+    const int64_t stride_al = get<2>(mainloop.mA.stride());
+    const int64_t stride_bn = get<0>(mainloop.mB.stride());
+    const int64_t stride_bk = get<1>(mainloop.mB.stride());
+    const int64_t stride_bl = get<2>(mainloop.mB.stride());
+
+    ElementA const* ptr_A = raw_pointer_cast(mainloop.mA.data()) + int64_t(m_block) * stride_am + int64_t(l_coord) * stride_al;
+    ElementB const* ptr_B = raw_pointer_cast(mainloop.mB.data()) + int64_t(n_block) * stride_bn + int64_t(l_coord) * stride_bl;
+
+    auto load_k_tile = [&](int k_tile) {
+      int64_t const k_offset = int64_t(k_start_idx + k_tile) * BLK_K;
+      TileCopyA::load(staged_A, ptr_A + k_offset * stride_ak, stride_am, stride_ak, M - m_block, thread_idx);
+      TileCopyB::load(staged_B, ptr_B + k_offset * stride_bk, stride_bn, stride_bk, N - n_block, thread_idx);
+    };
+
+    auto store_k_tile = [&](int buffer) {
+      TileCopyA::store(staged_A, smem_A + buffer * TileCopyA::SmemElements, thread_idx);
+      TileCopyB::store(staged_B, smem_B + buffer * TileCopyB::SmemElements, thread_idx);
+    };
+
+    MainloopPipeline pipeline;
+    PipelineState smem_pipe_write;
+    PipelineState smem_pipe_read;
+
+    // Fill the first Stages - 1 buffers
+    CUTLASS_PRAGMA_UNROLL
+    for (int k_tile = 0; k_tile < Stages - 1; ++k_tile) {
+      if (k_tile < k_tile_count) {
+        load_k_tile(k_tile);
+        pipeline.producer_acquire(smem_pipe_write);
+        store_k_tile(smem_pipe_write.index());
+        pipeline.producer_commit(smem_pipe_write);
+        ++smem_pipe_write;
+      }
+    }
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int k_tile = 0; k_tile < k_tile_count; ++k_tile) {
+      // The global loads of a later k-tile are in flight while the fragments are read
+      int const k_tile_load = k_tile + Stages - 1;
+      if (k_tile_load < k_tile_count) {
+        load_k_tile(k_tile_load);
+      }
+
+      pipeline.consumer_wait(smem_pipe_read);
+
+      ElementA const* sA = smem_A + smem_pipe_read.index() * TileCopyA::SmemElements + (sg_m * SG_M) * BLK_K + lane;
+      ElementB const* sB = smem_B + smem_pipe_read.index() * TileCopyB::SmemElements + sg_n * SG_N + lane;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int k = 0; k < MMA_K; ++k) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int m = 0; m < MMA_M; ++m) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int v = 0; v < AtomM; ++v) {
+            frag_A(v, m, k) = sA[(m * AtomM + v) * BLK_K + k * AtomK];
+          }
+        }
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < MMA_N; ++n) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int v = 0; v < AtomK; ++v) {
+            frag_B(v, n, k) = sB[(k * AtomK + v) * BLK_N + n * AtomN];
+          }
+        }
+      }
+
+      pipeline.consumer_release(smem_pipe_read);
+      ++smem_pipe_read;
+
+      if (k_tile_load < k_tile_count) {
+        pipeline.producer_acquire(smem_pipe_write);
+        store_k_tile(smem_pipe_write.index());
+        pipeline.producer_commit(smem_pipe_write);
+        ++smem_pipe_write;
+      }
+
+      // The MMAs overlap the barrier phase started by the commit above
+      cute::gemm(tiled_mma, frag_A, frag_B, accum);
+    }
+
+    // The next tile reuses the buffers
+    pipeline.producer_tail(smem_pipe_write);
+  }
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,10 +63,59 @@
 #include "cutlass/util/sycl_event_manager.hpp"
 #endif
 
+#include <cstring>
+#include <map>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::device {
 
+namespace detail {
+
+// Detects kernels exposing static update_pointers() and update_params() whose collectives can
+// refresh their own params. The check is made on the collectives, as kernels such as the Xe
+// GemmUniversal declare the hooks for every collective, including ptr-array ones that take
+// arrays of pointers and do not implement them.
+template <class GemmKernel, class = void>
+struct SupportsPointerUpdate : cute::false_type {};
+
+template <class GemmKernel>
+struct SupportsPointerUpdate<GemmKernel, cute::void_t<
+    decltype(&GemmKernel::update_pointers),
+    decltype(&GemmKernel::update_params),
+    decltype(GemmKernel::CollectiveMainloop::update_params(
+      cute::declval<typename GemmKernel::CollectiveMainloop::Params&>(),
+      cute::declval<typename GemmKernel::CollectiveMainloop::Arguments const&>())),
+    decltype(GemmKernel::CollectiveEpilogue::update_pointers(
+      cute::declval<typename GemmKernel::CollectiveEpilogue::Params&>(),
+      cute::declval<typename GemmKernel::ElementC const*>(),
+      cute::declval<typename GemmKernel::ElementD*>())),
+    decltype(GemmKernel::CollectiveEpilogue::update_params(
+      cute::declval<typename GemmKernel::CollectiveEpilogue::Params&>(),
+      cute::declval<typename GemmKernel::ProblemShape const&>(),
+      cute::declval<typename GemmKernel::CollectiveEpilogue::Arguments const&>(),
+      cute::declval<void*>()))>>
+  : cute::true_type {};
+
+#if defined(CUTLASS_ENABLE_SYCL)
+// Detects kernels that can enqueue their workspace initialization on an explicit SYCL queue
+template <class GemmKernel, class = void>
+struct SupportsQueueWorkspaceInit : cute::false_type {};
+
+template <class GemmKernel>
+struct SupportsQueueWorkspaceInit<GemmKernel, cute::void_t<
+    decltype(GemmKernel::initialize_workspace(
+      cute::declval<typename GemmKernel::Arguments const&>(),
+      cute::declval<void*>(),
+      cute::declval<sycl::queue&>(),
+      cute::declval<std::vector<sycl::event> const&>(),
+      cute::declval<sycl::event&>()))>>
+  : cute::true_type {};
+#endif
+
+} // namespace detail
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /*!
@@ -185,11 +234,25 @@ public:
   /// Argument structure: Kernel API
   using Params = typename GemmKernel::Params;
 
+  /// True if the kernel can retarget a lowered Params to new operand pointers without
+  /// re-running to_underlying_arguments()
+  static constexpr bool kSupportsPointerUpdate = detail::SupportsPointerUpdate<GemmKernel>::value;
+
 private:
 
   /// Kernel API parameters object
   Params params_;
 
+  /// Params lowered by initialize_cached(), keyed by problem shape, strides, scheduler arguments
+  /// and workspace
+  std::map<std::vector<int64_t>, Params> params_cache_;
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  /// Events of the workspace initialization enqueued by initialize() on a SYCL queue. The next
+  /// queue-based launch depends on them.
+  std::vector<sycl::event> workspace_events_;
+#endif
+
 public:
 
   /// Access the Params structure
@@ -341,6 +404,75 @@ public:
     return Status::kSuccess;
   }
 
+  /// Lightweight update: retargets the current Params to new operand pointers. The problem shape,
+  /// strides and scalars of the last initialize() are kept, and no workspace is touched.
+  Status
+  update(ElementA const* ptr_A, ElementB const* ptr_B, ElementC const* ptr_C, ElementD* ptr_D) {
+    CUTLASS_TRACE_HOST("GemmUniversal()::update() - pointers only");
+    if constexpr (kSupportsPointerUpdate) {
+      GemmKernel::update_pointers(params_, ptr_A, ptr_B, ptr_C, ptr_D);
+      return Status::kSuccess;
+    }
+    else {
+      return Status::kErrorNotSupported;
+    }
+  }
+
+  /// Initializes GEMM state from arguments, reusing the Params lowered for an earlier call with the
+  /// same problem shape, strides, scheduler arguments and workspace. On a hit the copies and the
+  /// tile scheduler params are kept: only the operand pointers, the mainloop scalars and the fusion
+  /// arguments of the epilogue are refreshed from args. The workspace is initialized on every call
+  /// as it may hold per-launch state. Kernels whose collectives cannot refresh their params fall
+  /// back to initialize().
+  Status
+  initialize_cached(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    if constexpr (kSupportsPointerUpdate) {
+      std::vector<int64_t> key;
+      append_key(key, args.problem_shape);
+      append_key(key, args.mainloop.dA);
+      append_key(key, args.mainloop.dB);
+      append_key(key, args.epilogue.dC);
+      append_key(key, args.epilogue.dD);
+      append_bytes_key(key, args.scheduler);
+      key.push_back(static_cast<int64_t>(args.mode));
+      key.push_back(static_cast<int64_t>(reinterpret_cast<uintptr_t>(workspace)));
+      key.push_back(args.hw_info.device_id);
+      key.push_back(args.hw_info.sm_count);
+
+      auto it = params_cache_.find(key);
+      if (it == params_cache_.end()) {
+        Status status = initialize(args, workspace, stream, cuda_adapter);
+        if (status == Status::kSuccess) {
+          params_cache_.emplace(std::move(key), params_);
+        }
+        return status;
+      }
+
+      CUTLASS_TRACE_HOST("GemmUniversal::initialize_cached() - hit");
+      Status status = GemmKernel::initialize_workspace(args, workspace, stream, cuda_adapter);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      params_ = it->second;
+      GemmKernel::update_params(params_, args, workspace);
+      return Status::kSuccess;
+    }
+    else {
+      return initialize(args, workspace, stream, cuda_adapter);
+    }
+  }
+
+  /// Drops all Params memoized by initialize_cached()
+  void
+  clear_params_cache() {
+    params_cache_.clear();
+  }
+
   /// Primary run() entry point API that is static allowing users to create and manage their own params.
   /// Supplied params struct must be construct by calling GemmKernel::to_underling_arguments()
   static Status
@@ -551,6 +683,133 @@ public:
   operator()(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr, bool launch_with_pdl = false) {
     return run(params_, stream, cuda_adapter, launch_with_pdl);
   }
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  //
+  // SYCL queue overloads. Work is submitted to an explicit queue, ordered only after the given
+  // dependencies, and the launch returns its event. Unlike the overloads above this needs no
+  // device-wide wait, so GEMMs can be pipelined with other work on out-of-order queues.
+  //
+
+  /// Initializes GEMM state from arguments. Workspace initialization is enqueued on \p queue after
+  /// \p dependencies, and the next launch through run(queue, ...) is ordered after it.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace,
+    sycl::queue& queue,
+    std::vector<sycl::event> const& dependencies = {}) {
+
+    CUTLASS_TRACE_HOST("GemmUniversal::initialize() - workspace " << workspace << ", queue");
+
+    sycl::event event;
+    Status status = Status::kSuccess;
+    if constexpr (detail::SupportsQueueWorkspaceInit<GemmKernel>::value) {
+      status = GemmKernel::initialize_workspace(args, workspace, queue, dependencies, event);
+    }
+    else {
+      // The kernel initializes its workspace on the in-order default queue. Order that after
+      // dependencies, and take the event of a barrier enqueued behind it.
+      sycl::queue& default_queue = syclcompat::get_default_queue();
+      default_queue.ext_oneapi_submit_barrier(dependencies);
+      status = GemmKernel::initialize_workspace(args, workspace);
+      event = default_queue.ext_oneapi_submit_barrier();
+    }
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    workspace_events_ = {event};
+    params_ = GemmKernel::to_underlying_arguments(args, workspace);
+    return Status::kSuccess;
+  }
+
+  /// Launches the kernel on \p queue once \p dependencies have completed and returns its event.
+  /// Supplied params struct must be construct by calling GemmKernel::to_underling_arguments()
+  static sycl::event
+  run(Params const& params, sycl::queue& queue, std::vector<sycl::event> const& dependencies = {}) {
+    CUTLASS_TRACE_HOST("GemmUniversal::run() - queue");
+    dim3 const block = GemmKernel::get_block_shape();
+    dim3 const grid = get_grid_shape(params);
+    std::size_t const smem_size = GemmKernel::SharedStorageSize;
+
+    // dim3 is ordered x, y, z while the last dimension of a SYCL range varies fastest
+    sycl::range<3> const local(block.z, block.y, block.x);
+    sycl::range<3> const global(grid.z * block.z, grid.y * block.y, grid.x * block.x);
+
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      sycl::local_accessor<char, 1> smem(sycl::range<1>(smem_size), cgh);
+#if defined (SYCL_INTEL_TARGET)
+      if constexpr (!cute::is_same_v<DispatchPolicy, MainloopDeviceAgnostic>) {
+        cgh.parallel_for(sycl::nd_range<3>(global, local),
+          [=](sycl::nd_item<3>) [[sycl::reqd_sub_group_size(DispatchPolicy::SubgroupSize)]] {
+            device_kernel<GemmKernel>(params, smem.template get_multi_ptr<sycl::access::decorated::legacy>());
+          });
+      }
+      else
+#endif
+      {
+        cgh.parallel_for(sycl::nd_range<3>(global, local), [=](sycl::nd_item<3>) {
+          device_kernel<GemmKernel>(params, smem.template get_multi_ptr<sycl::access::decorated::legacy>());
+        });
+      }
+    });
+  }
+
+  /// Re-launches the kernel on \p queue with the internal params struct, after \p dependencies and
+  /// any workspace initialization enqueued by initialize(). Returns the event of the kernel.
+  sycl::event
+  run(sycl::queue& queue, std::vector<sycl::event> const& dependencies = {}) {
+    std::vector<sycl::event> events(dependencies);
+    events.insert(events.end(), workspace_events_.begin(), workspace_events_.end());
+    workspace_events_.clear();
+    return run(params_, queue, events);
+  }
+
+  /// Initializes the internal params struct from arguments and launches the kernel on \p queue.
+  /// The event of the kernel is written to \p event.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace,
+    sycl::queue& queue,
+    std::vector<sycl::event> const& dependencies,
+    sycl::event& event) {
+
+    Status status = initialize(args, workspace, queue, dependencies);
+    if (Status::kSuccess == status) {
+      event = run(queue);
+    }
+    return status;
+  }
+#endif
+
+private:
+
+  /// Appends the flattened modes of a shape or stride to a Params cache key
+  template <class IntTuple>
+  static void
+  append_key(std::vector<int64_t>& key, IntTuple const& t) {
+    if constexpr (cute::is_tuple<IntTuple>::value) {
+      cute::for_each(cute::flatten(t), [&](auto v) { key.push_back(static_cast<int64_t>(v)); });
+    }
+    else {
+      key.push_back(static_cast<int64_t>(t));
+    }
+  }
+
+  /// Appends the object representation of a plain argument struct to a Params cache key. Arguments
+  /// that only differ in their padding miss the cache, which is safe.
+  template <class T>
+  static void
+  append_bytes_key(std::vector<int64_t>& key, T const& value) {
+    unsigned char const* bytes = reinterpret_cast<unsigned char const*>(&value);
+    for (size_t i = 0; i < sizeof(T); i += sizeof(int64_t)) {
+      int64_t word = 0;
+      std::memcpy(&word, bytes + i, cute::min(sizeof(int64_t), sizeof(T) - i));
+      key.push_back(word);
+    }
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
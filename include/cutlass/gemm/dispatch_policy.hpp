@@ -113,6 +113,7 @@ struct KernelPtrArrayTmaWarpSpecializedCooperative { };
 struct KernelPtrArrayTmaWarpSpecializedPingpong { };
 
 struct KernelPVC { };
+struct KernelPVCDualGemm { };
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -339,6 +340,62 @@ struct MainloopIntelPVCMixedPrecision {
   using Schedule = KernelPVC;
   using ClusterShape = Shape<_1,_1,_1>;
 };
+
+// KSlices_ copies of the sub-group grid of the TiledMma split the k-tiles of every output tile and
+// reduce their accumulators through shared local memory before the epilogue
+template<int Stages_, int KSlices_>
+struct MainloopIntelPVCSlicedK {
+  constexpr static int Stages = Stages_;
+  constexpr static int KSlices = KSlices_;
+  constexpr static int SubgroupSize = 16;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelPVC;
+  using ClusterShape = Shape<_1,_1,_1>;
+};
+
+// The work-group stages the A and B k-tiles in shared local memory through a ring of Stages_
+// buffers and every sub-group reads its MMA fragments from there
+template<int Stages_>
+struct MainloopIntelPVCSharedLocalMemory {
+  constexpr static int Stages = Stages_;
+  constexpr static int SubgroupSize = 16;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelPVC;
+  using ClusterShape = Shape<_1,_1,_1>;
+};
+
+// A and B of every batch are read from device arrays of pointers, all batches share M, N and K
+template<int Stages_>
+struct MainloopIntelPVCPtrArray {
+  constexpr static int Stages = Stages_;
+  constexpr static int SubgroupSize = 16;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelPVC;
+  using ClusterShape = Shape<_1,_1,_1>;
+};
+
+// Two GEMMs sharing A: every A tile is loaded once and multiplied with the tiles of B0 and B1
+template<int Stages_>
+struct MainloopIntelPVCDualGemm {
+  constexpr static int Stages = Stages_;
+  constexpr static int SubgroupSize = 16;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelPVCDualGemm;
+  using ClusterShape = Shape<_1,_1,_1>;
+};
+
+// FP8 inputs are upconverted in registers to the element type of the MMA atom.
+// ScaleBlockShape_ is the (M, N, K) extent covered by one scale factor of A/B,
+// void selects a single per-tensor scale factor for each operand.
+template<int Stages_, class ScaleBlockShape_ = void>
+struct MainloopIntelPVCFP8 {
+  constexpr static int Stages = Stages_;
+  constexpr static int SubgroupSize = 16;
+  using ArchTag = arch::IntelPVC;
+  using Schedule = KernelPVC;
+  using ClusterShape = Shape<_1,_1,_1>;
+  using ScaleBlockShape = ScaleBlockShape_;
+};
 #endif
 
 #if defined(CUTLASS_ENABLE_SYCL)
@@ -41,6 +41,7 @@
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
 #if defined (SYCL_INTEL_TARGET)
+#include "cutlass/gemm/kernel/xe_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/xe_tile_scheduler_streamk.hpp"
 #endif
 ////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +132,19 @@ struct TileSchedulerSelector<
 };
 
 #if defined (SYCL_INTEL_TARGET)
+template <
+  class TileShape,
+  class ClusterShape
+>
+struct TileSchedulerSelector<
+  PersistentScheduler,
+  arch::IntelPVC,
+  TileShape,
+  ClusterShape
+  > {
+  using Scheduler = PersistentTileSchedulerXe<TileShape>;
+};
+
 template <
   class TileShape,
   class ClusterShape
@@ -34,6 +34,7 @@
 #include "cutlass/kernel_hardware_info.hpp"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
 
 #include "cute/tensor.hpp"
 
@@ -41,6 +42,55 @@ namespace cutlass::gemm::kernel {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+// Bytes of shared local memory used by a mainloop, zero unless it declares a SharedStorage
+template <class CollectiveMainloop, class = void>
+constexpr int XeMainloopSharedStorageSize = 0;
+
+template <class CollectiveMainloop>
+constexpr int XeMainloopSharedStorageSize<CollectiveMainloop, cute::void_t<typename CollectiveMainloop::SharedStorage>> =
+  static_cast<int>(sizeof(typename CollectiveMainloop::SharedStorage));
+
+// Number of copies of the sub-group grid of the TiledMma that split the k-tiles of a work-group,
+// one unless the mainloop declares KSlices
+template <class CollectiveMainloop, class = void>
+constexpr int XeMainloopKSlices = 1;
+
+template <class CollectiveMainloop>
+constexpr int XeMainloopKSlices<CollectiveMainloop, cute::void_t<decltype(CollectiveMainloop::KSlices)>> =
+  static_cast<int>(CollectiveMainloop::KSlices);
+
+// Whether the fusion callbacks of an epilogue place work-group barriers, false unless they
+// declare kRequiresWorkgroupBarrier
+template <class CollectiveEpilogue, class = void>
+constexpr bool XeEpilogueRequiresWorkgroupBarrier = false;
+
+template <class CollectiveEpilogue>
+constexpr bool XeEpilogueRequiresWorkgroupBarrier<CollectiveEpilogue,
+    cute::void_t<decltype(CollectiveEpilogue::FusionCallbacks::kRequiresWorkgroupBarrier)>> =
+  CollectiveEpilogue::FusionCallbacks::kRequiresWorkgroupBarrier;
+
+// Whether an epilogue computes D = alpha * acc + beta * C without any fused operation
+template <class ThreadEpilogueOp>
+constexpr bool XeIsLinearCombination = false;
+
+template <class ElementOutput, class ElementCompute, class ElementSource, class ElementScalar, FloatRoundStyle RoundStyle>
+constexpr bool XeIsLinearCombination<
+    epilogue::fusion::LinearCombination<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>> = true;
+
+template <class CollectiveEpilogue, class = void>
+constexpr bool XeEpilogueIsLinearCombination = false;
+
+template <class CollectiveEpilogue>
+constexpr bool XeEpilogueIsLinearCombination<CollectiveEpilogue,
+    cute::void_t<typename CollectiveEpilogue::ThreadEpilogueOp>> =
+  XeIsLinearCombination<typename CollectiveEpilogue::ThreadEpilogueOp>;
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
 template <
   class ProblemShape_,
   class CollectiveMainloop_,
@@ -86,6 +136,11 @@ public:
     TileScheduler_, ArchTag, WorkgroupTileShape,
     cute::Shape<cute::Int<1>, cute::Int<1>, cute::Int<1>>>::Scheduler;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
+  using TileSchedulerParams = typename TileScheduler::Params;
+
+  // With the PersistentScheduler tag a single wave of work-groups is launched, and each of them
+  // loops over output tiles. Otherwise one work-group is launched per output tile.
+  static constexpr bool IsPersistent = cute::is_same_v<TileScheduler_, PersistentScheduler>;
 
   // Epilogue derived types
   using CollectiveEpilogue = CollectiveEpilogue_;
@@ -98,11 +153,16 @@ public:
   static_assert(cute::is_same_v<ElementAccumulator, typename CollectiveEpilogue::ElementAccumulator>,
     "Mainloop and epilogue do not agree on accumulator value type.");
 
-  // MSVC requires the cast to fix a warning-as-error.
-  static constexpr int SharedStorageSize = 0;
+  // The epilogue does not use shared local memory, a mainloop that stages its tiles there
+  // synchronizes the work-group before returning so the buffer can be reused by the next tile
+  static constexpr int SharedStorageSize = detail::XeMainloopSharedStorageSize<CollectiveMainloop>;
 
   static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
   static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+  static constexpr int KSlices = detail::XeMainloopKSlices<CollectiveMainloop>;
+  // Only the first K slice of the work-group runs the epilogue
+  static_assert(KSlices == 1 || !detail::XeEpilogueRequiresWorkgroupBarrier<CollectiveEpilogue>,
+    "K-sliced mainloops cannot be combined with epilogues that synchronize the whole work-group.");
   using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;
   using SubgroupTileShape = typename CollectiveMainloop::SubgroupTileShape;
   using PrefetchATileSize = typename CollectiveMainloop::PrefetchATileSize;
@@ -140,6 +200,9 @@ public:
     TensorNK mB_nk;
     MainloopParams mainloop;
     EpilogueParams epilogue;
+    KernelHardwareInfo hw_info;
+    TileSchedulerArguments scheduler_args;
+    TileSchedulerParams scheduler;
   };
 
   //
@@ -158,16 +221,74 @@ public:
     Tensor mA_mk = mainloop_args.mA(_,_,l_coord);
     Tensor mB_nk = mainloop_args.mB(_,_,l_coord);
 
+    KernelHardwareInfo hw_info{args.hw_info.device_id, args.hw_info.sm_count};
+    TileSchedulerParams scheduler{};
+    if constexpr (IsPersistent) {
+      // Get SM count if needed, otherwise use user supplied SM count
+      if (hw_info.sm_count <= 0) {
+        CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+            "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+        hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+      }
+      CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting persistent grid SM count to " << hw_info.sm_count);
+
+      auto problem_shape_MNKL = append<4>(args.problem_shape, 1);
+      scheduler = TileScheduler::to_underlying_arguments(
+        problem_shape_MNKL, TileShape{}, hw_info, args.scheduler, workspace);
+    }
+
     return {
       args.mode,
       args.problem_shape,
       mA_mk,
       mB_nk,
       mainloop_args,
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace)
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
+      hw_info,
+      args.scheduler,
+      scheduler
     };
   }
 
+  /// Replaces the A, B, C and D pointers of params built by to_underlying_arguments(), skipping
+  /// the rest of the argument conversion. Shapes, strides and all other arguments are unchanged.
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B, ElementC const* ptr_C, ElementD* ptr_D) {
+    CollectiveMainloop::update_pointers(params.mainloop, ptr_A, ptr_B);
+    CollectiveEpilogue::update_pointers(params.epilogue, ptr_C, ptr_D);
+
+    auto l_coord = BlockIdxZ();
+    params.mA_mk = params.mainloop.mA(_,_,l_coord);
+    params.mB_nk = params.mainloop.mB(_,_,l_coord);
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same mode, problem
+  /// shape, strides and scheduler arguments. The copies and the tile scheduler params are reused:
+  /// only the operand pointers, the mainloop scalars and the epilogue fusion arguments are updated.
+  static void
+  update_params(Params& params, Arguments const& args, void* workspace) {
+    CollectiveMainloop::update_params(params.mainloop, args.mainloop);
+    CollectiveEpilogue::update_params(params.epilogue, args.problem_shape, args.epilogue, workspace);
+
+    auto l_coord = BlockIdxZ();
+    params.mA_mk = params.mainloop.mA(_,_,l_coord);
+    params.mB_nk = params.mainloop.mB(_,_,l_coord);
+  }
+
+  /// True if the epilogue stores the accumulators unchanged: a linear combination with alpha == 1,
+  /// beta == 0 and no scalar pointers
+  static bool
+  is_split_k_epilogue(EpilogueArguments const& epilogue) {
+    if constexpr (detail::XeEpilogueIsLinearCombination<CollectiveEpilogue>) {
+      using ElementScalar = decltype(epilogue.thread.alpha);
+      return epilogue.thread.alpha == ElementScalar(1) && epilogue.thread.beta == ElementScalar(0) &&
+             epilogue.thread.alpha_ptr == nullptr && epilogue.thread.beta_ptr == nullptr;
+    }
+    else {
+      return false;
+    }
+  }
+
   static bool
   can_implement(Arguments const& args) {
     auto m = get<0>(args.problem_shape);
@@ -181,6 +302,17 @@ public:
 
     bool mode_implementable = args.mode == GemmUniversalMode::kGemm ||
           (args.mode == GemmUniversalMode::kBatched && rank(ProblemShape{}) == 4);
+
+    // In split-K parallel mode the L extent is the number of K partitions and every partition
+    // needs at least one k-tile. The partitions write their raw accumulators, the reduction
+    // applies alpha, beta and C.
+    if constexpr (rank(ProblemShape{}) == 4) {
+      if (args.mode == GemmUniversalMode::kGemmSplitKParallel) {
+        auto splits = get<3>(args.problem_shape);
+        mode_implementable = splits > 0 && k / get<2>(TileShape{}) >= splits &&
+                             is_split_k_epilogue(args.epilogue);
+      }
+    }
     return shape_implementable && mode_implementable && TileScheduler::can_implement(args.scheduler);
   }
 
@@ -193,11 +325,17 @@ public:
   cutlass::Status
   initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, 
     CudaHostAdapter* cuda_adapter = nullptr) {
-    return Status::kSuccess;
+    // Output reductions of the epilogue (e.g. amax) are cleared before the launch
+    return CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace, stream, cuda_adapter);
   }
 
   static dim3
   get_grid_shape(Params const& params) {
+    if constexpr (IsPersistent) {
+      return TileScheduler::get_grid_shape(params.problem_shape, TileShape{}, params.hw_info,
+                                           params.scheduler_args, MaxThreadsPerBlock / SubgroupSize);
+    }
+
     int batch_count = 1;
     if constexpr (cute::rank(ProblemShape{}) == 4) {
       batch_count = cute::size<3>(params.problem_shape);
@@ -222,38 +360,62 @@ public:
   CUTLASS_DEVICE
   void
   operator()(Params const& params, char* smem_buf) {
-    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
     // Preconditions
     CUTE_STATIC_ASSERT(is_static<WorkgroupTileShape>::value);
 
+    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+
+    if constexpr (IsPersistent) {
+      TileScheduler scheduler{params.scheduler};
+      auto work_tile_info = scheduler.initial_work_tile_info();
+
+      while (work_tile_info.is_valid()) {
+        auto blk_coord_mnkl = make_coord(work_tile_info.M_idx, work_tile_info.N_idx, _, work_tile_info.L_idx);
+        compute_tile(params, blk_coord_mnkl, smem_buf);
+
+        // Get next work tile
+        work_tile_info = scheduler.fetch_next_work(work_tile_info);
+      }
+    }
+    else {
+      // Get the appropriate blocks for this sub_group -- potential for sub_group locality
+      #ifdef CUTLASS_SYCL_SWITCH_WG
+      auto m_coord = BlockIdxX();
+      auto n_coord = BlockIdxY();
+      #else
+      auto m_coord = BlockIdxY();
+      auto n_coord = BlockIdxX();
+      #endif
+      auto l_coord = BlockIdxZ();
+
+      auto blk_coord_mnkl = make_coord(m_coord, n_coord, _, l_coord);
+      compute_tile(params, blk_coord_mnkl, smem_buf);
+    }
+  }
+
+private:
+  // Computes the mainloop and epilogue for the output tile at blk_coord_mnkl
+  template <class BlkCoord>
+  CUTLASS_DEVICE
+  void
+  compute_tile(Params const& params, BlkCoord const& blk_coord_mnkl, char* smem_buf) {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
     // Separate out problem shape for convenience
     // Optionally append 1s until problem shape is rank-4 in case its is only rank-3 (MNK)
     auto problem_shape_MNKL = append<4>(params.problem_shape, Int<1>{});
     auto M = get<0>(problem_shape_MNKL);
     auto N = get<1>(problem_shape_MNKL);
     auto K = get<2>(problem_shape_MNKL);
-    auto L = get<3>(problem_shape_MNKL);
 
-    // Preconditions
-    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-
-    // Get the appropriate blocks for this sub_group -- potential for sub_group locality
     int thread_idx = int(ThreadIdxX());
     auto blk_shape = TileShape{};
-    #ifdef CUTLASS_SYCL_SWITCH_WG
-    auto m_coord = BlockIdxX();
-    auto n_coord = BlockIdxY();
-    #else
-    auto m_coord = BlockIdxY();
-    auto n_coord = BlockIdxX();
-    #endif
-    auto l_coord = BlockIdxZ();
+    auto m_coord = get<0>(blk_coord_mnkl);
+    auto n_coord = get<1>(blk_coord_mnkl);
 
-    auto blk_coord_mnkl = make_coord(m_coord, n_coord, _, l_coord);
-    int sub_group_id = thread_idx / SubgroupSize;
     constexpr auto workgroup_shape = WorkgroupTileShape{};                                                  // (SUB_M,SUB_N,SUB_K)
     constexpr auto subgroup_shape = SubgroupTileShape{};                   
 
@@ -272,9 +434,21 @@ public:
     Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape)); 
     clear(accumulators);
 
-    auto k_tile_iter  = cute::make_coord_iterator(idx2crd(0, make_shape(K)), make_shape(K));
+    int  k_tile_start = 0;
     int  k_tile_count = K / get<2>(workgroup_shape);
 
+    // In split-K parallel mode the L coordinate selects a contiguous range of k-tiles of the single
+    // batch, and the epilogue writes the partial accumulators to the L-th slice of D
+    auto mma_coord_mnkl = blk_coord_mnkl;
+    if (params.mode == GemmUniversalMode::kGemmSplitKParallel) {
+      int const splits = get<3>(problem_shape_MNKL);
+      int const k_tiles_per_split = (k_tile_count + splits - 1) / splits;
+      k_tile_start = int(get<3>(blk_coord_mnkl)) * k_tiles_per_split;
+      k_tile_count = cute::max(0, cute::min(k_tiles_per_split, k_tile_count - k_tile_start));
+      get<3>(mma_coord_mnkl) = 0;
+    }
+    auto k_tile_iter  = cute::make_coord_iterator(idx2crd(k_tile_start, make_shape(K)), make_shape(K));
+
     // Perform the collective scoped MMA
     CollectiveMainloop collective_mma;
     collective_mma.template operator()<PrefetchStrideA, PrefetchStrideB>(
@@ -284,13 +458,20 @@ public:
       accumulators,
       k_tile_iter, k_tile_count,
       residue_mnk,
-      blk_coord_mnkl,
+      mma_coord_mnkl,
       K,
       thread_idx,
       smem_buf,
       params.mainloop
     );
 
+    // With K slices the reduced accumulators are held by the first slice only
+    if constexpr (KSlices > 1) {
+      if (thread_idx >= int(MaxThreadsPerBlock / KSlices)) {
+        return;
+      }
+    }
+
     CollectiveEpilogue epilogue{params.epilogue, shared_storage.epilogue};
     epilogue(
       problem_shape_MNKL,
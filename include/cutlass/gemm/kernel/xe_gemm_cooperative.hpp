@@ -36,6 +36,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/xe_gemm.hpp"
 #include "cute/tensor.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -99,6 +100,9 @@ public:
 
   static constexpr int SubgroupSize = CollectiveMainloop::SubgroupSize; // sub_group size
   static constexpr uint32_t MaxThreadsPerBlock = CollectiveMainloop::MaxThreadsPerBlock;
+  static_assert(detail::XeMainloopKSlices<CollectiveMainloop> == 1,
+    "The stream-K fixup reduces across every work-item of the work-group, a mainloop with K slices "
+    "must use the data-parallel or persistent kernel.");
   using MmaAtomShape = typename CollectiveMainloop::MmaAtomShape;
   using SubgroupTileShape = typename CollectiveMainloop::SubgroupTileShape;
 
@@ -112,7 +116,9 @@ public:
     EpilogueTensorStorage epilogue;
   };
 
-  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+  // The mainloop and the epilogue use shared local memory one after the other
+  static constexpr int SharedStorageSize = cute::max(static_cast<int>(sizeof(SharedStorage)),
+                                                     detail::XeMainloopSharedStorageSize<CollectiveMainloop>);
 
   // Device side arguments
   struct Arguments {
@@ -178,6 +184,24 @@ public:
     };
   }
 
+  /// Replaces the A, B, C and D pointers of params built by to_underlying_arguments(), skipping
+  /// the rest of the argument conversion. Shapes, strides and all other arguments are unchanged.
+  static void
+  update_pointers(Params& params, ElementA const* ptr_A, ElementB const* ptr_B, ElementC const* ptr_C, ElementD* ptr_D) {
+    CollectiveMainloop::update_pointers(params.mainloop, ptr_A, ptr_B);
+    CollectiveEpilogue::update_pointers(params.epilogue, ptr_C, ptr_D);
+  }
+
+  /// Refreshes params built by to_underlying_arguments() from args with the same mode, problem
+  /// shape, strides, scheduler arguments and workspace. The copies and the tile scheduler params
+  /// are reused: only the operand pointers, the mainloop scalars and the epilogue fusion arguments
+  /// are updated.
+  static void
+  update_params(Params& params, Arguments const& args, void* workspace) {
+    CollectiveMainloop::update_params(params.mainloop, args.mainloop);
+    CollectiveEpilogue::update_params(params.epilogue, args.problem_shape, args.epilogue, workspace);
+  }
+
   static bool
   can_implement(Arguments const& args) {
     bool mode_implementable = args.mode == GemmUniversalMode::kGemm or
@@ -205,6 +229,17 @@ public:
     return status;
   }
 
+  /// Enqueues the workspace initialization on \p queue after \p dependencies and sets \p event to
+  /// the event that completes it
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace, sycl::queue& queue,
+    std::vector<sycl::event> const& dependencies, sycl::event& event) {
+    uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+
+    return TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
+      args.scheduler, workspace_ptr, args.problem_shape, args.hw_info, queue, dependencies, event);
+  }
+
   // Computes the kernel launch grid shape based on runtime parameters
   static dim3
   get_grid_shape(Params const& params) {
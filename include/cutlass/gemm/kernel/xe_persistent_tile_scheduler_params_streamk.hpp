@@ -594,7 +594,10 @@ struct PersistentTileSchedulerXeStreamKParams {
   }
 
   // Initialize the workspace to be used for the kernel. This variant of the method should only be used when
-  // problem_shape and tile_shape contain modes of only rank 1.
+  // problem_shape and tile_shape contain modes of only rank 1. Trailing stream_args select the
+  // zero_workspace() overload: none for the default queue, or a SYCL queue, its dependencies and
+  // the event to set.
+  template <class... StreamArgs>
   static cutlass::Status
   initialize_workspace(
     void* workspace,
@@ -604,7 +607,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    StreamArgs&&... stream_args) {
 
     dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape, tile_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -618,13 +622,15 @@ struct PersistentTileSchedulerXeStreamKParams {
       splits,
       decomposition_mode,
       barrier_bits,
-      element_accumulator_bits
+      element_accumulator_bits,
+      static_cast<StreamArgs&&>(stream_args)...
     );
   }
 
   // Version of initialize_workspace that takes in as input the number of work-groups in the M and N dimensions.
   // This is useful for calculating the tiled shape when a mode of problem and/or work-group shape has rank > 1,
   // for which using CuTe algebra for calculating tile shapes is easiest.
+  template <class... StreamArgs>
   static cutlass::Status
   initialize_workspace(
     void* workspace,
@@ -635,7 +641,8 @@ struct PersistentTileSchedulerXeStreamKParams {
     int splits,
     DecompositionMode decomposition_mode,
     uint32_t barrier_bits,
-    uint32_t element_accumulator_bits) {
+    uint32_t element_accumulator_bits,
+    StreamArgs&&... stream_args) {
 
       uint64_t barrier_workspace_size = 0;
       uint64_t reduction_workspace_size = 0;
@@ -653,6 +660,7 @@ struct PersistentTileSchedulerXeStreamKParams {
         element_accumulator_bits
       );
 
+      uint8_t* barrier_workspace = nullptr;
       if (barrier_workspace_size > 0) {
         if (workspace == nullptr) {
           return Status::kErrorWorkspaceNull;
@@ -660,11 +668,12 @@ struct PersistentTileSchedulerXeStreamKParams {
 
         // Only the barrier workspace needs to be cleared for stream-K.
         // Barrier workspace follows reduction workspace.
-        uint8_t* barrier_workspace = reinterpret_cast<uint8_t*>(workspace) + reduction_workspace_size;
-        return zero_workspace(static_cast<void*>(barrier_workspace), barrier_workspace_size);
+        barrier_workspace = reinterpret_cast<uint8_t*>(workspace) + reduction_workspace_size;
       }
 
-    return Status::kSuccess;
+    // Called even when there is nothing to clear, so that a queue-based caller still gets its event
+    return zero_workspace(static_cast<void*>(barrier_workspace), barrier_workspace_size,
+      static_cast<StreamArgs&&>(stream_args)...);
   }
 
   void
@@ -0,0 +1,340 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Persistent data-parallel tile scheduler for the Intel PVC GEMM kernels
+*/
+
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/platform/platform.h"
+#include "cutlass/workspace.h"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for the Xe persistent data-parallel scheduler
+struct PersistentTileSchedulerXeParams {
+
+  // Share the raster order enums with the SM90 scheduler so that host code can configure both
+  using RasterOrder = PersistentTileSchedulerSm90Params::RasterOrder;
+  using RasterOrderOptions = PersistentTileSchedulerSm90Params::RasterOrderOptions;
+
+  // The SYCL runtime reports the number of EUs as compute units. Work-groups are
+  // resident on an Xe-core, which groups 8 EUs.
+  static constexpr int EUsPerXeCore = 8;
+
+  // Hardware threads per EU when the kernel is compiled in large GRF mode (256 registers),
+  // which is required by the PVC mainloops to hold the accumulators.
+  static constexpr int HwThreadsPerEU = 4;
+
+  FastDivmodU64 divmod_batch_{};
+  FastDivmodU64 divmod_blk_major_{};
+
+  uint64_t blocks_per_problem_ = 0;
+  RasterOrder raster_order_ = RasterOrder::AlongN;
+
+  void
+  initialize(dim3 problem_blocks, RasterOrderOptions raster_order_option) {
+    auto problem_blocks_m = problem_blocks.x;
+    auto problem_blocks_n = problem_blocks.y;
+    auto problem_blocks_l = problem_blocks.z;
+
+    raster_order_ = get_rasterization_order(problem_blocks_m, problem_blocks_n, raster_order_option);
+
+    divmod_batch_ = FastDivmodU64(uint64_t(problem_blocks_m) * problem_blocks_n);
+    divmod_blk_major_ = FastDivmodU64(raster_order_ == RasterOrder::AlongN ? problem_blocks_n : problem_blocks_m);
+    blocks_per_problem_ = uint64_t(problem_blocks_m) * problem_blocks_n * problem_blocks_l;
+  }
+
+  // Get the number of work-group tiles in this problem.
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_tiled_wg_shape_mnl(BatchedGemmCoord problem_shape, GemmCoord wg_shape) {
+    auto wg_m = (problem_shape.m() + wg_shape.m() - 1) / wg_shape.m();
+    auto wg_n = (problem_shape.n() + wg_shape.n() - 1) / wg_shape.n();
+
+    return {
+      static_cast<uint32_t>(wg_m),
+      static_cast<uint32_t>(wg_n),
+      static_cast<uint32_t>(problem_shape.batch())
+    };
+  }
+
+  // Number of work-groups of `subgroups_per_wg` sub-groups that can be resident on one Xe-core
+  CUTLASS_HOST_DEVICE
+  static int
+  get_max_active_wgs_per_xe_core(int subgroups_per_wg) {
+    int hw_threads_per_xe_core = EUsPerXeCore * HwThreadsPerEU;
+    return platform::max(1, hw_threads_per_xe_core / platform::max(1, subgroups_per_wg));
+  }
+
+  // Computes the persistent grid: enough work-groups to fill the device once, but never
+  // more than there are output tiles.
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_grid_shape(
+    dim3 problem_blocks,
+    KernelHardwareInfo hw_info,
+    int max_active_wgs_per_xe_core) {
+
+    uint64_t xe_cores = platform::max(1, hw_info.sm_count / EUsPerXeCore);
+    uint64_t max_active_wgs = xe_cores * static_cast<uint64_t>(platform::max(1, max_active_wgs_per_xe_core));
+    uint64_t output_tiles = uint64_t(problem_blocks.x) * problem_blocks.y * problem_blocks.z;
+
+    return dim3{static_cast<uint32_t>(platform::min(max_active_wgs, output_tiles)), 1, 1};
+  }
+
+  // Rasterize along the shorter dimension so that work-groups resident at the same time
+  // share the panel of the longer one. With CUTLASS_SYCL_SWITCH_WG the heuristic instead
+  // follows the non-persistent kernels, which then launch work-groups along M.
+  CUTLASS_HOST_DEVICE
+  static RasterOrder
+  get_rasterization_order(
+    uint32_t tiles_m,
+    uint32_t tiles_n,
+    RasterOrderOptions raster_order_option) {
+
+    if (raster_order_option == RasterOrderOptions::Heuristic) {
+#ifdef CUTLASS_SYCL_SWITCH_WG
+      return RasterOrder::AlongM;
+#else
+      return tiles_n > tiles_m ? RasterOrder::AlongM : RasterOrder::AlongN;
+#endif
+    }
+    return raster_order_option == RasterOrderOptions::AlongN ? RasterOrder::AlongN : RasterOrder::AlongM;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Persistent work-group scheduler for data-parallel decomposition. A grid of roughly one wave of
+// work-groups is launched and every work-group strides over the linearized output tiles.
+template <
+  class TileShape
+>
+class PersistentTileSchedulerXe {
+  //
+  // Data members
+  //
+
+private:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+
+public:
+  using Params = PersistentTileSchedulerXeParams;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    bool is_valid_tile = false;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, false};
+    }
+  };
+
+  struct Arguments {
+    // Tile swizzling is not implemented for Xe; the field is kept so that arguments
+    // are interchangeable with the SM90 persistent scheduler.
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+
+    // Number of work-groups resident on each Xe-core. If this is not set, it is derived from
+    // the number of sub-groups in the work-group.
+    int max_active_wgs_per_xe_core = 0;
+  };
+
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(
+    ProblemShape problem_shape,
+    TileShape tile_shape,
+    [[maybe_unused]] KernelHardwareInfo const& hw_info,
+    Arguments const& args,
+    [[maybe_unused]] void* workspace = nullptr) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape_mnkl, tile_shape);
+
+    Params params;
+    params.initialize(problem_blocks, args.raster_order);
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    return args.max_active_wgs_per_xe_core >= 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerXe() { };
+
+  CUTLASS_DEVICE
+  PersistentTileSchedulerXe(Params const& params_) : scheduler_params(params_) {
+    current_work_linear_idx_ = uint64_t(BlockIdxX());
+    total_grid_size_ = uint64_t(GridDimX()) * uint64_t(GridDimY()) * uint64_t(GridDimZ());
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_, scheduler_params);
+  }
+
+  CUTLASS_DEVICE
+  static WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx, Params const& params) {
+    if (linear_idx >= params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    uint64_t work_idx_l, remainder;
+    params.divmod_batch_(work_idx_l, remainder, linear_idx);
+
+    // Consecutive linear indices walk along the raster dimension
+    uint64_t blk_outer, blk_inner;
+    params.divmod_blk_major_(blk_outer, blk_inner, remainder);
+
+    if (params.raster_order_ == RasterOrder::AlongN) {
+      return {static_cast<int32_t>(blk_outer), static_cast<int32_t>(blk_inner), static_cast<int32_t>(work_idx_l), true};
+    }
+    else {
+      return {static_cast<int32_t>(blk_inner), static_cast<int32_t>(blk_outer), static_cast<int32_t>(work_idx_l), true};
+    }
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  WorkTileInfo
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return get_current_work();
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info() {
+    return get_current_work();
+  }
+
+  // Given the inputs, computes the total number of output work-groups this problem will compute over.
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_wg_shape_mnl(ProblemShape problem_shape_mnkl, TileShape wg_shape) {
+    return Params::get_tiled_wg_shape_mnl(to_gemm_coord(problem_shape_mnkl), to_gemm_coord(wg_shape));
+  }
+
+  // Computes the physical grid we should launch.
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+    ProblemShape problem_shape,
+    TileShape tile_shape,
+    KernelHardwareInfo hw_info,
+    Arguments const& args,
+    int subgroups_per_wg) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_wg_shape_mnl(problem_shape_mnkl, tile_shape);
+
+    int max_active_wgs_per_xe_core = args.max_active_wgs_per_xe_core > 0
+      ? args.max_active_wgs_per_xe_core
+      : Params::get_max_active_wgs_per_xe_core(subgroups_per_wg);
+
+    return Params::get_grid_shape(problem_blocks, hw_info, max_active_wgs_per_xe_core);
+  }
+
+  // The data-parallel scheduler does not split the K loop
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const&, ProblemShape problem_shape, TileShape tile_shape) {
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    return 0;
+  }
+
+  // The data-parallel scheduler does not require any additional workspace
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator, class... StreamArgs>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, ProblemShape, KernelHardwareInfo const&, StreamArgs&&... stream_args) {
+    return zero_workspace(nullptr, 0, static_cast<StreamArgs&&>(stream_args)...);
+  }
+};
+
+} // namespace cutlass::gemm::kernel::detail
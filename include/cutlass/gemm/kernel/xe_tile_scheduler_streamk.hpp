@@ -442,13 +442,14 @@ template <int ThreadsPerBlock, class FrgTensorC>
     );
   }
 
-  template <class ProblemShape, class ElementAccumulator>
+  template <class ProblemShape, class ElementAccumulator, class... StreamArgs>
   static cutlass::Status
   initialize_workspace(
     Arguments const& args,
     void* workspace,
     ProblemShape const& problem_shape,
-    KernelHardwareInfo const& hw_info) {
+    KernelHardwareInfo const& hw_info,
+    StreamArgs&&... stream_args) {
 
     auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
 
@@ -466,7 +467,8 @@ template <int ThreadsPerBlock, class FrgTensorC>
       args.splits,
       args.decomposition_mode,
       sizeof_bits<BarrierType>::value,
-      sizeof_bits<ElementAccumulator>::value
+      sizeof_bits<ElementAccumulator>::value,
+      static_cast<StreamArgs&&>(stream_args)...
     );
   }
 
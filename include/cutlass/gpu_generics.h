@@ -343,6 +343,22 @@ CUTLASS_DEVICE T atomicAdd(T *address, T val) {
   return 0;
 }
 
+template <typename T>
+CUTLASS_DEVICE T atomicMax(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return syclcompat::atomic_fetch_max<sycl::access::address_space::global_space>(address, val);
+#endif
+  return 0;
+}
+
+template <typename T>
+CUTLASS_DEVICE T atomicMin(T *address, T val) {
+#if defined(__SYCL_DEVICE_ONLY__)
+  return syclcompat::atomic_fetch_min<sycl::access::address_space::global_space>(address, val);
+#endif
+  return 0;
+}
+
 CUTLASS_DEVICE int atomicCAS(int *address, int compare, int val) {
   int result = 0;
 #if defined(__SYCL_DEVICE_ONLY__)
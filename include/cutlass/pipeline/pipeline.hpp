@@ -33,4 +33,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "cutlass/pipeline/sm90_pipeline.hpp"
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/pipeline/xe_pipeline.hpp"
+#endif
 ////////////////////////////////////////////////////////////////////////////////////////////////////
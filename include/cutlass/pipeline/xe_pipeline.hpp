@@ -0,0 +1,184 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Producer/consumer pipeline over shared local memory stages for Intel Xe, built on the
+    split work-group barrier.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/pipeline/sm90_pipeline.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Xe shared local memory pipeline class
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Xe has a single hardware barrier per work-group, so unlike the SM90 pipelines there is no
+// barrier per stage, and every work-item of the work-group is both a producer and a consumer. All
+// of them must call the pipeline methods in the same order, with producer and consumer states
+// starting from PipelineState{} and advanced with ++ after each stage.
+//
+// The pipeline keeps at most one phase of the split barrier in flight. producer_commit() arrives on
+// it as soon as the stage is written, and consumer_wait() / producer_acquire() only wait when the
+// stage they need is not yet covered by a completed phase. Work placed between the commit of a
+// stage and the next wait, typically the MMAs of the stage just read, overlaps the barrier. A
+// consumer_release() is recorded and covered by the next arrival, it never synchronizes by itself.
+//
+// A canonical mainloop with Stages buffers issues one barrier per stage:
+//
+//   for k: consumer_wait(read); load fragments from read.index(); consumer_release(read); ++read;
+//          producer_acquire(write); store stage k + Stages - 1 to write.index(); producer_commit(write); ++write;
+//          MMAs on the fragments
+//
+// producer_tail() must be called before the stage buffers are reused for anything else, or before
+// any other work-group barrier.
+//
+// SYCL targets without the split barrier arrive as a no-op and complete every wait with a full
+// work-group barrier, which orders the same accesses without the overlap.
+template <int Stages_>
+class PipelineXe {
+public:
+  static constexpr uint32_t Stages = Stages_;
+  static_assert(Stages_ >= 2, "PipelineXe requires at least two stages.");
+  using PipelineState = cutlass::PipelineState<Stages>;
+
+  // The barrier is a hardware resource, nothing is kept in shared local memory
+  struct SharedStorage { };
+
+  CUTLASS_DEVICE
+  PipelineXe() = default;
+
+  ////////////////////
+  // Producer APIs
+  ////////////////////
+  // Wait until every work-item released the stage that state will overwrite
+  CUTLASS_DEVICE
+  void producer_acquire(PipelineState state) {
+    uint32_t const releases = state.count() >= Stages ? state.count() - Stages + 1 : 0;
+    sync(0, releases);
+  }
+
+  // Signal that the stage of state has been written
+  CUTLASS_DEVICE
+  void producer_commit(PipelineState state) {
+    (void) state;
+    ++commits_;
+    if (!arrived_) {
+      arrive();
+    }
+  }
+
+  // Wait until every stage committed has been consumed and released by all the work-items
+  CUTLASS_DEVICE
+  void producer_tail(PipelineState state) {
+    (void) state;
+    if (arrived_) {
+      wait();
+    }
+    sync(commits_, releases_);
+  }
+
+  ////////////////////
+  // Consumer APIs
+  ////////////////////
+  // Wait until the stage of state has been committed by every work-item
+  CUTLASS_DEVICE
+  void consumer_wait(PipelineState state) {
+    sync(state.count() + 1, 0);
+  }
+
+  // Signal that the stage of state will not be read anymore
+  CUTLASS_DEVICE
+  void consumer_release(PipelineState state) {
+    (void) state;
+    ++releases_;
+  }
+
+private:
+  // Number of commits and releases made by this work-item, covered by the phase in flight, and
+  // covered by a completed phase
+  uint32_t commits_ = 0;
+  uint32_t releases_ = 0;
+  uint32_t arrived_commits_ = 0;
+  uint32_t arrived_releases_ = 0;
+  uint32_t synced_commits_ = 0;
+  uint32_t synced_releases_ = 0;
+  bool arrived_ = false;
+
+  CUTLASS_DEVICE
+  void arrive() {
+#if defined(SYCL_INTEL_TARGET)
+    cutlass::arch::xe_barrier_arrive();
+#endif
+    arrived_commits_ = commits_;
+    arrived_releases_ = releases_;
+    arrived_ = true;
+  }
+
+  CUTLASS_DEVICE
+  void wait() {
+#if defined(SYCL_INTEL_TARGET)
+    cutlass::arch::xe_barrier_wait();
+#else
+    syncthreads();
+#endif
+    synced_commits_ = arrived_commits_;
+    synced_releases_ = arrived_releases_;
+    arrived_ = false;
+  }
+
+  // Completes phases until the first `commits` commits and `releases` releases are covered
+  CUTLASS_DEVICE
+  void sync(uint32_t commits, uint32_t releases) {
+    if (synced_commits_ >= commits && synced_releases_ >= releases) {
+      return;
+    }
+    if (arrived_) {
+      wait();
+      if (synced_commits_ >= commits && synced_releases_ >= releases) {
+        return;
+      }
+    }
+    arrive();
+    wait();
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}  // end namespace cutlass
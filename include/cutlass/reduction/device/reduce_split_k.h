@@ -194,8 +194,15 @@ public:
         }
     }
     else {
+#if defined(CUTLASS_ENABLE_SYCL)
+      const auto sycl_block = syclcompat::dim3(block.x, block.y, block.z);
+      const auto sycl_grid = syclcompat::dim3(grid.x, grid.y, grid.z);
+
+      syclcompat::launch<cutlass::Kernel<ReductionKernel>>(sycl_grid, sycl_block, 0, params_);
+#else
       cutlass::arch::synclog_setup();
       Kernel<ReductionKernel><<< grid, block, 0, stream >>>(params_);
+#endif
     }
 
     cudaError_t result = cudaGetLastError();
@@ -152,8 +152,8 @@ public:
 
     // Determine CTA position
     MatrixCoord thread_offset(
-      MatrixCoord::Index(int(blockIdx.x) * Shape::kRow + threadIdx.y),
-      MatrixCoord::Index(int(blockIdx.y) * Shape::kColumn + threadIdx.x * kElementsPerAccess)
+      MatrixCoord::Index(int(BlockIdxX()) * Shape::kRow + int(ThreadIdxY())),
+      MatrixCoord::Index(int(BlockIdxY()) * Shape::kColumn + int(ThreadIdxX()) * kElementsPerAccess)
     );
 
     // One guard conditional
@@ -0,0 +1,187 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Kernel performing a final calculation of RMSNorm
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reduction {
+namespace kernel {
+
+// Completes the row RMSNorm of a tensor whose per-tile sums of squares were written by the
+// LinCombResidualRmsNorm epilogue:
+//   out(m, n) = in(m, n) * rsqrt(sum_tiles(sumsq(m, tile)) / N + epsilon) * weight(n)
+// Launched like SoftmaxFinalize, with a block of (NumThreadsPerWarp, y) threads covering
+// NumThreadsPerWarp rows and a grid of (ceil(M / NumThreadsPerWarp), batch_count) blocks.
+template <
+  typename ElementInput_,
+  typename StrideInput_,
+  typename ElementPartial_,
+  typename StridePartial_,
+  typename ElementWeight_,
+  typename ElementOutput_,
+  typename StrideOutput_
+>
+class RmsNormFinalize {
+public:
+
+  using ElementInput = ElementInput_;
+  using StrideInput = StrideInput_;
+  using ElementPartial = ElementPartial_;
+  using StridePartial = StridePartial_;
+  using ElementWeight = ElementWeight_;
+  using ElementOutput = ElementOutput_;
+  using StrideOutput = StrideOutput_;
+
+  //
+  // Arguments
+  //
+
+  struct Arguments {
+    int                            M; // dimension M of input, output and partially reduced tensors
+    int                        dataN; // dimension N of the input and output
+    int                     partialN; // dimension N of the partially reduced tensors
+    int                  batch_count; // batch count
+    StrideInput               dInput; // stride of the input
+    StridePartial           dPartial; // stride of the partially reduced tensors
+    StrideOutput             dOutput; // stride of the output
+    ElementInput const*       ptr_in; // pointer to start of input data
+    ElementPartial const* ptr_partial_sumsq; // pointer to start of partial sums of squares
+    ElementWeight const*  ptr_weight; // pointer to the (N) weight, 1 if null
+    ElementOutput*           ptr_out; // pointer to start of output data
+    ElementPartial           epsilon; // added to the mean square before the reciprocal square root
+  };
+
+  struct SharedStorage {
+    cute::array_aligned<ElementPartial, MaxNumThreadsPerBlock> s_mem;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  //
+  // Params struct
+  //
+
+  struct Params {
+    Arguments args;
+
+    //
+    // Methods
+    //
+    Params() { }
+
+    Params(Arguments const &args_): args(args_) { }
+  };
+
+public:
+
+  CUTLASS_DEVICE
+  RmsNormFinalize() { }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, char* shared_storage) {
+    apply(params, shared_storage);
+  }
+
+private:
+
+  CUTLASS_DEVICE
+  void apply(Params const &params, char* shared_storage) {
+    using ConvertInput = cutlass::NumericConverter<ElementPartial, ElementInput>;
+    using ConvertWeight = cutlass::NumericConverter<ElementPartial, ElementWeight>;
+    using ConvertOutput = cutlass::NumericConverter<ElementOutput, ElementPartial>;
+    ConvertInput convert_input{};
+    ConvertWeight convert_weight{};
+    ConvertOutput convert_output{};
+
+    const int idx_x = ThreadIdxX();
+    const int m = idx_x + BlockDimX() * BlockIdxX();
+    const int idx_y = ThreadIdxY();
+    const int y_size = BlockDimY();
+    const int batch_id = BlockIdxY();
+
+    // Rows past M still take part in the barrier below
+    const bool is_row_valid = m < params.args.M;
+
+    // Represent the full tensors
+    auto IOTensorShape = make_shape(params.args.M, params.args.dataN, params.args.batch_count);
+    auto PartialTensorShape = make_shape(params.args.M, params.args.partialN, params.args.batch_count);
+    Tensor mPartialSumsq = make_tensor(make_gmem_ptr(params.args.ptr_partial_sumsq), PartialTensorShape, params.args.dPartial);
+    Tensor mOut = make_tensor(make_gmem_ptr(params.args.ptr_out), IOTensorShape, params.args.dOutput);
+    Tensor mIn = make_tensor(make_gmem_ptr(params.args.ptr_in), IOTensorShape, params.args.dInput);
+
+    //Represent the shared tensor
+    Tensor sPartial = make_tensor(make_smem_ptr(reinterpret_cast<ElementPartial*>(shared_storage)),
+                                  make_layout(make_shape(NumThreadsPerWarp, MaxNumThreadsPerBlock / NumThreadsPerWarp)));
+
+    ElementPartial sumsq = 0;
+    for (int partial_n = idx_y; is_row_valid && partial_n < params.args.partialN; partial_n += y_size){
+        sumsq += mPartialSumsq(m, partial_n, batch_id);
+    }
+    sPartial(idx_x, idx_y) = sumsq;
+    syncthreads();
+    // every thread of the row adds the partials in the same order, so they all scale identically
+    sumsq = 0;
+    for (int idx_y2 = 0; idx_y2 < y_size; idx_y2++){
+        sumsq += sPartial(idx_x, idx_y2);
+    }
+
+    if (!is_row_valid) {
+      return;
+    }
+
+    ElementPartial rstd = ElementPartial(1) /
+        cutlass::fast_sqrt(sumsq / ElementPartial(params.args.dataN) + params.args.epsilon);
+
+    for (int n = idx_y; n < params.args.dataN; n += y_size){
+      ElementPartial weight = params.args.ptr_weight == nullptr ? ElementPartial(1)
+                            : convert_weight(params.args.ptr_weight[n]);
+      mOut(m, n, batch_id) = convert_output(convert_input(mIn(m, n, batch_id)) * rstd * weight);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace reduction
+} // namespace cutlass
@@ -129,9 +129,8 @@ private:
     const int y_size = BlockDimY();
     const int batch_id = BlockIdxY();
 
-    if (m >= params.args.M) {
-      return;
-    }
+    // Rows past M still take part in the barriers below
+    const bool is_row_valid = m < params.args.M;
 
     // Represent the full tensors
     auto IOTensorShape = make_shape(params.args.M, params.args.dataN, params.args.batch_count);
@@ -146,7 +145,7 @@ private:
                                   make_layout(make_shape(NumThreadsPerWarp, MaxNumThreadsPerBlock / NumThreadsPerWarp)));
 
     ElementPartial max_val = std::numeric_limits<ElementPartial>::lowest();
-    for (int partial_n = idx_y; partial_n < params.args.partialN; partial_n += y_size){
+    for (int partial_n = idx_y; is_row_valid && partial_n < params.args.partialN; partial_n += y_size){
         ElementPartial partial_max = mPartialMax(m, partial_n, batch_id);
         max_val = cutlass::fast_max(max_val, partial_max);
     }
@@ -159,7 +158,7 @@ private:
     }
     
     ElementPartial sum_val = 0;
-    for (int partial_n = idx_y; partial_n < params.args.partialN; partial_n += y_size){
+    for (int partial_n = idx_y; is_row_valid && partial_n < params.args.partialN; partial_n += y_size){
         ElementPartial partial_max = mPartialMax(m, partial_n, batch_id);
         ElementPartial partial_sum = mPartialSum(m, partial_n, batch_id);
         sum_val += partial_sum * cutlass::fast_exp(partial_max - max_val);
@@ -174,15 +173,19 @@ private:
         sum_val += partial_sum;
     }
 
+    if (!is_row_valid) {
+      return;
+    }
+
     ElementPartial norm = 1 / sum_val;
 
-    for (int n = idx_y * 2; n < params.args.dataN; n += y_size * 2){
+    for (int n = idx_y * 2; n + 1 < params.args.dataN; n += y_size * 2){
       auto inVal = mIn(m, n, batch_id);
       auto inVal2 = mIn(m, n+1, batch_id);
       mOut(m, n, batch_id) = cutlass::fast_exp(inVal - max_val) * norm;
       mOut(m, n+1, batch_id) = cutlass::fast_exp(inVal2 - max_val) * norm;
     }
-    if (params.args.dataN % 2 == 1){
+    if (params.args.dataN % 2 == 1 && idx_y == 0){
       int n = params.args.dataN - 1;
       auto inVal = mIn(m, n, batch_id);
       mOut(m, n, batch_id) = cutlass::fast_exp(inVal - max_val) * norm;
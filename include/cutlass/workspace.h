@@ -44,6 +44,10 @@
 #include "cutlass.h"
 #include "cutlass/cuda_host_adapter.hpp"
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include <vector>
+#endif
+
 namespace cutlass {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,7 +107,9 @@ fill_workspace(void* workspace, T fill_value, size_t fill_count, cudaStream_t st
 
     CUTLASS_TRACE_HOST("  filling workspace");
 
-#if defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
+#if defined(CUTLASS_ENABLE_SYCL)
+    syclcompat::get_default_queue().fill(static_cast<T*>(workspace), fill_value, fill_count);
+#elif defined(CUTLASS_ENABLE_CUDA_HOST_ADAPTER) && CUTLASS_ENABLE_CUDA_HOST_ADAPTER
     //
     // Use the cuda host adapter
     //
@@ -147,6 +153,62 @@ fill_workspace(void* workspace, T fill_value, size_t fill_count, cudaStream_t st
 }
 #endif
 
+#if defined(CUTLASS_ENABLE_SYCL)
+//
+// SYCL builds have no stream handle, so the overloads above always enqueue on the default
+// syclcompat queue. The overloads below enqueue on an explicit queue after \p dependencies and set
+// \p event to the event of the command. When there is nothing to clear or fill, \p event is a
+// barrier on \p dependencies so that it can always be waited on or depended upon.
+//
+
+static Status
+zero_workspace(
+  void* workspace,
+  size_t workspace_size,
+  sycl::queue& queue,
+  std::vector<sycl::event> const& dependencies,
+  sycl::event& event) {
+
+  if (workspace_size == 0) {
+    event = queue.ext_oneapi_submit_barrier(dependencies);
+    return Status::kSuccess;
+  }
+  if (workspace == nullptr) {
+    CUTLASS_TRACE_HOST("  error: device workspace must not be null");
+    return Status::kErrorWorkspaceNull;
+  }
+
+  CUTLASS_TRACE_HOST("  clearing workspace");
+  event = queue.memset(workspace, 0, workspace_size, dependencies);
+  return Status::kSuccess;
+}
+
+template <typename T>
+Status
+fill_workspace(
+  void* workspace,
+  T fill_value,
+  size_t fill_count,
+  sycl::queue& queue,
+  std::vector<sycl::event> const& dependencies,
+  sycl::event& event) {
+
+  static_assert(sizeof(T) == 4 || sizeof(T) == 2 || sizeof(T) == 1, "Unsupported fill type");
+  if (fill_count == 0) {
+    event = queue.ext_oneapi_submit_barrier(dependencies);
+    return Status::kSuccess;
+  }
+  if (workspace == nullptr) {
+    CUTLASS_TRACE_HOST("  error: device workspace must not be null");
+    return Status::kErrorWorkspaceNull;
+  }
+
+  CUTLASS_TRACE_HOST("  filling workspace");
+  event = queue.fill(static_cast<T*>(workspace), fill_value, fill_count, dependencies);
+  return Status::kSuccess;
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass
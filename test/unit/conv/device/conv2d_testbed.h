@@ -50,6 +50,7 @@
 #include "cutlass/util/reference/host/tensor_compare.h"
 
 #include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/convolution_im2col.h"
 #include "cutlass/util/reference/device/convolution.h"
 
 #include "cutlass/core_io.h"
@@ -411,7 +412,7 @@ public:
     
 #else 
 
-    cutlass::reference::host::Conv2d<
+    cutlass::reference::host::Conv2dIm2col<
       ElementA,
       LayoutA,
       ElementB,
@@ -46,6 +46,7 @@
 #include "cutlass/util/reference/host/tensor_fill.h"
 
 #include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/convolution_im2col.h"
 
 #include "cutlass/util/reference/host/tensor_compare.h"
 
@@ -407,7 +408,7 @@ public:
     tensor_D_reference.sync_host();
     
 #else
-    cutlass::reference::host::Conv3d<
+    cutlass::reference::host::Conv3dIm2col<
       ElementA,
       LayoutA,
       ElementB,
@@ -38,6 +38,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <functional>
 #include <random>
 
 #include "../../common/cutlass_unit_test.h"
@@ -1772,6 +1773,28 @@ struct HostCollectiveEpilogue {
   }
 };
 
+/// Optional hooks for tests whose GEMM needs more arguments, a different launch or a different
+/// check than the testbed provides. Unset hooks keep the default behavior.
+template <typename Gemm>
+struct TestbedHooks {
+  using Arguments = typename Gemm::Arguments;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+  using ElementD = typename Gemm::GemmKernel::ElementD;
+  using LayoutTagD = cutlass::detail::StrideToLayoutTagC_t<typename Gemm::GemmKernel::StrideD>;
+  using TensorViewD = cutlass::TensorView<ElementD, LayoutTagD>;
+
+  /// Completes the arguments built by the testbed, e.g. with the outputs of a fusion
+  std::function<void(ProblemShapeType, Arguments&)> arguments;
+
+  /// Launches the GEMM in place of gemm_op.initialize() and gemm_op.run(), e.g. on another queue
+  /// or through initialize_cached(). D has to be complete once it returns.
+  std::function<cutlass::Status(Gemm&, Arguments const&, void*)> launch;
+
+  /// Checks D against the host reference GEMM in place of the equality check, e.g. after a
+  /// reduction of D that the reference does not model
+  std::function<bool(ProblemShapeType, TensorViewD reference_D, TensorViewD D)> verify;
+};
+
 template <
   typename Gemm,
   template <class T> class ActivationFunctor_ = cutlass::epilogue::thread::Identity,
@@ -1808,6 +1831,7 @@ struct TestbedImpl {
 
   HostCollectiveMainloopType collective_mma_inputs;
   CollectiveEpilogue collective_epilogue;
+  TestbedHooks<Gemm> hooks;
 
   //
   // Methods
@@ -1898,6 +1922,12 @@ struct TestbedImpl {
     
     cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
 
+    if (hooks.verify) {
+      collective_epilogue.tensor_D.sync_host();
+      return hooks.verify(problem_size, collective_epilogue.reference_D.host_view(),
+                          collective_epilogue.tensor_D.host_view());
+    }
+
     bool passed = compare_reference(problem_shape_MNKL, alpha, beta);
     return passed;
   }
@@ -2054,7 +2084,12 @@ struct TestbedImpl {
 
     typename Gemm::GemmKernel::TileScheduler::Arguments scheduler_args;
     if constexpr (cute::is_same_v<typename Gemm::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
+#if defined(SYCL_INTEL_TARGET)
+      // The Xe stream-K scheduler has neither raster order nor swizzle, and its own decomposition modes
+      scheduler_args = { static_cast<int>(splits) };
+#else
       scheduler_args = { static_cast<int>(splits), static_cast<int>(max_swizzle), raster_order, decomposition_mode };
+#endif
     }
     else {
       scheduler_args = { static_cast<int>(max_swizzle), raster_order };
@@ -2073,6 +2108,10 @@ struct TestbedImpl {
       scheduler_args
     };
 
+    if (hooks.arguments) {
+      hooks.arguments(problem_size, arguments);
+    }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("TestbedImpl::run: Creating gemm_op");
 #endif
@@ -2115,23 +2154,28 @@ struct TestbedImpl {
       return profile(problem_size, static_cast<int>(iterations), gemm_op, arguments, workspace);
     }
     else {
+      if (hooks.launch) {
+        status = hooks.launch(gemm_op, arguments, workspace.get());
+      }
+      else {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-      CUTLASS_TRACE_HOST("TestbedImpl::run: Calling gemm_op.initialize");
+        CUTLASS_TRACE_HOST("TestbedImpl::run: Calling gemm_op.initialize");
 #endif
-      status = gemm_op.initialize(arguments, workspace.get());
-      if (status != cutlass::Status::kSuccess) {
+        status = gemm_op.initialize(arguments, workspace.get());
+        if (status != cutlass::Status::kSuccess) {
 #if defined(CUTLASS_ENABLE_SYCL)
-      std::cerr << "This test is not supported." << "\n";
+        std::cerr << "This test is not supported." << "\n";
 #else
-        cudaError_t error = cudaGetLastError();
-        const auto error_str = cudaGetErrorString(error);
-        CUTLASS_TRACE_HOST("TestbedImpl::run: cudaGetLastError() is " << error_str);
+          cudaError_t error = cudaGetLastError();
+          const auto error_str = cudaGetErrorString(error);
+          CUTLASS_TRACE_HOST("TestbedImpl::run: cudaGetLastError() is " << error_str);
 #endif
-      }
+        }
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-      CUTLASS_TRACE_HOST("TestbedImpl::run: Calling gemm_op.run");
+        CUTLASS_TRACE_HOST("TestbedImpl::run: Calling gemm_op.run");
 #endif
-      status = gemm_op.run();
+        status = gemm_op.run();
+      }
 #if defined(CUTLASS_ENABLE_SYCL)
       try {
         syclcompat::wait_and_throw();
@@ -2458,16 +2502,44 @@ bool TestAll(double alpha = 1.0, double beta = 0.0, CheckEquality check_relative
   return passed;
 }
 
+/// Runs the Xe testbed over the given problem sizes. The hooks let a test complete the
+/// arguments, launch the GEMM itself or replace the check of D against the host reference.
 template <typename Gemm, template <class T> class ActivationFunctor =
-                             cutlass::epilogue::thread::Identity>
+                             cutlass::epilogue::thread::Identity,
+          bool force_legacy_epilogue = false>
 bool TestXe(
-    double alpha = 1.0, double beta = 0.0,
+    std::vector<typename Gemm::GemmKernel::ProblemShape> const& problem_sizes,
+    double alpha, double beta,
+    detail::TestbedHooks<Gemm> const& hooks = {},
     CheckEquality check_relative_equality = CheckEquality::RELATIVE) {
   using ElementScalar = typename Gemm::EpilogueOutputOp::ElementScalar;
-  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
 
-  Testbed3x<Gemm, ActivationFunctor> testbed(
+  Testbed3x<Gemm, ActivationFunctor, force_legacy_epilogue> testbed(
     check_relative_equality, ScalarLoc::ON_HOST, VectorScale::DISABLED);
+  testbed.impl_.hooks = hooks;
+
+  for (auto const& problem_size : problem_sizes) {
+    bool passed =
+        testbed.run(problem_size, cutlass::from_real<ElementScalar>(alpha),
+                    cutlass::from_real<ElementScalar>(beta));
+    if (!passed) {
+      auto problem_shape_MNKL = cute::append<4>(problem_size, 1);
+      std::cout << __FILE__ << ':' << __LINE__ << " : GEMM MNKL "
+                << cute::get<0>(problem_shape_MNKL) << " " << cute::get<1>(problem_shape_MNKL) << " "
+                << cute::get<2>(problem_shape_MNKL) << " " << cute::get<3>(problem_shape_MNKL)
+                << " FAILED.\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Gemm, template <class T> class ActivationFunctor =
+                             cutlass::epilogue::thread::Identity>
+bool TestXe(
+    double alpha = 1.0, double beta = 0.0,
+    CheckEquality check_relative_equality = CheckEquality::RELATIVE) {
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
 
   // For M & N we test a small and a big size
   // For K, we currently only support K = TileShapeK
@@ -2480,24 +2552,15 @@ bool TestXe(
   constexpr int TileShapeK = cute::size<2>(typename Gemm::GemmKernel::TileShape{});
   std::vector<int> problem_size_k{TileShapeK};
 
-  bool passed = true;
-
+  std::vector<ProblemShapeType> problem_sizes;
   for (int m : problem_size_m) {
     for (int n : problem_size_n) {
       for (int k : problem_size_k) {
-        ProblemShapeType problem_size{m, n, k, 1};
-        passed =
-            testbed.run(problem_size, cutlass::from_real<ElementScalar>(alpha),
-                        cutlass::from_real<ElementScalar>(beta));
-        if (!passed) {
-          std::cout << __FILE__ << ':' << __LINE__ << " : GEMM MNK " << m << " "
-                    << n << " " << k << " FAILED.\n";
-          return false;
-        }
+        problem_sizes.push_back(ProblemShapeType{m, n, k, 1});
       }
     }
   }
-  return passed;
+  return TestXe<Gemm, ActivationFunctor>(problem_sizes, alpha, beta, {}, check_relative_equality);
 }
 
 template <typename Gemm>
@@ -0,0 +1,422 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+    \brief Tests for Xe bf16t_bf16t_f32 GEMMs initialized through GemmUniversalAdapter::initialize_cached()
+           and retargeted through the pointer-only GemmUniversalAdapter::update()
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm_complex.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "gemm_testbed_3x.hpp"
+
+using namespace cute;
+
+namespace {
+
+// Runs the same problem through initialize_cached() of one GEMM with each (alpha, beta) pair in
+// turn, so that a cache hit has to pick up the new epilogue scalars. Every other run stores D to
+// a scratch buffer and copies it back, so a hit also has to retarget the store.
+template <typename Gemm>
+bool TestXeCached(std::vector<std::pair<float, float>> const& scalars) {
+  using ElementD = typename Gemm::ElementD;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  Gemm cached_op;
+  int launches = 0;
+
+  test::gemm::device::detail::TestbedHooks<Gemm> hooks;
+  hooks.launch = [&](Gemm&, typename Gemm::Arguments const& arguments, void* workspace) {
+    auto [M, N, K, L] = arguments.problem_shape;
+    std::size_t const size_D = static_cast<std::size_t>(M) * N * L;
+
+    cutlass::DeviceAllocation<ElementD> scratch_D;
+    typename Gemm::Arguments launch_arguments = arguments;
+    if (launches++ % 2 == 1) {
+      scratch_D.reset(size_D);
+      launch_arguments.epilogue.ptr_D = scratch_D.get();
+    }
+
+    cutlass::Status status = cached_op.initialize_cached(launch_arguments, workspace);
+    if (status == cutlass::Status::kSuccess) {
+      status = cached_op.run();
+    }
+    if (scratch_D.size() > 0) {
+      cutlass::device_memory::copy_device_to_device(const_cast<ElementD*>(arguments.epilogue.ptr_D), scratch_D.get(), size_D);
+    }
+    syclcompat::wait();
+    return status;
+  };
+
+  for (auto [alpha, beta] : scalars) {
+    if (!test::gemm::device::TestXe<Gemm>({ProblemShapeType{512, 256, 128, 1}}, alpha, beta, hooks)) {
+      std::cout << __FILE__ << ':' << __LINE__ << " : alpha " << alpha << " beta " << beta << " FAILED.\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Initializes the GEMM on a first set of buffers and runs it, then retargets it to a second set
+// with the pointer-only update() and runs it again. Both D are checked after the second run, so
+// the second launch has to read and write only the new buffers.
+template <typename Gemm>
+bool TestXePointerUpdate() {
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using ElementAccumulator = typename Gemm::ElementAccumulator;
+  using LayoutA = typename Gemm::LayoutA;
+  using LayoutB = typename Gemm::LayoutB;
+  using LayoutC = typename Gemm::LayoutC;
+  using LayoutD = typename Gemm::LayoutD;
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  int const M = 512, N = 256, K = 128, L = 1;
+  float const alpha = 1.f, beta = 1.f;
+  ProblemShapeType problem_size{M, N, K, L};
+
+  auto stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+  auto stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, L));
+  auto stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, L));
+  auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, L));
+
+  cutlass::DeviceAllocation<ElementA> block_A[2];
+  cutlass::DeviceAllocation<ElementB> block_B[2];
+  cutlass::DeviceAllocation<ElementC> block_C[2];
+  cutlass::DeviceAllocation<ElementD> block_D[2];
+  cutlass::DeviceAllocation<ElementD> block_ref_D(M * N * L);
+
+  for (int i = 0; i < 2; ++i) {
+    block_A[i].reset(M * K * L);
+    block_B[i].reset(K * N * L);
+    block_C[i].reset(M * N * L);
+    block_D[i].reset(M * N * L);
+    cutlass::reference::device::BlockFillRandomUniform(block_A[i].get(), block_A[i].size(), 2023 + i, ElementA(2), ElementA(-2), 0);
+    cutlass::reference::device::BlockFillRandomUniform(block_B[i].get(), block_B[i].size(), 2022 + i, ElementB(2), ElementB(-2), 0);
+    cutlass::reference::device::BlockFillRandomUniform(block_C[i].get(), block_C[i].size(), 2021 + i, ElementC(2), ElementC(-2), 0);
+  }
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    problem_size,
+    {block_A[0].get(), stride_A, block_B[0].get(), stride_B},
+    {{alpha, beta}, block_C[0].get(), stride_C, block_D[0].get(), stride_D},
+    hw_info
+  };
+
+  Gemm gemm_op;
+  if (gemm_op.can_implement(arguments) != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm_op.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm_op.run() != cutlass::Status::kSuccess ||
+      gemm_op.update(block_A[1].get(), block_B[1].get(), block_C[1].get(), block_D[1].get()) != cutlass::Status::kSuccess ||
+      gemm_op.run() != cutlass::Status::kSuccess) {
+    return false;
+  }
+  syclcompat::wait();
+
+  for (int i = 0; i < 2; ++i) {
+    cutlass::reference::device::GemmComplex(
+      {M, N, K},
+      alpha,
+      cutlass::TensorRef(block_A[i].get(), LayoutA::packed({M, K})),
+      cutlass::ComplexTransform::kNone,
+      cutlass::TensorRef(block_B[i].get(), LayoutB::packed({K, N})),
+      cutlass::ComplexTransform::kNone,
+      beta,
+      cutlass::TensorRef(block_C[i].get(), LayoutC::packed({M, N})),
+      cutlass::TensorRef(block_ref_D.get(), LayoutD::packed({M, N})),
+      ElementAccumulator(0));
+
+    syclcompat::wait();
+
+    if (!cutlass::reference::device::BlockCompareEqual(block_ref_D.get(), block_D[i].get(), block_D[i].size())) {
+      std::cout << __FILE__ << ':' << __LINE__ << " : buffers " << i << " FAILED.\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_cached, 256x256x32_alpha_beta) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXeCached<Gemm>({{1.f, 0.f}, {2.f, 1.f}, {0.5f, -1.f}}));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_cached, 256x256x32_persistent_alpha_beta) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::PersistentScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXeCached<Gemm>({{1.f, 0.f}, {2.f, 1.f}, {0.5f, -1.f}}));
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_cached, 256x256x32_pointer_update) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXePointerUpdate<Gemm>());
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_cached, 256x256x32_persistent_pointer_update) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::PersistentScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXePointerUpdate<Gemm>());
+}
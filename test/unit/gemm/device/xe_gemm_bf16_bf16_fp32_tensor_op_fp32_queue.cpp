@@ -0,0 +1,318 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+    \brief Tests for the SYCL queue and event overloads of GemmUniversalAdapter and of the workspace
+           helpers
+*/
+
+#include <algorithm>
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/xe_persistent_tile_scheduler_params_streamk.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+
+#include "gemm_testbed_3x.hpp"
+
+using namespace cute;
+
+namespace {
+
+using DecompositionMode = cutlass::gemm::kernel::detail::PersistentTileSchedulerXeStreamKParams::DecompositionMode;
+
+// Out-of-order queue on the device and context of the default queue. Commands submitted to it are
+// ordered only by their event dependencies.
+sycl::queue make_out_of_order_queue() {
+  sycl::queue& default_queue = syclcompat::get_default_queue();
+  return sycl::queue(default_queue.get_context(), default_queue.get_device());
+}
+
+// Copies count elements of src to dst in a kernel that only depends on dependencies
+template <class T>
+sycl::event copy_after(
+  sycl::queue& queue, T const* src, T* dst, size_t count, std::vector<sycl::event> const& dependencies) {
+  return queue.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(dependencies);
+    cgh.parallel_for(sycl::range<1>(count), [=](sycl::id<1> i) { dst[i] = src[i]; });
+  });
+}
+
+template <class T>
+std::vector<T> to_host(cutlass::DeviceAllocation<T> const& block) {
+  std::vector<T> host(block.size());
+  block.copy_to_host(host.data());
+  return host;
+}
+
+// Restores A, B and C on an out-of-order queue and launches the GEMM through run() with the
+// restore events as dependencies. D is then copied by a kernel that only depends on the event
+// returned by run(). Waiting on the copy alone must see the complete GEMM result, which is the D
+// that the testbed checks.
+template <typename Gemm>
+bool TestXeQueue(typename Gemm::GemmKernel::TileSchedulerArguments scheduler = {}) {
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+  using Arguments = typename Gemm::Arguments;
+
+  test::gemm::device::detail::TestbedHooks<Gemm> hooks;
+  hooks.arguments = [&](ProblemShapeType, Arguments& arguments) {
+    arguments.scheduler = scheduler;
+  };
+  hooks.launch = [&](Gemm& gemm_op, Arguments const& arguments, void* workspace) {
+    auto [M, N, K, L] = arguments.problem_shape;
+    size_t const size_A = size_t(M) * K * L;
+    size_t const size_B = size_t(K) * N * L;
+    size_t const size_C = size_t(M) * N * L;
+    auto* ptr_A = const_cast<ElementA*>(arguments.mainloop.ptr_A);
+    auto* ptr_B = const_cast<ElementB*>(arguments.mainloop.ptr_B);
+    auto* ptr_C = const_cast<ElementC*>(arguments.epilogue.ptr_C);
+    auto* ptr_D = const_cast<ElementD*>(arguments.epilogue.ptr_D);
+
+    // Stage the operands and clear them, so that they are only written on the out-of-order queue
+    cutlass::DeviceAllocation<ElementA> source_A(size_A);
+    cutlass::DeviceAllocation<ElementB> source_B(size_B);
+    cutlass::DeviceAllocation<ElementC> source_C(size_C);
+    cutlass::DeviceAllocation<ElementD> block_copy_D(size_C);
+    cutlass::device_memory::copy_device_to_device(source_A.get(), ptr_A, size_A);
+    cutlass::device_memory::copy_device_to_device(source_B.get(), ptr_B, size_B);
+    cutlass::device_memory::copy_device_to_device(source_C.get(), ptr_C, size_C);
+    syclcompat::memset(ptr_A, 0, size_A * sizeof(ElementA));
+    syclcompat::memset(ptr_B, 0, size_B * sizeof(ElementB));
+    syclcompat::memset(ptr_C, 0, size_C * sizeof(ElementC));
+    syclcompat::wait();
+
+    sycl::queue queue = make_out_of_order_queue();
+    std::vector<sycl::event> operands_ready{
+      copy_after(queue, source_A.get(), ptr_A, size_A, {}),
+      copy_after(queue, source_B.get(), ptr_B, size_B, {}),
+      copy_after(queue, source_C.get(), ptr_C, size_C, {})
+    };
+
+    sycl::event gemm_done;
+    cutlass::Status status = gemm_op.run(arguments, workspace, queue, operands_ready, gemm_done);
+    if (status != cutlass::Status::kSuccess) {
+      queue.wait();
+      return status;
+    }
+    copy_after(queue, ptr_D, block_copy_D.get(), size_C, {gemm_done}).wait();
+
+    // The testbed checks what the dependent copy saw
+    queue.wait();
+    cutlass::device_memory::copy_device_to_device(ptr_D, block_copy_D.get(), size_C);
+    syclcompat::wait();
+    return status;
+  };
+
+  return test::gemm::device::TestXe<Gemm>({ProblemShapeType{512, 256, 1024, 1}}, 1.0, 1.0, hooks);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(XE_Workspace_queue, zero_workspace_event_orders_dependent_kernel) {
+  size_t const count = size_t(1) << 22;
+  cutlass::DeviceAllocation<int> workspace(count);
+  cutlass::DeviceAllocation<int> result(count);
+
+  sycl::queue queue = make_out_of_order_queue();
+  sycl::event filled = queue.fill(workspace.get(), -1, count);
+
+  sycl::event cleared;
+  ASSERT_EQ(cutlass::zero_workspace(workspace.get(), count * sizeof(int), queue, {filled}, cleared),
+            cutlass::Status::kSuccess);
+  copy_after(queue, workspace.get(), result.get(), count, {cleared}).wait();
+
+  auto host = to_host(result);
+  EXPECT_EQ(size_t(std::count(host.begin(), host.end(), 0)), count);
+}
+
+TEST(XE_Workspace_queue, fill_workspace_event_orders_dependent_kernel) {
+  size_t const count = (size_t(1) << 22) + 3;
+  cutlass::DeviceAllocation<uint16_t> workspace(count);
+  cutlass::DeviceAllocation<uint16_t> result(count);
+
+  sycl::queue queue = make_out_of_order_queue();
+  sycl::event filled = queue.fill(workspace.get(), uint16_t(0), count);
+
+  sycl::event refilled;
+  ASSERT_EQ(cutlass::fill_workspace(workspace.get(), uint16_t(0xbeef), count, queue, {filled}, refilled),
+            cutlass::Status::kSuccess);
+  copy_after(queue, workspace.get(), result.get(), count, {refilled}).wait();
+
+  auto host = to_host(result);
+  EXPECT_EQ(size_t(std::count(host.begin(), host.end(), uint16_t(0xbeef))), count);
+}
+
+// With nothing to clear, the returned event still completes after the dependencies
+TEST(XE_Workspace_queue, empty_workspace_event_forwards_dependencies) {
+  size_t const count = size_t(1) << 22;
+  cutlass::DeviceAllocation<int> data(count);
+  cutlass::DeviceAllocation<int> result(count);
+
+  sycl::queue queue = make_out_of_order_queue();
+  sycl::event filled = queue.fill(data.get(), 42, count);
+
+  sycl::event event;
+  ASSERT_EQ(cutlass::zero_workspace(nullptr, 0, queue, {filled}, event), cutlass::Status::kSuccess);
+  copy_after(queue, data.get(), result.get(), count, {event}).wait();
+
+  auto host = to_host(result);
+  EXPECT_EQ(size_t(std::count(host.begin(), host.end(), 42)), count);
+}
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_queue, 256x256x32_event_orders_dependent_kernel) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXeQueue<Gemm>());
+}
+
+// Stream-K clears its barrier workspace on the queue, which the kernel has to be ordered after
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_queue, 256x256x32_stream_k_event_orders_dependent_kernel) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestXeQueue<Gemm>({1, DecompositionMode::StreamK}));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the GEMM + residual add + row RMSNorm epilogue (LinCombResidualRmsNorm) and
+           for RmsNormFinalize
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/reduction/kernel/rmsnorm_finalize.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "gemm_testbed_3x.hpp"
+#include "xe_row_finalize.hpp"
+
+using namespace cute;
+
+namespace {
+
+/// Counts the elements of the normalized rows of `input` that `norm` misses
+///   norm(m, n) = input(m, n) * rsqrt(mean_n(input(m, n)^2) + epsilon) * weight(n)
+/// for (M, N, L) row-major tensors
+template <typename ElementInput, typename ElementNorm>
+int count_rmsnorm_mismatches(std::vector<ElementInput> const& input, std::vector<ElementNorm> const& norm,
+                             std::vector<ElementNorm> const& weight, int M, int N, int L, float epsilon) {
+  int mismatches = 0;
+  for (int row = 0; row < M * L; ++row) {
+    double sumsq = 0;
+    for (int n = 0; n < N; ++n) {
+      double const x = input[static_cast<std::size_t>(row) * N + n];
+      sumsq += x * x;
+    }
+    double const rstd = 1.0 / std::sqrt(sumsq / N + epsilon);
+    for (int n = 0; n < N; ++n) {
+      double const w = weight.empty() ? 1.0 : double(weight[n]);
+      double const expected = double(input[static_cast<std::size_t>(row) * N + n]) * rstd * w;
+      double const actual = norm[static_cast<std::size_t>(row) * N + n];
+      mismatches += std::abs(actual - expected) > 1e-3 + 1e-2 * std::abs(expected);
+    }
+  }
+  return mismatches;
+}
+
+/// Runs the GEMM with the residual RMSNorm epilogue, completed by RmsNormFinalize when the tile
+/// does not span N, and checks both the residual D and its normalized rows against the host
+/// reference GEMM followed by a host RMSNorm
+template <typename Gemm>
+bool TestXeGemmResidualRmsNorm(int M, int N, int K, int L, float alpha) {
+  using CollectiveEpilogue = typename Gemm::CollectiveEpilogue;
+  using ElementOutput = typename CollectiveEpilogue::ElementOutput;
+  using FusionCallbacks = typename CollectiveEpilogue::FusionCallbacks;
+  using ElementNorm = typename FusionCallbacks::ElementNorm;
+  using StrideNorm = typename FusionCallbacks::StrideNorm;
+  using ElementPartial = typename FusionCallbacks::ElementPartial;
+  using StridePartials = typename FusionCallbacks::StridePartials;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+  using Hooks = test::gemm::device::detail::TestbedHooks<Gemm>;
+
+  using FinalizeKernel = cutlass::reduction::kernel::RmsNormFinalize<
+      ElementOutput, StrideD, ElementPartial, StridePartials, ElementNorm, ElementNorm, StrideNorm>;
+
+  float const epsilon = 1e-5f;
+  bool const single_pass = FusionCallbacks::RmsNorm::is_single_pass(N);
+  int const partials_N = FusionCallbacks::RmsNorm::get_partials_extent(N);
+
+  auto stride_norm = cutlass::make_cute_packed_stride(StrideNorm{}, cute::make_shape(M, N, L));
+  auto stride_partials = cutlass::make_cute_packed_stride(StridePartials{}, cute::make_shape(M, partials_N, L));
+
+  std::size_t const size_D = static_cast<std::size_t>(M) * N * L;
+  cutlass::DeviceAllocation<ElementNorm> block_weight(N);
+  cutlass::DeviceAllocation<ElementNorm> block_norm(size_D);
+  cutlass::DeviceAllocation<ElementPartial> block_sumsq(static_cast<std::size_t>(M) * partials_N * L);
+  cutlass::reference::device::BlockFillRandomUniform(block_weight.get(), block_weight.size(), 2020, ElementNorm(2), ElementNorm(-2), 2);
+
+  Hooks hooks;
+  // Only the buffer of the selected mode is set, as can_implement requires
+  hooks.arguments = [&](ProblemShapeType, typename Gemm::Arguments& arguments) {
+    arguments.epilogue.thread.ptr_norm = single_pass ? block_norm.get() : nullptr;
+    arguments.epilogue.thread.dNorm = stride_norm;
+    arguments.epilogue.thread.ptr_weight = block_weight.get();
+    arguments.epilogue.thread.epsilon = epsilon;
+    arguments.epilogue.thread.ptr_sumsq = single_pass ? nullptr : block_sumsq.get();
+    arguments.epilogue.thread.dPartials = stride_partials;
+  };
+  hooks.launch = [&](Gemm& gemm_op, typename Gemm::Arguments const& arguments, void* workspace) {
+    cutlass::Status status = gemm_op.initialize(arguments, workspace);
+    if (status == cutlass::Status::kSuccess) {
+      status = gemm_op.run();
+    }
+    if (status == cutlass::Status::kSuccess && !single_pass) {
+      test::gemm::device::run_row_finalize<FinalizeKernel>({{
+        M, N, partials_N, L,
+        arguments.epilogue.dD, stride_partials, stride_norm,
+        arguments.epilogue.ptr_D, block_sumsq.get(), block_weight.get(), block_norm.get(), epsilon
+      }});
+    }
+    return status;
+  };
+  // The testbed views hold the L batches of M rows one after another
+  hooks.verify = [&](ProblemShapeType, typename Hooks::TensorViewD reference_D, typename Hooks::TensorViewD D) {
+    std::vector<ElementOutput> host_ref_D(size_D);
+    std::vector<ElementNorm> host_norm(size_D);
+    std::vector<ElementNorm> host_weight(N);
+    for (int row = 0; row < M * L; ++row) {
+      for (int n = 0; n < N; ++n) {
+        host_ref_D[static_cast<std::size_t>(row) * N + n] = reference_D.at({row, n});
+      }
+    }
+    block_norm.copy_to_host(host_norm.data());
+    block_weight.copy_to_host(host_weight.data());
+
+    // alpha is a power of two and the testbed fills the operands with small integers, so D is exact
+    bool const residual_equal = cutlass::reference::host::TensorEquals(reference_D, D);
+    EXPECT_TRUE(residual_equal) << "residual, M " << M << " N " << N << " K " << K << " L " << L;
+
+    int const mismatches = count_rmsnorm_mismatches(host_ref_D, host_norm, host_weight, M, N, L, epsilon);
+    EXPECT_EQ(mismatches, 0) << (single_pass ? "single pass" : "finalized")
+                             << ", M " << M << " N " << N << " K " << K << " L " << L;
+    return mismatches == 0 && residual_equal;
+  };
+
+  return test::gemm::device::TestXe<Gemm>({ProblemShapeType{M, N, K, L}}, alpha, 1.0, hooks);
+}
+
+/// Checks that can_implement requires the output of the mode selected by N
+template <typename Gemm>
+void TestXeGemmResidualRmsNormCanImplement() {
+  using FusionCallbacks = typename Gemm::CollectiveEpilogue::FusionCallbacks;
+  int const tile_N = get<1>(typename Gemm::GemmKernel::TileShape{});
+
+  float buffer = 0.f;
+  auto arguments_for = [&](int N, bool norm, bool sumsq) {
+    typename Gemm::Arguments arguments{};
+    arguments.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+    arguments.problem_shape = {256, N, 64, 1};
+    arguments.epilogue.thread.ptr_norm = norm ? &buffer : nullptr;
+    arguments.epilogue.thread.ptr_sumsq = sumsq ? &buffer : nullptr;
+    return arguments;
+  };
+
+  EXPECT_TRUE(FusionCallbacks::RmsNorm::is_single_pass(tile_N));
+  EXPECT_FALSE(FusionCallbacks::RmsNorm::is_single_pass(tile_N + 4));
+
+  EXPECT_EQ(Gemm::can_implement(arguments_for(tile_N, true, false)), cutlass::Status::kSuccess);
+  EXPECT_NE(Gemm::can_implement(arguments_for(tile_N, false, true)), cutlass::Status::kSuccess);
+  EXPECT_EQ(Gemm::can_implement(arguments_for(tile_N + 4, false, true)), cutlass::Status::kSuccess);
+  EXPECT_NE(Gemm::can_implement(arguments_for(tile_N + 4, true, false)), cutlass::Status::kSuccess);
+}
+
+/// Runs RmsNormFinalize on its own, with the sums of squares of every row split unevenly over
+/// the partials
+template <typename Element>
+bool TestRmsNormFinalize(int M, int N, int partials_N, int L, bool weighted) {
+  using StrideIO = cute::Stride<int64_t, _1, int64_t>;
+  using StridePartials = cute::Stride<_1, int64_t, int64_t>;
+  using FinalizeKernel = cutlass::reduction::kernel::RmsNormFinalize<
+      Element, StrideIO, float, StridePartials, Element, Element, StrideIO>;
+
+  float const epsilon = 1e-3f;
+  std::size_t const size = static_cast<std::size_t>(M) * N * L;
+
+  std::vector<Element> host_input(size);
+  std::vector<Element> host_weight(weighted ? N : 0);
+  for (std::size_t i = 0; i < size; ++i) {
+    host_input[i] = Element(float(int(i * 37 % 17) - 8) / 4.f);
+  }
+  for (int n = 0; n < int(host_weight.size()); ++n) {
+    host_weight[n] = Element(float(n % 5) / 2.f - 1.f);
+  }
+
+  auto stride_partials = cutlass::make_cute_packed_stride(StridePartials{}, cute::make_shape(M, partials_N, L));
+  std::vector<float> host_sumsq(static_cast<std::size_t>(M) * partials_N * L, 0.f);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float const x = float(host_input[(static_cast<std::size_t>(l) * M + m) * N + n]);
+        int const partial = (n * n) % partials_N;
+        host_sumsq[cute::crd2idx(cute::make_coord(m, partial, l), stride_partials)] += x * x;
+      }
+    }
+  }
+
+  cutlass::DeviceAllocation<Element> block_input(size);
+  cutlass::DeviceAllocation<Element> block_output(size);
+  cutlass::DeviceAllocation<Element> block_weight(host_weight.size());
+  cutlass::DeviceAllocation<float> block_sumsq(host_sumsq.size());
+  block_input.copy_from_host(host_input.data());
+  block_sumsq.copy_from_host(host_sumsq.data());
+  if (weighted) {
+    block_weight.copy_from_host(host_weight.data());
+  }
+
+  auto stride_IO = cutlass::make_cute_packed_stride(StrideIO{}, cute::make_shape(M, N, L));
+  test::gemm::device::run_row_finalize<FinalizeKernel>({{
+    M, N, partials_N, L,
+    stride_IO, stride_partials, stride_IO,
+    block_input.get(), block_sumsq.get(), weighted ? block_weight.get() : nullptr, block_output.get(), epsilon
+  }});
+  syclcompat::wait();
+
+  std::vector<Element> host_output(size);
+  block_output.copy_to_host(host_output.data());
+
+  int const mismatches = count_rmsnorm_mismatches(host_input, host_output, host_weight, M, N, L, epsilon);
+  EXPECT_EQ(mismatches, 0) << "M " << M << " N " << N << " partials " << partials_N << " L " << L;
+  return mismatches == 0;
+}
+
+} // namespace
+
+// N up to the tile width normalizes in the epilogue, wider N through RmsNormFinalize. The 4
+// sub-groups along N of the 256x256 tile merge their sums through local memory, and rows past M
+// and columns past N are masked.
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_rmsnorm, 256x256x32) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombResidualRmsNorm<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementComputeEpilogue>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  TestXeGemmResidualRmsNormCanImplement<Gemm>();
+
+  EXPECT_TRUE(TestXeGemmResidualRmsNorm<Gemm>(512, 256, 64, 1, 1.f));
+  EXPECT_TRUE(TestXeGemmResidualRmsNorm<Gemm>(300, 104, 96, 2, 0.5f));
+  EXPECT_TRUE(TestXeGemmResidualRmsNorm<Gemm>(300, 1000, 64, 1, 1.f));
+  EXPECT_TRUE(TestXeGemmResidualRmsNorm<Gemm>(256, 520, 32, 2, 0.25f));
+}
+
+// Odd N, rows past M in the last block, and more partials than threads along y in the block
+TEST(RmsNormFinalize, float) {
+  EXPECT_TRUE(TestRmsNormFinalize<float>(37, 45, 3, 2, true));
+  EXPECT_TRUE(TestRmsNormFinalize<float>(5, 1001, 100, 1, true));
+  EXPECT_TRUE(TestRmsNormFinalize<float>(64, 7, 1, 3, false));
+}
@@ -0,0 +1,265 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the GEMM + row softmax epilogues (LinCombSoftmaxRowPartials) followed by
+           SoftmaxFinalize, on the Xe epilogue and on the device-agnostic SoftmaxEpilogue
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/xe_callbacks.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/reduction/kernel/softmax_finalize.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "gemm_testbed_3x.hpp"
+#include "xe_row_finalize.hpp"
+
+using namespace cute;
+
+namespace {
+
+/// Runs the GEMM with its softmax partials, then SoftmaxFinalize, and checks the normalized rows
+/// of D against a host softmax of the reference GEMM. The Xe epilogue takes the partials through
+/// its fusion arguments, the device-agnostic SoftmaxEpilogue directly.
+template <typename Gemm, bool force_legacy_epilogue = false>
+bool TestGemmSoftmax(int M, int N, int K, int L, float alpha, float beta) {
+  using CollectiveEpilogue = typename Gemm::CollectiveEpilogue;
+  using ElementOutput = typename CollectiveEpilogue::ElementOutput;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+  using StridePartials = cute::Stride<_1, int64_t, int64_t>;
+  using ElementPartial = float;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+  using Hooks = test::gemm::device::detail::TestbedHooks<Gemm>;
+
+  constexpr bool IsXeEpilogue = cute::is_same_v<typename CollectiveEpilogue::DispatchPolicy,
+                                                cutlass::epilogue::IntelPVCEpilogue>;
+
+  using FinalizeKernel = cutlass::reduction::kernel::SoftmaxFinalize<
+      ElementOutput, StrideD, ElementPartial, StridePartials, ElementOutput, StrideD>;
+
+  int const partials_N = cute::ceil_div(N, int(get<1>(typename Gemm::GemmKernel::TileShape{})));
+  auto stride_partials = cutlass::make_cute_packed_stride(StridePartials{}, cute::make_shape(M, partials_N, L));
+
+  cutlass::DeviceAllocation<ElementPartial> block_max(static_cast<std::size_t>(M) * partials_N * L);
+  cutlass::DeviceAllocation<ElementPartial> block_sum(static_cast<std::size_t>(M) * partials_N * L);
+
+  Hooks hooks;
+  hooks.arguments = [&](ProblemShapeType, typename Gemm::Arguments& arguments) {
+    if constexpr (IsXeEpilogue) {
+      arguments.epilogue.thread.ptr_max = block_max.get();
+      arguments.epilogue.thread.ptr_sum = block_sum.get();
+      arguments.epilogue.thread.dPartials = stride_partials;
+    }
+    else {
+      arguments.epilogue.ptr_max = block_max.get();
+      arguments.epilogue.ptr_sum = block_sum.get();
+      arguments.epilogue.dPartials = stride_partials;
+    }
+  };
+  hooks.launch = [&](Gemm& gemm_op, typename Gemm::Arguments const& arguments, void* workspace) {
+    cutlass::Status status = gemm_op.initialize(arguments, workspace);
+    if (status == cutlass::Status::kSuccess) {
+      status = gemm_op.run();
+    }
+    if (status == cutlass::Status::kSuccess) {
+      auto* ptr_D = const_cast<ElementOutput*>(arguments.epilogue.ptr_D);
+      test::gemm::device::run_row_finalize<FinalizeKernel>({{
+        M, N, partials_N, L,
+        arguments.epilogue.dD, stride_partials, arguments.epilogue.dD,
+        ptr_D, block_max.get(), block_sum.get(), ptr_D
+      }});
+    }
+    return status;
+  };
+  // The testbed views hold the L batches of M rows one after another
+  hooks.verify = [&](ProblemShapeType, typename Hooks::TensorViewD reference_D, typename Hooks::TensorViewD D) {
+    int mismatches = 0;
+    for (int row = 0; row < M * L; ++row) {
+      double max = reference_D.at({row, 0});
+      for (int n = 1; n < N; ++n) {
+        max = std::max(max, double(reference_D.at({row, n})));
+      }
+      double sum = 0;
+      for (int n = 0; n < N; ++n) {
+        sum += std::exp(double(reference_D.at({row, n})) - max);
+      }
+      for (int n = 0; n < N; ++n) {
+        double const expected = std::exp(double(reference_D.at({row, n})) - max) / sum;
+        double const actual = double(D.at({row, n}));
+        mismatches += std::abs(actual - expected) > 1e-4 + 1e-2 * expected;
+      }
+    }
+    EXPECT_EQ(mismatches, 0) << "M " << M << " N " << N << " K " << K << " L " << L;
+    return mismatches == 0;
+  };
+
+  return test::gemm::device::TestXe<Gemm, cutlass::epilogue::thread::Identity, force_legacy_epilogue>(
+      {ProblemShapeType{M, N, K, L}}, alpha, beta, hooks);
+}
+
+} // namespace
+
+// The 4 sub-groups along N of the 256x256 tile merge their partials through local memory. Rows
+// and columns past the last full tile are masked, and so are the lanes past N within a sub-group.
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_softmax, 256x256x32) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombSoftmaxRowPartials<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementComputeEpilogue>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(TestGemmSoftmax<Gemm>(512, 512, 64, 1, 0.25f, 0.f));
+  EXPECT_TRUE(TestGemmSoftmax<Gemm>(300, 264, 96, 2, 0.25f, 0.5f));
+  EXPECT_TRUE(TestGemmSoftmax<Gemm>(64, 1000, 32, 1, 0.125f, 1.f));
+}
+
+// The device-agnostic builder returns SoftmaxEpilogue for LinCombSoftmaxRowPartials. It has no
+// alignment requirement, so N is odd here and M leaves rows past the end of the last tile.
+TEST(Device_Gemm_f32t_f32t_f32t_agnostic_f32_softmax, 16x16x8) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_16, _16, _8>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = float;
+  using ElementInputB = float;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombSoftmaxRowPartials<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementComputeEpilogue>;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Agnostic, cutlass::arch::OpMultiplyAdd,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Agnostic, cutlass::arch::OpMultiplyAdd,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      cutlass::epilogue::collective::EpilogueScheduleAuto,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  static_assert(cute::is_same_v<CollectiveEpilogue, cutlass::epilogue::collective::SoftmaxEpilogue<
+      cutlass::detail::TagToStrideC_t<LayoutC>, cutlass::detail::TagToStrideC_t<LayoutD>,
+      cutlass::detail::TagToStrideC_t<cutlass::layout::ColumnMajor>, TileShape_MNK,
+      cutlass::epilogue::thread::LinearCombination<ElementOutput, 1, ElementAccumulator, ElementComputeEpilogue>,
+      cutlass::gemm::EpilogueDefault>>);
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // SoftmaxEpilogue takes the arguments of the default epilogue
+  EXPECT_TRUE((TestGemmSoftmax<Gemm, true>(64, 64, 32, 1, 0.25f, 0.f)));
+  EXPECT_TRUE((TestGemmSoftmax<Gemm, true>(37, 45, 24, 2, 0.25f, 0.5f)));
+  EXPECT_TRUE((TestGemmSoftmax<Gemm, true>(1, 7, 8, 1, 0.125f, 1.f)));
+}
@@ -0,0 +1,274 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Tests for the split-K parallel mode of the Xe GEMM followed by ReduceSplitK
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/reduction/device/reduce_split_k.h"
+#include "cutlass/reduction/kernel/reduce_split_k.h"
+#include "cutlass/reduction/thread/reduction_operators.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "gemm_testbed_3x.hpp"
+
+using namespace cute;
+
+namespace {
+
+template <typename Gemm>
+typename Gemm::Arguments make_split_k_arguments(int M, int N, int K, int splits, float alpha, float beta) {
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemmSplitKParallel,
+    {M, N, K, splits},
+    {nullptr, cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, 1)),
+     nullptr, cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(N, K, 1))},
+    {{alpha, beta},
+     nullptr, cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, splits)),
+     nullptr, cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, splits))},
+    hw_info
+  };
+  return arguments;
+}
+
+/// Split-K parallel GEMMs only store the raw accumulators of each partition
+template <typename Gemm>
+void TestXeSplitKCanImplement(bool linear_combination) {
+  int const M = 256, N = 256, K = 1024, splits = 4;
+
+  auto arguments = make_split_k_arguments<Gemm>(M, N, K, splits, 1.f, 0.f);
+  EXPECT_EQ(Gemm::can_implement(arguments) == cutlass::Status::kSuccess, linear_combination);
+
+  EXPECT_NE(Gemm::can_implement(make_split_k_arguments<Gemm>(M, N, K, splits, 2.f, 0.f)), cutlass::Status::kSuccess);
+  EXPECT_NE(Gemm::can_implement(make_split_k_arguments<Gemm>(M, N, K, splits, 1.f, 1.f)), cutlass::Status::kSuccess);
+
+  float alpha = 1.f;
+  arguments.epilogue.thread.alpha_ptr = &alpha;
+  EXPECT_NE(Gemm::can_implement(arguments), cutlass::Status::kSuccess);
+
+  // Every partition needs a k-tile
+  EXPECT_NE(Gemm::can_implement(make_split_k_arguments<Gemm>(M, N, 64, splits, 1.f, 0.f)), cutlass::Status::kSuccess);
+
+  // Scalars remain free outside of the split-K parallel mode
+  arguments = make_split_k_arguments<Gemm>(M, N, K, 1, 2.f, 1.f);
+  arguments.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+  EXPECT_EQ(Gemm::can_implement(arguments), cutlass::Status::kSuccess);
+}
+
+/// Runs the partial GEMMs and the reduction, which applies alpha and beta, in place of the GEMM
+/// and checks D against the host reference
+template <typename Gemm>
+bool TestXeSplitKParallel(int M, int N, int K, int splits, float alpha, float beta) {
+  using ElementAccumulator = typename Gemm::ElementD;
+  using ElementOutput = float;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  using ReductionOutputOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput, 128 / cutlass::sizeof_bits<ElementOutput>::value, ElementAccumulator, float>;
+  using ReductionOp = cutlass::reduction::thread::ReduceAdd<
+      ElementAccumulator, ElementAccumulator, ReductionOutputOp::kCount>;
+  using ReductionKernel = cutlass::reduction::kernel::ReduceSplitK<
+      cutlass::MatrixShape<4, 32 * ReductionOutputOp::kCount>, ReductionOutputOp, ReductionOp>;
+  using ReductionDevice = cutlass::reduction::device::ReduceSplitK<ReductionKernel>;
+  using StrideIndex = typename ReductionDevice::StrideIndex;
+
+  test::gemm::device::detail::TestbedHooks<Gemm> hooks;
+  hooks.launch = [&](Gemm& gemm_op, typename Gemm::Arguments const& arguments, void*) {
+    cutlass::DeviceAllocation<ElementAccumulator> block_partials(static_cast<std::size_t>(M) * N * splits);
+
+    auto split_k_arguments = make_split_k_arguments<Gemm>(M, N, K, splits, 1.f, 0.f);
+    split_k_arguments.mainloop.ptr_A = arguments.mainloop.ptr_A;
+    split_k_arguments.mainloop.ptr_B = arguments.mainloop.ptr_B;
+    split_k_arguments.epilogue.ptr_D = block_partials.get();
+
+    typename ReductionDevice::Arguments reduction_args(
+      {M, N},
+      splits,
+      static_cast<std::size_t>(M) * N,
+      {block_partials.get(), StrideIndex(N)},
+      {const_cast<ElementOutput*>(arguments.epilogue.ptr_D), StrideIndex(N)},
+      {const_cast<ElementOutput*>(arguments.epilogue.ptr_C), StrideIndex(N)},
+      {arguments.epilogue.thread.alpha, arguments.epilogue.thread.beta}
+    );
+
+    ReductionDevice reduction_op;
+    cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(split_k_arguments));
+
+    cutlass::Status status = cutlass::Status::kErrorInternal;
+    if (gemm_op.can_implement(split_k_arguments) == cutlass::Status::kSuccess &&
+        reduction_op.can_implement(reduction_args) == cutlass::Status::kSuccess &&
+        gemm_op.initialize(split_k_arguments, workspace.get()) == cutlass::Status::kSuccess &&
+        reduction_op.initialize(reduction_args) == cutlass::Status::kSuccess &&
+        gemm_op.run() == cutlass::Status::kSuccess) {
+      status = reduction_op.run();
+    }
+    syclcompat::wait();
+    return status;
+  };
+
+  return test::gemm::device::TestXe<Gemm>({ProblemShapeType{M, N, K, 1}}, alpha, beta, hooks);
+}
+
+} // namespace
+
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_splitk_parallel, 256x256x32_LinearCombination) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinearCombination<
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  TestXeSplitKCanImplement<Gemm>(true);
+  EXPECT_TRUE(TestXeSplitKParallel<Gemm>(512, 256, 2048, 4, 1.f, 0.f));
+  EXPECT_TRUE(TestXeSplitKParallel<Gemm>(256, 512, 1024, 3, 2.f, -1.f));
+}
+
+// The reduction does not apply the activation, so split-K parallel GEMMs reject it
+TEST(XE_Device_Gemm_bf16t_bf16t_f32t_tensor_op_f32_splitk_parallel, 256x256x32_LinCombEltAct) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::RowMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutD = cutlass::layout::RowMajor;
+
+  using TileShape_MNK = Shape<_256, _256, _32>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using EpilogueSchedule = cutlass::epilogue::collective::EpilogueScheduleAuto;
+  using ElementAccumulator = float;
+  using ElementComputeEpilogue = float;
+  using ElementInputA = bfloat16_t;
+  using ElementInputB = bfloat16_t;
+  using ElementOutput = float;
+
+  constexpr int AlignmentA = sizeof(ElementInputA);
+  constexpr int AlignmentB = sizeof(ElementInputB);
+  constexpr int AlignmentC = sizeof(ElementAccumulator);
+  constexpr int AlignmentD = sizeof(ElementOutput);
+
+  using FusionCallbacks = cutlass::epilogue::fusion::LinCombEltAct<cutlass::epilogue::thread::ReLu,
+          ElementOutput, ElementComputeEpilogue, ElementAccumulator, ElementAccumulator>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementComputeEpilogue, ElementAccumulator,
+      ElementAccumulator, LayoutC, AlignmentC,
+      ElementOutput, LayoutD, AlignmentD,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::IntelPVC, cutlass::arch::OpClassTensorOp,
+      ElementInputA, LayoutA, AlignmentA,
+      ElementInputB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAuto,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int, int, int, int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  TestXeSplitKCanImplement<Gemm>(false);
+}
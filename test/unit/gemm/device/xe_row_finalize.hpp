@@ -0,0 +1,65 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Launches the kernels that finalize the row reductions of the Intel PVC epilogue
+*/
+
+#pragma once
+
+#include <algorithm>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+
+namespace test {
+namespace gemm {
+namespace device {
+
+/// Launches a row finalize kernel, SoftmaxFinalize or RmsNormFinalize, like the examples do:
+/// NumThreadsPerWarp rows per block, the rest of the block strides over the partials and the
+/// columns of these rows
+template <typename FinalizeKernel>
+void run_row_finalize(typename FinalizeKernel::Params const& params) {
+  auto const block = syclcompat::dim3(NumThreadsPerWarp,
+                                      std::min(MaxNumThreadsPerBlock / NumThreadsPerWarp, params.args.dataN),
+                                      1);
+  auto const grid = syclcompat::dim3(cute::ceil_div(params.args.M, int(block.x)), params.args.batch_count, 1);
+
+  using namespace syclcompat::experimental;
+  launch<cutlass::device_kernel<FinalizeKernel>>(launch_policy{
+    grid, block, local_mem_size{static_cast<std::size_t>(FinalizeKernel::SharedStorageSize)}},
+    params);
+}
+
+} // namespace device
+} // namespace gemm
+} // namespace test
@@ -0,0 +1,144 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Unit test for the PipelineXe class
+*/
+
+#include <cute/tensor.hpp>
+#include <sycl/sycl.hpp>
+#include <syclcompat.hpp>
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/util/device_memory.h"
+
+using namespace syclcompat::experimental;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr int WorkgroupSize = 128;
+
+// Value written by work-item tid for stage k
+CUTLASS_HOST_DEVICE
+int stage_value(int k, int tid) {
+  return k * 1031 + tid * 7 + 1;
+}
+
+// Every work-item stores its value of stage k into a shared local memory stage buffer and reads
+// back the value its neighbour stored, in the order of the canonical mainloop of PipelineXe. Reads
+// that see another stage, or a value that was overwritten too early, are counted as errors.
+template <int Stages>
+void pipeline_xe_kernel(int* errors, int iterations) {
+  using Pipeline = cutlass::PipelineXe<Stages>;
+  using PipelineState = typename Pipeline::PipelineState;
+
+  int* smem = syclcompat::local_mem<int[Stages * WorkgroupSize]>();
+  int const tid = int(ThreadIdxX());
+  int const neighbour = (tid + 1) % WorkgroupSize;
+
+  Pipeline pipeline;
+  PipelineState write;
+  PipelineState read;
+
+  for (int k = 0; k < Stages - 1 && k < iterations; ++k) {
+    pipeline.producer_acquire(write);
+    smem[write.index() * WorkgroupSize + tid] = stage_value(k, tid);
+    pipeline.producer_commit(write);
+    ++write;
+  }
+
+  int count = 0;
+  for (int k = 0; k < iterations; ++k) {
+    pipeline.consumer_wait(read);
+    int const value = smem[read.index() * WorkgroupSize + neighbour];
+    pipeline.consumer_release(read);
+    ++read;
+
+    if (k + Stages - 1 < iterations) {
+      pipeline.producer_acquire(write);
+      smem[write.index() * WorkgroupSize + tid] = stage_value(k + Stages - 1, tid);
+      pipeline.producer_commit(write);
+      ++write;
+    }
+
+    count += (value != stage_value(k, neighbour));
+  }
+
+  pipeline.producer_tail(write);
+
+  errors[BlockIdxX() * WorkgroupSize + tid] = count;
+}
+
+template <int Stages>
+void run_pipeline_xe(int iterations, int workgroups = 4) {
+  cutlass::DeviceAllocation<int> errors(workgroups * WorkgroupSize);
+
+  launch<pipeline_xe_kernel<Stages>>(
+    launch_policy{syclcompat::dim3(workgroups), syclcompat::dim3(WorkgroupSize)},
+    errors.get(), iterations);
+  syclcompat::wait_and_throw();
+
+  std::vector<int> host_errors(workgroups * WorkgroupSize);
+  errors.copy_to_host(host_errors.data());
+
+  int total = 0;
+  for (int count : host_errors) {
+    total += count;
+  }
+  EXPECT_EQ(total, 0);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(PipelineXe, two_stages) {
+  run_pipeline_xe<2>(64);
+}
+
+TEST(PipelineXe, three_stages) {
+  run_pipeline_xe<3>(64);
+}
+
+TEST(PipelineXe, four_stages) {
+  run_pipeline_xe<4>(61);
+}
+
+// Fewer iterations than stages, so the prologue does not fill the pipeline
+TEST(PipelineXe, short_k_loop) {
+  run_pipeline_xe<4>(2);
+  run_pipeline_xe<3>(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,286 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the im2col host convolution references match the direct ones of convolution.h
+*/
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/layout/tensor.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/convolution_im2col.h"
+
+using cutlass::conv::Mode;
+using cutlass::conv::Operator;
+
+namespace {
+
+/// Packed tensor of floats filled with a reproducible pattern
+template <typename Layout>
+struct ConvTensor {
+  std::vector<float> data;
+  Layout layout;
+
+  ConvTensor(typename Layout::TensorCoord const &extent, uint32_t seed):
+    data(size_t(Layout::packed(extent).capacity(extent))), layout(Layout::packed(extent)) {
+
+    uint32_t state = seed * 2654435761u + 1;
+    for (float &value : data) {
+      state = state * 1664525u + 1013904223u;
+      value = seed ? float(int(state >> 24) - 128) / 32.f : 0.f;
+    }
+  }
+
+  cutlass::TensorRef<float, Layout> ref() {
+    return {data.data(), layout};
+  }
+};
+
+/// Extents of the A, B and C operands of a convolution, in the order of the Conv2d/Conv3d arguments
+template <typename Coord>
+std::tuple<Coord, Coord, Coord> conv_operand_extents(
+  Operator op, Coord const &activation, Coord const &filter, Coord const &deconv_filter, Coord const &output) {
+
+  switch (op) {
+  case Operator::kFprop:  return {activation, filter, output};
+  case Operator::kDgrad:  return {output, filter, activation};
+  case Operator::kDeconv: return {output, deconv_filter, activation};
+  default:                return {output, activation, filter};
+  }
+}
+
+/// Runs both references on the same operands. Both accumulate in the same order, so their
+/// results are bitwise identical.
+template <typename Layout, typename Problem, typename Direct, typename Im2col>
+void run_conv_references(
+  Operator op,
+  Problem const &problem,
+  std::tuple<typename Layout::TensorCoord, typename Layout::TensorCoord, typename Layout::TensorCoord> const &extents,
+  Direct direct,
+  Im2col im2col) {
+
+  ConvTensor<Layout> tensor_A(std::get<0>(extents), 1);
+  ConvTensor<Layout> tensor_B(std::get<1>(extents), 2);
+  ConvTensor<Layout> tensor_C(std::get<2>(extents), 3);
+  ConvTensor<Layout> tensor_D_direct(std::get<2>(extents), 0);
+  ConvTensor<Layout> tensor_D_im2col(std::get<2>(extents), 0);
+
+  direct(op, problem, tensor_A.ref(), tensor_B.ref(), tensor_C.ref(), tensor_D_direct.ref(), 1.5f, -0.5f);
+  im2col(op, problem, tensor_A.ref(), tensor_B.ref(), tensor_C.ref(), tensor_D_im2col.ref(), 1.5f, -0.5f);
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < tensor_D_direct.data.size(); ++i) {
+    mismatches += (tensor_D_direct.data[i] != tensor_D_im2col.data[i]);
+  }
+  EXPECT_EQ(mismatches, size_t(0)) << "operator " << int(op);
+}
+
+void run_conv2d(Operator op, cutlass::conv::Conv2dProblemSize const &problem) {
+  using Layout = cutlass::layout::TensorNHWC;
+
+  auto extents = conv_operand_extents<cutlass::Tensor4DCoord>(op,
+    {problem.N, problem.H, problem.W, problem.C},
+    {problem.K, problem.R, problem.S, problem.C / problem.groups},
+    {problem.C, problem.R, problem.S, problem.K},
+    {problem.N, problem.P, problem.Q, problem.K});
+
+  run_conv_references<Layout>(op, problem, extents,
+    cutlass::reference::host::Conv2d<float, Layout, float, Layout, float, Layout, float>,
+    cutlass::reference::host::Conv2dIm2col<float, Layout, float, Layout, float, Layout, float>);
+}
+
+void run_conv3d(Operator op, cutlass::conv::Conv3dProblemSize const &problem) {
+  using Layout = cutlass::layout::TensorNDHWC;
+
+  auto extents = conv_operand_extents<cutlass::Tensor5DCoord>(op,
+    {problem.N, problem.D, problem.H, problem.W, problem.C},
+    {problem.K, problem.T, problem.R, problem.S, problem.C},
+    {problem.C, problem.T, problem.R, problem.S, problem.K},
+    {problem.N, problem.Z, problem.P, problem.Q, problem.K});
+
+  run_conv_references<Layout>(op, problem, extents,
+    cutlass::reference::host::Conv3d<float, Layout, float, Layout, float, Layout, float>,
+    cutlass::reference::host::Conv3dIm2col<float, Layout, float, Layout, float, Layout, float>);
+}
+
+cutlass::conv::Conv2dProblemSize make_conv2d(
+  cutlass::Tensor4DCoord input, cutlass::Tensor4DCoord filter, int pad_h, int pad_w,
+  cutlass::MatrixCoord stride, cutlass::MatrixCoord dilation, Mode mode, int groups = 1) {
+
+  return cutlass::conv::Conv2dProblemSize(
+    input, filter, {pad_h, pad_h, pad_w, pad_w}, stride, dilation, mode, 1, groups);
+}
+
+cutlass::conv::Conv3dProblemSize make_conv3d(
+  cutlass::Tensor5DCoord input, cutlass::Tensor5DCoord filter, cutlass::Coord<3> padding,
+  cutlass::Coord<3> stride, cutlass::Coord<3> dilation, Mode mode) {
+
+  return cutlass::conv::Conv3dProblemSize(
+    input, filter, {padding, padding}, stride, dilation, mode);
+}
+
+/// 2-D problems covering padding, strides, dilation and both modes
+std::vector<cutlass::conv::Conv2dProblemSize> conv2d_problems() {
+  std::vector<cutlass::conv::Conv2dProblemSize> problems;
+  for (Mode mode : {Mode::kCrossCorrelation, Mode::kConvolution}) {
+    problems.push_back(make_conv2d({2, 9, 11, 8}, {12, 3, 3, 8}, 1, 1, {1, 1}, {1, 1}, mode));
+    problems.push_back(make_conv2d({1, 7, 7, 3}, {5, 1, 1, 3}, 0, 0, {1, 1}, {1, 1}, mode));
+    problems.push_back(make_conv2d({2, 13, 10, 6}, {7, 3, 5, 6}, 0, 2, {2, 3}, {1, 1}, mode));
+    problems.push_back(make_conv2d({1, 15, 12, 5}, {4, 3, 2, 5}, 2, 1, {1, 2}, {2, 3}, mode));
+    problems.push_back(make_conv2d({3, 6, 5, 4}, {9, 3, 3, 4}, 3, 4, {2, 2}, {1, 2}, mode));
+    problems.push_back(make_conv2d({1, 17, 9, 70}, {67, 2, 3, 70}, 1, 0, {3, 1}, {2, 1}, mode));
+  }
+  return problems;
+}
+
+/// 3-D problems covering padding, strides, dilation and both modes
+std::vector<cutlass::conv::Conv3dProblemSize> conv3d_problems() {
+  std::vector<cutlass::conv::Conv3dProblemSize> problems;
+  for (Mode mode : {Mode::kCrossCorrelation, Mode::kConvolution}) {
+    problems.push_back(make_conv3d({2, 5, 6, 7, 4}, {6, 3, 3, 3, 4},
+      cutlass::make_Coord(1, 1, 1), cutlass::make_Coord(1, 1, 1), cutlass::make_Coord(1, 1, 1), mode));
+    problems.push_back(make_conv3d({1, 9, 7, 8, 3}, {5, 3, 2, 3, 3},
+      cutlass::make_Coord(0, 1, 2), cutlass::make_Coord(2, 1, 3), cutlass::make_Coord(1, 2, 1), mode));
+    problems.push_back(make_conv3d({2, 6, 9, 5, 5}, {7, 2, 3, 1, 5},
+      cutlass::make_Coord(2, 0, 1), cutlass::make_Coord(1, 2, 1), cutlass::make_Coord(2, 1, 1), mode));
+  }
+  return problems;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Conv2dIm2col, fprop) {
+  for (auto const &problem : conv2d_problems()) {
+    run_conv2d(Operator::kFprop, problem);
+  }
+}
+
+TEST(Conv2dIm2col, fprop_grouped) {
+  for (Mode mode : {Mode::kCrossCorrelation, Mode::kConvolution}) {
+    run_conv2d(Operator::kFprop, make_conv2d({2, 9, 8, 8}, {12, 3, 3, 2}, 1, 1, {1, 1}, {1, 1}, mode, 4));
+    run_conv2d(Operator::kFprop, make_conv2d({1, 11, 7, 6}, {9, 3, 2, 2}, 0, 1, {2, 1}, {1, 2}, mode, 3));
+    run_conv2d(Operator::kFprop, make_conv2d({1, 8, 8, 5}, {5, 3, 3, 1}, 1, 1, {1, 1}, {1, 1}, mode, 5));
+  }
+}
+
+TEST(Conv2dIm2col, dgrad) {
+  for (auto const &problem : conv2d_problems()) {
+    run_conv2d(Operator::kDgrad, problem);
+  }
+}
+
+TEST(Conv2dIm2col, deconv) {
+  for (auto const &problem : conv2d_problems()) {
+    run_conv2d(Operator::kDeconv, problem);
+  }
+}
+
+TEST(Conv2dIm2col, wgrad) {
+  for (auto const &problem : conv2d_problems()) {
+    run_conv2d(Operator::kWgrad, problem);
+  }
+}
+
+// Large enough that every worker lowers several chunks of the im2col matrix
+TEST(Conv2dIm2col, multiple_chunks) {
+  auto problem = make_conv2d({4, 48, 48, 32}, {32, 3, 3, 32}, 1, 1, {1, 1}, {1, 1}, Mode::kCrossCorrelation);
+  run_conv2d(Operator::kFprop, problem);
+  run_conv2d(Operator::kDgrad, problem);
+  run_conv2d(Operator::kWgrad, problem);
+}
+
+TEST(Conv3dIm2col, fprop) {
+  for (auto const &problem : conv3d_problems()) {
+    run_conv3d(Operator::kFprop, problem);
+  }
+}
+
+// The direct 3-D reference has no groups. A grouped problem of unit depth has to match the
+// grouped 2-D reference.
+TEST(Conv3dIm2col, fprop_grouped) {
+  using Layout2d = cutlass::layout::TensorNHWC;
+  using Layout3d = cutlass::layout::TensorNDHWC;
+
+  for (Mode mode : {Mode::kCrossCorrelation, Mode::kConvolution}) {
+    auto problem = make_conv2d({2, 9, 10, 6}, {9, 3, 3, 2}, 1, 0, {1, 2}, {2, 1}, mode, 3);
+    auto problem_3d = cutlass::conv::Conv3dProblemSize(
+      problem.N, 1, problem.H, problem.W, problem.C, problem.K, 1, problem.R, problem.S, 1, problem.P, problem.Q,
+      0, problem.pad_h, problem.pad_w, 1, problem.stride_h, problem.stride_w, 1, problem.dilation_h, problem.dilation_w,
+      mode, 1, problem.groups);
+
+    ConvTensor<Layout2d> x({problem.N, problem.H, problem.W, problem.C}, 1);
+    ConvTensor<Layout2d> w({problem.K, problem.R, problem.S, problem.C / problem.groups}, 2);
+    ConvTensor<Layout2d> y_in({problem.N, problem.P, problem.Q, problem.K}, 3);
+    ConvTensor<Layout2d> y_direct({problem.N, problem.P, problem.Q, problem.K}, 0);
+    ConvTensor<Layout3d> y_im2col({problem.N, 1, problem.P, problem.Q, problem.K}, 0);
+
+    cutlass::reference::host::Conv2dFprop<float, Layout2d, float, Layout2d, float, Layout2d, float>(
+      problem, x.ref(), w.ref(), y_in.ref(), y_direct.ref(), 1.5f, -0.5f);
+
+    // Tensors of unit depth share the memory layout of their 2-D counterparts
+    cutlass::reference::host::Conv3dFpropIm2col<float, Layout3d, float, Layout3d, float, Layout3d, float>(
+      problem_3d,
+      {x.data.data(), Layout3d::packed({problem.N, 1, problem.H, problem.W, problem.C})},
+      {w.data.data(), Layout3d::packed({problem.K, 1, problem.R, problem.S, problem.C / problem.groups})},
+      {y_in.data.data(), Layout3d::packed({problem.N, 1, problem.P, problem.Q, problem.K})},
+      y_im2col.ref(), 1.5f, -0.5f);
+
+    EXPECT_EQ(y_direct.data, y_im2col.data);
+  }
+}
+
+TEST(Conv3dIm2col, dgrad) {
+  for (auto const &problem : conv3d_problems()) {
+    run_conv3d(Operator::kDgrad, problem);
+  }
+}
+
+TEST(Conv3dIm2col, deconv) {
+  for (auto const &problem : conv3d_problems()) {
+    run_conv3d(Operator::kDeconv, problem);
+  }
+}
+
+TEST(Conv3dIm2col, wgrad) {
+  for (auto const &problem : conv3d_problems()) {
+    run_conv3d(Operator::kWgrad, problem);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
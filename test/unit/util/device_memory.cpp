@@ -0,0 +1,255 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the caching allocator behind cutlass::device_memory::allocate()
+*/
+
+#include <atomic>
+#include <thread>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/device_memory.h"
+
+using cutlass::device_memory::caching_allocator;
+
+namespace {
+
+/// Enables the process-wide cache for the lifetime of a test and restores its defaults after
+struct ScopedCache {
+  caching_allocator &pool = caching_allocator::instance();
+
+  ScopedCache() {
+    pool.enable();
+    pool.trim();
+  }
+
+  ~ScopedCache() {
+    pool.set_max_cached_bytes(size_t(4) << 30);
+    pool.enable(false);
+  }
+};
+
+/// Stream on which enqueued work stays pending until release() is called
+struct BlockedStream {
+  std::atomic<bool> released{false};
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  sycl::queue queue;
+  caching_allocator::stream_type stream;
+
+  explicit BlockedStream(bool in_order):
+    queue(in_order ?
+      sycl::queue(syclcompat::get_default_queue().get_context(), syclcompat::get_default_queue().get_device(),
+                  sycl::property::queue::in_order()) :
+      sycl::queue(syclcompat::get_default_queue().get_context(), syclcompat::get_default_queue().get_device())),
+    stream(&queue) {
+    queue.submit([&](sycl::handler &cgh) {
+      cgh.host_task([this] {
+        while (!released.load()) {
+          std::this_thread::yield();
+        }
+      });
+    });
+  }
+
+  template <typename T>
+  T* allocate(size_t count) {
+    return cutlass::device_memory::allocate<T>(count, queue);
+  }
+
+  void release() {
+    released = true;
+    queue.wait();
+  }
+#else
+  cudaStream_t stream = nullptr;
+
+  explicit BlockedStream(bool) {
+    EXPECT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+    EXPECT_EQ(cudaLaunchHostFunc(stream, [](void *flag) {
+      while (!static_cast<std::atomic<bool>*>(flag)->load()) {
+        std::this_thread::yield();
+      }
+    }, &released), cudaSuccess);
+  }
+
+  ~BlockedStream() {
+    cudaStreamDestroy(stream);
+  }
+
+  template <typename T>
+  T* allocate(size_t count) {
+    return cutlass::device_memory::allocate<T>(count, stream);
+  }
+
+  void release() {
+    released = true;
+    EXPECT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+  }
+#endif
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DeviceMemoryCache, size_classes) {
+  EXPECT_EQ(caching_allocator::bin_bytes(1), caching_allocator::kMinBinBytes);
+  EXPECT_EQ(caching_allocator::bin_bytes(caching_allocator::kMinBinBytes), caching_allocator::kMinBinBytes);
+  EXPECT_EQ(caching_allocator::bin_bytes(4096), size_t(4096));
+  EXPECT_EQ(caching_allocator::bin_bytes(4097), size_t(5120));
+  EXPECT_EQ(caching_allocator::bin_bytes(7000), size_t(7168));
+
+  for (size_t bytes = 1; bytes < (size_t(1) << 24); bytes = bytes * 3 + 1) {
+    size_t const bin = caching_allocator::bin_bytes(bytes);
+    EXPECT_GE(bin, bytes);
+    EXPECT_LE(bin, std::max(caching_allocator::kMinBinBytes, bytes + bytes / 4));
+  }
+}
+
+TEST(DeviceMemoryCache, reuses_released_blocks) {
+  ScopedCache cache;
+  auto before = cache.pool.stats();
+
+  float* first = cutlass::device_memory::allocate<float>(1000);
+  cutlass::device_memory::free(first);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, caching_allocator::bin_bytes(4000));
+
+  // Another request in the same size class is served by the released block
+  char* second = cutlass::device_memory::allocate<char>(3900);
+  EXPECT_EQ(static_cast<void*>(second), static_cast<void*>(first));
+
+  auto after = cache.pool.stats();
+  EXPECT_EQ(after.allocations - before.allocations, size_t(2));
+  EXPECT_EQ(after.cache_hits - before.cache_hits, size_t(1));
+  EXPECT_EQ(after.bytes_cached, size_t(0));
+  EXPECT_EQ(after.bytes_in_use - before.bytes_in_use, caching_allocator::bin_bytes(4000));
+
+  cutlass::device_memory::free(second);
+}
+
+TEST(DeviceMemoryCache, respects_size_cap) {
+  ScopedCache cache;
+  cache.pool.set_max_cached_bytes(4096);
+
+  int* a = cutlass::device_memory::allocate<int>(1024);
+  int* b = cutlass::device_memory::allocate<int>(1024);
+  cutlass::device_memory::free(a);
+  cutlass::device_memory::free(b);
+
+  // Only one of the two blocks fits under the cap
+  EXPECT_EQ(cache.pool.stats().bytes_cached, size_t(4096));
+
+  // Lowering the cap evicts cached blocks
+  cache.pool.set_max_cached_bytes(0);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, size_t(0));
+
+  // Blocks larger than the cap are never cached
+  cache.pool.set_max_cached_bytes(4096);
+  int* large = cutlass::device_memory::allocate<int>(4096);
+  cutlass::device_memory::free(large);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, size_t(0));
+}
+
+TEST(DeviceMemoryCache, disabling_bypasses_the_cache) {
+  ScopedCache cache;
+  auto before = cache.pool.stats();
+
+  float* cached = cutlass::device_memory::allocate<float>(256);
+  float* in_use = cutlass::device_memory::allocate<float>(256);
+  cutlass::device_memory::free(cached);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, caching_allocator::bin_bytes(1024));
+
+  // Disabling releases the cached blocks, and blocks still in use go back to the driver
+  cache.pool.enable(false);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, size_t(0));
+
+  cutlass::device_memory::free(in_use);
+  auto stats = cache.pool.stats();
+  EXPECT_EQ(stats.bytes_cached, size_t(0));
+  EXPECT_EQ(stats.bytes_in_use, before.bytes_in_use);
+
+  // Allocations made while disabled are not seen by the cache
+  float* uncached = cutlass::device_memory::allocate<float>(256);
+  EXPECT_EQ(cache.pool.stats().allocations, stats.allocations);
+  cutlass::device_memory::free(uncached);
+  EXPECT_EQ(cache.pool.stats().bytes_cached, size_t(0));
+}
+
+TEST(DeviceMemoryCache, reuse_follows_stream_order) {
+  ScopedCache cache;
+  BlockedStream blocked(/* in_order = */ true);
+
+  // The block is released behind pending work on its stream
+  int* block = blocked.allocate<int>(2048);
+  cutlass::device_memory::free(block);
+
+  // Work on the same stream is ordered after the release, so the block is reused right away
+  int* same_stream = blocked.allocate<int>(2048);
+  EXPECT_EQ(same_stream, block);
+  cutlass::device_memory::free(same_stream);
+
+  // Work on another stream is not, so it gets a different block while the release is pending
+  int* other_stream = cutlass::device_memory::allocate<int>(2048);
+  EXPECT_NE(other_stream, block);
+
+  // Once the pending work has completed the block can be handed to any stream
+  blocked.release();
+  int* after_release = cutlass::device_memory::allocate<int>(2048);
+  EXPECT_EQ(after_release, block);
+
+  cutlass::device_memory::free(other_stream);
+  cutlass::device_memory::free(after_release);
+}
+
+#if defined(CUTLASS_ENABLE_SYCL)
+// Commands on an out-of-order queue are not ordered after the release, even on the same queue
+TEST(DeviceMemoryCache, out_of_order_queue_waits_for_release) {
+  ScopedCache cache;
+  BlockedStream blocked(/* in_order = */ false);
+
+  int* block = blocked.allocate<int>(2048);
+  cutlass::device_memory::free(block);
+
+  int* pending = blocked.allocate<int>(2048);
+  EXPECT_NE(pending, block);
+
+  blocked.release();
+  int* after_release = blocked.allocate<int>(2048);
+  EXPECT_EQ(after_release, block);
+
+  cutlass::device_memory::free(pending);
+  cutlass::device_memory::free(after_release);
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
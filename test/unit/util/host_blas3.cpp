@@ -0,0 +1,290 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the threaded host BLAS3 references match their serial results
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/blas3.h"
+#include "cutlass/complex.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
+#include "cutlass/util/reference/host/rank_2k.h"
+#include "cutlass/util/reference/host/rank_2k_complex.h"
+#include "cutlass/util/reference/host/rank_k_complex.h"
+#include "cutlass/util/reference/host/symm.h"
+#include "cutlass/util/reference/host/symm_complex.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/trmm.h"
+#include "cutlass/util/reference/host/trmm_complex.h"
+
+using Layout = cutlass::layout::ColumnMajor;
+
+namespace {
+
+// Neither extent is a multiple of the 16x16 output tiles of the references
+int const kM = 37;
+int const kN = 45;
+int const kK = 29;
+
+/// Column-major matrix in host memory
+template <typename Element>
+struct Matrix {
+  int rows;
+  int columns;
+  std::vector<Element> data;
+
+  Matrix(int rows_, int columns_, uint64_t seed):
+    rows(rows_), columns(columns_), data(size_t(rows_) * columns_) {
+    cutlass::reference::host::BlockFillRandomUniform(data.data(), data.size(), seed, 2, -2);
+  }
+
+  cutlass::TensorRef<Element, Layout> ref() {
+    return {data.data(), Layout(rows)};
+  }
+};
+
+/// Runs compute into D once serially, as with CUTLASS_HOST_REFERENCE_THREADS=1, and once on four
+/// threads, and expects bit-identical results. D is poisoned before each run so elements outside
+/// the updated triangle must be left alone by both.
+template <typename Element>
+void expect_threaded_matches_serial(Matrix<Element> &tensor_d, std::function<void()> const &compute) {
+  auto run = [&](int threads) {
+    cutlass::reference::detail::ScopedHostThreadCount thread_count(threads);
+    std::fill(tensor_d.data.begin(), tensor_d.data.end(), Element(-99));
+    compute();
+    return tensor_d.data;
+  };
+
+  std::vector<Element> serial = run(1);
+  std::vector<Element> threaded = run(4);
+
+  ASSERT_EQ(serial.size(), threaded.size());
+  size_t mismatches = 0;
+  for (size_t i = 0; i < serial.size(); ++i) {
+    mismatches += std::memcmp(&serial[i], &threaded[i], sizeof(Element)) != 0;
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+template <typename Element, cutlass::FillMode FillModeC>
+void run_rank2k() {
+  Matrix<Element> tensor_a(kN, kK, 1), tensor_b(kN, kK, 2), tensor_c(kN, kN, 3), tensor_d(kN, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::compute_rank2k<
+      Element, Layout, Element, Layout, Element, Layout, FillModeC, Element, Element>(
+        {kN, kN, kK}, Element(1.5), tensor_a.ref(), tensor_b.ref(), Element(0.5),
+        tensor_c.ref(), tensor_d.ref(), Element(0));
+  });
+}
+
+template <typename Element>
+void run_rank_k_complex(cutlass::FillMode fill_mode, cutlass::BlasMode blas_mode) {
+  Matrix<Element> tensor_a(kN, kK, 1), tensor_c(kN, kN, 3), tensor_d(kN, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::Rank2KComplex(
+      {kN, kN, kK}, Element(1.5), tensor_a.ref(), cutlass::ComplexTransform::kNone, Element(0.5),
+      tensor_c.ref(), tensor_d.ref(), Element(0), fill_mode, blas_mode);
+  });
+}
+
+template <typename Element>
+void run_rank_2k_complex(cutlass::FillMode fill_mode, cutlass::BlasMode blas_mode) {
+  Matrix<Element> tensor_a(kN, kK, 1), tensor_b(kN, kK, 2), tensor_c(kN, kN, 3), tensor_d(kN, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::Rank2KComplex(
+      {kN, kN, kK}, Element(1.5), tensor_a.ref(), cutlass::ComplexTransform::kNone,
+      tensor_b.ref(), cutlass::ComplexTransform::kConjugate, Element(0.5),
+      tensor_c.ref(), tensor_d.ref(), Element(0), fill_mode, blas_mode);
+  });
+}
+
+template <typename Element, cutlass::SideMode SideModeA, cutlass::FillMode FillModeA>
+void run_symm() {
+  int const k = (SideModeA == cutlass::SideMode::kLeft) ? kM : kN;
+  Matrix<Element> tensor_a(k, k, 1), tensor_b(kM, kN, 2), tensor_c(kM, kN, 3), tensor_d(kM, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::compute_symm<
+      Element, Layout, SideModeA, FillModeA, Element, Layout, Element, Layout, Element, Element>(
+        {kM, kN, k}, Element(1.5), tensor_a.ref(), tensor_b.ref(), Element(0.5),
+        tensor_c.ref(), tensor_d.ref(), Element(0));
+  });
+}
+
+template <typename Element, cutlass::SideMode SideModeA, cutlass::FillMode FillModeA, cutlass::BlasMode BlasModeA>
+void run_symm_complex() {
+  int const k = (SideModeA == cutlass::SideMode::kLeft) ? kM : kN;
+  Matrix<Element> tensor_a(k, k, 1), tensor_b(kM, kN, 2), tensor_c(kM, kN, 3), tensor_d(kM, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::compute_symm_complex<
+      Element, Layout, SideModeA, FillModeA, Element, Layout, Element, Layout, Element, Element,
+      BlasModeA>(
+        {kM, kN, k}, Element(1.5), tensor_a.ref(), tensor_b.ref(), Element(0.5),
+        tensor_c.ref(), tensor_d.ref(), Element(0));
+  });
+}
+
+template <typename Element, cutlass::SideMode SideModeA, cutlass::FillMode FillModeA, cutlass::DiagType DiagTypeA>
+void run_trmm() {
+  int const k = (SideModeA == cutlass::SideMode::kLeft) ? kM : kN;
+  Matrix<Element> tensor_a(k, k, 1), tensor_b(kM, kN, 2), tensor_d(kM, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::compute_trmm<
+      Element, Layout, SideModeA, FillModeA, DiagTypeA, Element, Layout, Element, Layout, Element, Element>(
+        {kM, kN, k}, Element(1.5), tensor_a.ref(), tensor_b.ref(), tensor_d.ref(), Element(0));
+  });
+}
+
+template <typename Element, cutlass::SideMode SideModeA, cutlass::FillMode FillModeA, cutlass::DiagType DiagTypeA>
+void run_trmm_complex() {
+  int const k = (SideModeA == cutlass::SideMode::kLeft) ? kM : kN;
+  Matrix<Element> tensor_a(k, k, 1), tensor_b(kM, kN, 2), tensor_d(kM, kN, 0);
+
+  expect_threaded_matches_serial(tensor_d, [&] {
+    cutlass::reference::host::compute_trmm_complex<
+      Element, Layout, cutlass::ComplexTransform::kConjugate, SideModeA, FillModeA, DiagTypeA,
+      Element, Layout, cutlass::ComplexTransform::kNone, Element, Layout, Element, Element>(
+        {kM, kN, k}, Element(1.5), tensor_a.ref(), tensor_b.ref(), tensor_d.ref(), Element(0));
+  });
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostBlas3Parallel, matrix_tiles_cover_fill_mode) {
+  for (auto fill_mode : {cutlass::FillMode::kFull, cutlass::FillMode::kLower, cutlass::FillMode::kUpper}) {
+    cutlass::reference::detail::ScopedHostThreadCount thread_count(4);
+    std::vector<std::atomic<int>> visits(size_t(kM) * kN);
+    for (auto &v : visits) {
+      v = 0;
+    }
+
+    cutlass::reference::detail::parallel_for_matrix_tiles(
+      kM, kN, 16, 16, fill_mode, [&](int row_begin, int column_begin) {
+        for (int row = row_begin; row < std::min(kM, row_begin + 16); ++row) {
+          for (int column = column_begin; column < std::min(kN, column_begin + 16); ++column) {
+            ++visits[size_t(row) * kN + column];
+          }
+        }
+      });
+
+    // Every element of the triangle is visited once; the rest only within a diagonal tile
+    size_t missed = 0;
+    size_t repeated = 0;
+    for (int row = 0; row < kM; ++row) {
+      for (int column = 0; column < kN; ++column) {
+        int v = visits[size_t(row) * kN + column];
+        bool in_triangle = fill_mode == cutlass::FillMode::kFull ||
+                           (fill_mode == cutlass::FillMode::kLower && row >= column) ||
+                           (fill_mode == cutlass::FillMode::kUpper && row <= column);
+        missed += in_triangle && v != 1;
+        repeated += v > 1;
+      }
+    }
+    EXPECT_EQ(missed, size_t(0));
+    EXPECT_EQ(repeated, size_t(0));
+  }
+}
+
+TEST(HostBlas3Parallel, rank_2k_f32) {
+  run_rank2k<float, cutlass::FillMode::kLower>();
+  run_rank2k<float, cutlass::FillMode::kUpper>();
+}
+
+TEST(HostBlas3Parallel, rank_k_complex_c64) {
+  for (auto fill_mode : {cutlass::FillMode::kLower, cutlass::FillMode::kUpper}) {
+    for (auto blas_mode : {cutlass::BlasMode::kSymmetric, cutlass::BlasMode::kHermitian}) {
+      run_rank_k_complex<cutlass::complex<double>>(fill_mode, blas_mode);
+    }
+  }
+}
+
+TEST(HostBlas3Parallel, rank_2k_complex_c32) {
+  for (auto fill_mode : {cutlass::FillMode::kLower, cutlass::FillMode::kUpper}) {
+    for (auto blas_mode : {cutlass::BlasMode::kSymmetric, cutlass::BlasMode::kHermitian}) {
+      run_rank_2k_complex<cutlass::complex<float>>(fill_mode, blas_mode);
+    }
+  }
+}
+
+TEST(HostBlas3Parallel, symm_f64) {
+  run_symm<double, cutlass::SideMode::kLeft, cutlass::FillMode::kLower>();
+  run_symm<double, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper>();
+  run_symm<double, cutlass::SideMode::kRight, cutlass::FillMode::kLower>();
+  run_symm<double, cutlass::SideMode::kRight, cutlass::FillMode::kUpper>();
+}
+
+TEST(HostBlas3Parallel, symm_complex_c32) {
+  run_symm_complex<cutlass::complex<float>, cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::BlasMode::kSymmetric>();
+  run_symm_complex<cutlass::complex<float>, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::BlasMode::kHermitian>();
+  run_symm_complex<cutlass::complex<float>, cutlass::SideMode::kRight, cutlass::FillMode::kLower, cutlass::BlasMode::kHermitian>();
+  run_symm_complex<cutlass::complex<float>, cutlass::SideMode::kRight, cutlass::FillMode::kUpper, cutlass::BlasMode::kSymmetric>();
+}
+
+TEST(HostBlas3Parallel, trmm_f32) {
+  run_trmm<float, cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit>();
+  run_trmm<float, cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::DiagType::kUnit>();
+  run_trmm<float, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::DiagType::kNonUnit>();
+  run_trmm<float, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::DiagType::kUnit>();
+  run_trmm<float, cutlass::SideMode::kRight, cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit>();
+  run_trmm<float, cutlass::SideMode::kRight, cutlass::FillMode::kLower, cutlass::DiagType::kUnit>();
+  run_trmm<float, cutlass::SideMode::kRight, cutlass::FillMode::kUpper, cutlass::DiagType::kNonUnit>();
+  run_trmm<float, cutlass::SideMode::kRight, cutlass::FillMode::kUpper, cutlass::DiagType::kUnit>();
+}
+
+TEST(HostBlas3Parallel, trmm_complex_c64) {
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::DiagType::kUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::DiagType::kNonUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::DiagType::kUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kRight, cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kRight, cutlass::FillMode::kLower, cutlass::DiagType::kUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kRight, cutlass::FillMode::kUpper, cutlass::DiagType::kNonUnit>();
+  run_trmm_complex<cutlass::complex<double>, cutlass::SideMode::kRight, cutlass::FillMode::kUpper, cutlass::DiagType::kUnit>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
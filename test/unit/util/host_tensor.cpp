@@ -0,0 +1,173 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the pinned host storage and asynchronous syncs of cutlass::HostTensor and the
+           staged copies behind them
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/layout/matrix.h"
+#include "cutlass/util/host_tensor.h"
+
+using Layout = cutlass::layout::RowMajor;
+
+// Writes a ramp to the host copy, pushes it to the device, clears the host copy and reads the
+// device copy back with the asynchronous syncs
+template <typename Element>
+void run_round_trip(cutlass::HostTensor<Element, Layout>& tensor) {
+  size_t const count = tensor.size();
+
+  for (size_t i = 0; i < count; ++i) {
+    tensor.host_data()[i] = Element(int(i % 1021));
+  }
+  tensor.sync_device_async().wait();
+
+  for (size_t i = 0; i < count; ++i) {
+    tensor.host_data()[i] = Element(-1);
+  }
+  tensor.sync_host_async().wait();
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < count; ++i) {
+    mismatches += (tensor.host_data()[i] != Element(int(i % 1021)));
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+TEST(HostTensor, pinning_is_kept_by_reset_reserve_and_resize) {
+  cutlass::HostTensor<float, Layout> tensor({16, 16}, true, true);
+  EXPECT_TRUE(tensor.host_pinned());
+
+  tensor.reset({32, 32});
+  EXPECT_TRUE(tensor.host_pinned());
+
+  tensor.reset({32, 64}, Layout::packed({32, 64}));
+  EXPECT_TRUE(tensor.host_pinned());
+
+  tensor.reserve(4096);
+  EXPECT_TRUE(tensor.host_pinned());
+
+  tensor.resize({128, 128});
+  EXPECT_TRUE(tensor.host_pinned());
+
+  tensor.reset({16, 16}, true, false);
+  EXPECT_FALSE(tensor.host_pinned());
+
+  tensor.reset({32, 32});
+  EXPECT_FALSE(tensor.host_pinned());
+
+  tensor.reserve(4096, true, true);
+  EXPECT_TRUE(tensor.host_pinned());
+}
+
+TEST(HostTensor, pinned_async_sync) {
+  cutlass::HostTensor<float, Layout> tensor({257, 129}, true, true);
+  run_round_trip(tensor);
+}
+
+TEST(HostTensor, pageable_async_sync) {
+  cutlass::HostTensor<float, Layout> tensor({257, 129});
+  EXPECT_FALSE(tensor.host_pinned());
+  run_round_trip(tensor);
+}
+
+// Larger than a staging chunk, with a partial last chunk, so the pageable path is double-buffered
+TEST(HostTensor, pageable_staged_async_sync) {
+  cutlass::HostTensor<float, Layout> tensor({3 * 1024 + 7, 1024});
+  run_round_trip(tensor);
+}
+
+TEST(HostTensor, pinned_reset_async_sync) {
+  cutlass::HostTensor<float, Layout> tensor({16, 16}, true, true);
+  tensor.reset({3 * 1024 + 7, 1024});
+  EXPECT_TRUE(tensor.host_pinned());
+  run_round_trip(tensor);
+}
+
+// Staged syncs reuse the staging buffers of the tensor, and a copy of the tensor gets its own
+TEST(HostTensor, pageable_staged_async_sync_repeated) {
+  cutlass::HostTensor<float, Layout> tensor({3 * 1024 + 7, 1024});
+  run_round_trip(tensor);
+  run_round_trip(tensor);
+
+  cutlass::HostTensor<float, Layout> copy(tensor);
+  run_round_trip(copy);
+  run_round_trip(tensor);
+}
+
+// The plain syncs copy directly, also above the staging chunk size
+TEST(HostTensor, pageable_sync) {
+  cutlass::HostTensor<float, Layout> tensor({3 * 1024 + 7, 1024});
+  size_t const count = tensor.size();
+
+  for (size_t i = 0; i < count; ++i) {
+    tensor.host_data()[i] = float(int(i % 1021));
+  }
+  tensor.sync_device();
+
+  for (size_t i = 0; i < count; ++i) {
+    tensor.host_data()[i] = -1.f;
+  }
+  tensor.sync_host();
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < count; ++i) {
+    mismatches += (tensor.host_data()[i] != float(int(i % 1021)));
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+// One set of staging buffers serves copies of several sizes in both directions. The buffers are
+// only reallocated when a copy asks for larger chunks.
+TEST(DeviceMemoryStaging, reuses_buffers) {
+  cutlass::device_memory::staging_buffers staging;
+  size_t const count = 10000;
+
+  std::vector<int> host(count), result(count);
+  for (size_t i = 0; i < count; ++i) {
+    host[i] = int(i * 7 + 1);
+  }
+  cutlass::device_memory::allocation<int> device(count);
+
+  for (size_t chunk_bytes : {size_t(1024), size_t(1024), size_t(4000), size_t(1000)}) {
+    std::fill(result.begin(), result.end(), -1);
+    cutlass::device_memory::copy_to_device_staged(device.get(), host.data(), count, staging, nullptr, chunk_bytes);
+    cutlass::device_memory::copy_to_host_staged(result.data(), device.get(), count, staging, nullptr, chunk_bytes);
+    EXPECT_TRUE(result == host) << "chunk_bytes " << chunk_bytes;
+  }
+
+  uint8_t* buffer = staging.data(0, 4000);
+  EXPECT_EQ(staging.data(0, 1024), buffer);
+  EXPECT_EQ(staging.data(0, 4000), buffer);
+}
@@ -0,0 +1,307 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the SYCL elementwise kernels against a host reference, including the tails and
+           the operands which cannot take the vector accesses
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+#include "sycl_test_utils.h"
+
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_elementwise.h"
+
+#include "cute/tensor.hpp"
+
+namespace {
+
+using test::util::to_device;
+using test::util::to_host;
+
+/// Small integers, so that every sum and product of the tests is exact in half precision
+template <typename T>
+std::vector<T> random_values(size_t count, uint32_t seed, int range) {
+  std::vector<T> values(count);
+  for (auto& value : values) {
+    seed = seed * 1664525u + 1013904223u;
+    value = T(int((seed >> 16) % uint32_t(2 * range + 1)) - range);
+  }
+  return values;
+}
+
+/// (M, N, L) tensor with rows of ld elements and packed batches
+template <typename T>
+auto make_mnl(T* ptr, int m, int n, int l, int64_t ld) {
+  return cute::make_tensor(cute::make_gmem_ptr(ptr), cute::make_shape(m, n, l),
+                           cute::make_stride(ld, cute::_1{}, ld * m));
+}
+
+/// Takes whole fragments, unlike the scalar cutlass/functional.h operators
+struct ScaleAdd {
+  float operator()(float a, float b) const {
+    return 2.0f * a + b;
+  }
+
+  template <int N>
+  cutlass::Array<float, N> operator()(cutlass::Array<float, N> const& a, cutlass::Array<float, N> const& b) const {
+    cutlass::Array<float, N> result;
+    for (int i = 0; i < N; ++i) {
+      result[i] = 2.0f * a[i] + b[i];
+    }
+    return result;
+  }
+};
+
+/// Writes the number of elements of the fragments it is called with
+struct VectorWidth {
+  template <int N>
+  cutlass::Array<float, N> operator()(cutlass::Array<float, N> const&) const {
+    cutlass::Array<float, N> result;
+    result.fill(float(N));
+    return result;
+  }
+};
+
+/// Problem of the binary tests, D = functor(A, B) for every batch
+struct ElementwiseProblem {
+  int m;
+  int n;
+  int l = 1;
+  int offset = 0;                ///< elements by which A, B and D are shifted from their allocation
+  int pad = 0;                   ///< elements by which every row is longer than N
+};
+
+/// Runs cutlass::elementwise() and checks D against the functor applied on the host. The padding
+/// of the rows of D is poisoned and must not be written.
+template <typename ElementA, typename ElementB, typename ElementD, typename Functor>
+void run_binary(ElementwiseProblem const& problem, Functor const& functor) {
+  int const m = problem.m, n = problem.n, l = problem.l;
+  int64_t const ld = n + problem.pad;
+  size_t const count = size_t(ld) * m * l;
+  ElementD const poison = ElementD(-99);
+
+  auto A = random_values<ElementA>(count, 1, 4);
+  auto B = random_values<ElementB>(count, 2, 8);
+
+  cutlass::DeviceAllocation<ElementA> block_A;
+  cutlass::DeviceAllocation<ElementB> block_B;
+  cutlass::DeviceAllocation<ElementD> block_D;
+  ElementA* ptr_A = to_device(block_A, A, problem.offset);
+  ElementB* ptr_B = to_device(block_B, B, problem.offset);
+  ElementD* ptr_D = to_device(block_D, std::vector<ElementD>(count, poison), problem.offset);
+
+  ASSERT_EQ(cutlass::elementwise(make_mnl(ptr_D, m, n, l, ld), functor,
+                                 make_mnl(ptr_A, m, n, l, ld), make_mnl(ptr_B, m, n, l, ld)),
+            cutlass::Status::kSuccess);
+  syclcompat::wait();
+
+  auto D = to_host(ptr_D, count);
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < count; ++i) {
+    ElementD const expected = int64_t(i % ld) < n ? ElementD(functor(float(A[i]), float(B[i]))) : poison;
+    mismatches += float(D[i]) != float(expected);
+  }
+  EXPECT_EQ(mismatches, size_t(0)) << "m " << m << " n " << n << " l " << l
+                                   << " offset " << problem.offset << " pad " << problem.pad;
+}
+
+/// Runs VectorWidth over an M x N problem and returns the width it was called with
+template <typename ElementIn, typename ElementD>
+int vector_width(int n, int pad = 0, int offset_in = 0, int offset_D = 0) {
+  int const m = 3;
+  int64_t const ld = n + pad;
+
+  cutlass::DeviceAllocation<ElementIn> block_in;
+  cutlass::DeviceAllocation<ElementD> block_D;
+  ElementIn* ptr_in = to_device(block_in, std::vector<ElementIn>(size_t(ld) * m), offset_in);
+  ElementD* ptr_D = to_device(block_D, std::vector<ElementD>(size_t(ld) * m), offset_D);
+
+  EXPECT_EQ(cutlass::elementwise(make_mnl(ptr_D, m, n, 1, ld), VectorWidth{}, make_mnl(ptr_in, m, n, 1, ld)),
+            cutlass::Status::kSuccess);
+  syclcompat::wait();
+
+  return int(float(to_host(ptr_D, 1)[0]));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SYCL_Elementwise, f32_plus) {
+  run_binary<float, float, float>({37, 1024}, cutlass::plus<float>{});
+  run_binary<float, float, float>({37, 1023}, cutlass::plus<float>{});
+  run_binary<float, float, float>({5, 7}, cutlass::plus<float>{});
+}
+
+// Rows whose stride suits the vector accesses but whose length does not
+TEST(SYCL_Elementwise, tails) {
+  run_binary<float, float, float>({1, 1023}, cutlass::plus<float>{});
+  run_binary<float, float, float>({8, 1022, 1, 0, 2}, cutlass::plus<float>{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({8, 1021, 1, 0, 3}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({5, 1020, 2, 0, 4}, ScaleAdd{});
+}
+
+TEST(SYCL_Elementwise, f16_fragments) {
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({64, 512}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({33, 1030}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({9, 333}, ScaleAdd{});
+}
+
+TEST(SYCL_Elementwise, f16_misaligned) {
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({16, 512, 1, 1}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({16, 512, 1, 2}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({16, 512, 1, 0, 3}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({7, 255, 1, 5, 1}, cutlass::plus<float>{});
+}
+
+TEST(SYCL_Elementwise, mixed_types) {
+  run_binary<cutlass::half_t, cutlass::bfloat16_t, float>({24, 520}, ScaleAdd{});
+  run_binary<int8_t, cutlass::half_t, float>({24, 1024, 1, 1}, ScaleAdd{});
+  run_binary<int8_t, int8_t, float>({24, 1024}, ScaleAdd{});
+}
+
+TEST(SYCL_Elementwise, batched) {
+  run_binary<float, float, float>({19, 256, 4}, ScaleAdd{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({19, 250, 3, 0, 6}, ScaleAdd{});
+}
+
+// More vectors than work-items in the capped grid, so every work-item loops
+TEST(SYCL_Elementwise, grid_stride) {
+  run_binary<float, float, float>({4096, 4100, 2}, cutlass::plus<float>{});
+  run_binary<cutlass::half_t, cutlass::half_t, cutlass::half_t>({4096, 2047, 3}, ScaleAdd{});
+  // The stride of the grid spans whole rows and batches
+  run_binary<int8_t, int8_t, int8_t>({4096, 48, 3}, ScaleAdd{});
+  run_binary<float, float, float>({1024, 5, 7}, cutlass::plus<float>{});
+}
+
+TEST(SYCL_Elementwise, vector_width) {
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1024)), 8);
+  EXPECT_EQ((vector_width<float, float>(1024)), 4);
+  EXPECT_EQ((vector_width<cutlass::half_t, float>(1024)), 8);
+  EXPECT_EQ((vector_width<int8_t, int8_t>(1024)), 16);
+  EXPECT_EQ((vector_width<int8_t, float>(1024)), 16);
+  EXPECT_EQ((vector_width<int8_t, int8_t>(1016, 8)), 8);
+
+  // Tails, with rows padded to 1024 elements
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1020, 4)), 4);
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1022, 2)), 2);
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1023, 1)), 1);
+
+  // Row strides and pointers which do not suit the widest accesses
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1024, 6)), 2);
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1024, 0, 4)), 4);
+  EXPECT_EQ((vector_width<cutlass::half_t, cutlass::half_t>(1024, 0, 0, 1)), 1);
+  EXPECT_EQ((vector_width<float, float>(1024, 0, 2, 2)), 2);
+}
+
+TEST(SYCL_Elementwise, broadcast) {
+  int const m = 45, n = 264;
+  auto A = random_values<cutlass::half_t>(size_t(m) * n, 1, 4);
+  auto scale = random_values<cutlass::half_t>(m, 2, 3);
+  auto bias = random_values<float>(n, 3, 16);
+
+  cutlass::DeviceAllocation<cutlass::half_t> block_A, block_scale, block_D;
+  cutlass::DeviceAllocation<float> block_bias;
+  cutlass::half_t* ptr_A = to_device(block_A, A, 0);
+  cutlass::half_t* ptr_scale = to_device(block_scale, scale, 0);
+  float* ptr_bias = to_device(block_bias, bias, 1);
+  cutlass::half_t* ptr_D = to_device(block_D, std::vector<cutlass::half_t>(size_t(m) * n), 0);
+
+  // D = A * scale(m) + bias(n)
+  auto tensor_A = cute::make_tensor(cute::make_gmem_ptr(ptr_A), cute::make_shape(m, n), cute::make_stride(n, cute::_1{}));
+  auto tensor_D = cute::make_tensor(cute::make_gmem_ptr(ptr_D), cute::make_shape(m, n), cute::make_stride(n, cute::_1{}));
+  auto tensor_scale = cute::make_tensor(cute::make_gmem_ptr(ptr_scale), cute::make_shape(m, n), cute::make_stride(cute::_1{}, cute::_0{}));
+  auto tensor_bias = cute::make_tensor(cute::make_gmem_ptr(ptr_bias), cute::make_shape(m, n), cute::make_stride(cute::_0{}, cute::_1{}));
+
+  ASSERT_EQ(cutlass::elementwise(tensor_D, cutlass::multiply_add<float>{}, tensor_A, tensor_scale, tensor_bias),
+            cutlass::Status::kSuccess);
+  syclcompat::wait();
+
+  auto D = to_host(ptr_D, size_t(m) * n);
+
+  size_t mismatches = 0;
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float const expected = float(A[size_t(i) * n + j]) * float(scale[i]) + bias[j];
+      mismatches += float(D[size_t(i) * n + j]) != float(cutlass::half_t(expected));
+    }
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+// The output may be one of the inputs
+TEST(SYCL_Elementwise, in_place_activation) {
+  int const m = 13, n = 301;
+  auto A = random_values<cutlass::half_t>(size_t(m) * n, 4, 6);
+
+  cutlass::DeviceAllocation<cutlass::half_t> block_A;
+  cutlass::half_t* ptr_A = to_device(block_A, A, 1);
+  auto tensor_A = cute::make_tensor(cute::make_gmem_ptr(ptr_A), cute::make_shape(m, n), cute::make_stride(n, cute::_1{}));
+
+  ASSERT_EQ(cutlass::elementwise(tensor_A, cutlass::epilogue::thread::ReLu<float>{}, tensor_A),
+            cutlass::Status::kSuccess);
+  syclcompat::wait();
+
+  auto D = to_host(ptr_A, size_t(m) * n);
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < D.size(); ++i) {
+    mismatches += float(D[i]) != std::max(float(A[i]), 0.0f);
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+TEST(SYCL_Elementwise, invalid_and_empty) {
+  cutlass::DeviceAllocation<float> block(64);
+  float* ptr = block.get();
+
+  auto out = cute::make_tensor(cute::make_gmem_ptr(ptr), cute::make_shape(4, 8), cute::make_stride(8, cute::_1{}));
+  auto in = cute::make_tensor(cute::make_gmem_ptr(ptr), cute::make_shape(4, 9), cute::make_stride(9, cute::_1{}));
+  EXPECT_EQ(cutlass::elementwise(out, cutlass::epilogue::thread::ReLu<float>{}, in),
+            cutlass::Status::kErrorInvalidProblem);
+
+  // Every row of the output would be written by several work-items
+  auto broadcast_out = cute::make_tensor(cute::make_gmem_ptr(ptr), cute::make_shape(4, 8), cute::make_stride(cute::_0{}, cute::_1{}));
+  EXPECT_EQ(cutlass::elementwise(broadcast_out, cutlass::epilogue::thread::ReLu<float>{}, out),
+            cutlass::Status::kErrorInvalidProblem);
+
+  auto empty = cute::make_tensor(cute::make_gmem_ptr(ptr), cute::make_shape(0, 8), cute::make_stride(8, cute::_1{}));
+  EXPECT_EQ(cutlass::elementwise(empty, cutlass::epilogue::thread::ReLu<float>{}, empty),
+            cutlass::Status::kSuccess);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,199 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the tiled SYCL reference GEMM against kernel::GemmComplex
+*/
+
+#include <cstring>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+#include "sycl_test_utils.h"
+
+#include "cutlass/complex.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/gemm_complex.h"
+
+namespace {
+
+using test::util::to_device;
+using test::util::to_host;
+
+/// Small integers, so that every product and sum of the tests is exact in float
+template <typename T>
+std::vector<T> random_values(size_t count, uint32_t seed, int range) {
+  std::vector<T> values(count);
+  for (auto& value : values) {
+    seed = seed * 1664525u + 1013904223u;
+    int real = int((seed >> 16) % uint32_t(2 * range + 1)) - range;
+    if constexpr (cutlass::is_complex<T>::value) {
+      seed = seed * 1664525u + 1013904223u;
+      int imag = int((seed >> 16) % uint32_t(2 * range + 1)) - range;
+      value = T(typename T::value_type(real), typename T::value_type(imag));
+    }
+    else {
+      value = T(real);
+    }
+  }
+  return values;
+}
+
+template <typename T>
+bool bitwise_equal(std::vector<T> const& lhs, std::vector<T> const& rhs) {
+  return lhs.size() == rhs.size() && !std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T));
+}
+
+/// Problem of the reference GEMM tests, D = alpha * op(A) * op(B) + beta * C for every batch
+struct GemmComplexProblem {
+  int m;
+  int n;
+  int k;
+  int batch_count = 1;
+  cutlass::ComplexTransform transform_a = cutlass::ComplexTransform::kNone;
+  cutlass::ComplexTransform transform_b = cutlass::ComplexTransform::kNone;
+};
+
+/// Runs reference::device::GemmComplex(), which launches kernel::GemmComplexTiled on SYCL devices,
+/// and kernel::GemmComplex on the same operands, and checks that both produce the same D
+template <typename Element, typename LayoutA, typename LayoutB, typename ComputeType>
+void run_gemm_complex(GemmComplexProblem const& problem, Element alpha, Element beta) {
+  using LayoutC = cutlass::layout::RowMajor;
+
+  int const m = problem.m, n = problem.n, k = problem.k, batches = problem.batch_count;
+  cutlass::gemm::GemmCoord problem_size(m, n, k);
+
+  int64_t const batch_stride_A = int64_t(m) * k;
+  int64_t const batch_stride_B = int64_t(k) * n;
+  int64_t const batch_stride_C = int64_t(m) * n;
+
+  auto A = random_values<Element>(size_t(batch_stride_A) * batches, 1, 3);
+  auto B = random_values<Element>(size_t(batch_stride_B) * batches, 2, 3);
+  auto C = random_values<Element>(size_t(batch_stride_C) * batches, 3, 4);
+
+  cutlass::DeviceAllocation<Element> block_A, block_B, block_C, block_D_tiled, block_D;
+
+  cutlass::TensorRef<Element, LayoutA> ref_A(to_device(block_A, A, 0), LayoutA::packed({m, k}));
+  cutlass::TensorRef<Element, LayoutB> ref_B(to_device(block_B, B, 0), LayoutB::packed({k, n}));
+  cutlass::TensorRef<Element, LayoutC> ref_C(to_device(block_C, C, 0), LayoutC::packed({m, n}));
+
+  // The two outputs start out different, so an element written by only one kernel mismatches
+  cutlass::TensorRef<Element, LayoutC> ref_D_tiled(
+    to_device(block_D_tiled, std::vector<Element>(C.size(), Element(-99)), 0), LayoutC::packed({m, n}));
+  cutlass::TensorRef<Element, LayoutC> ref_D(
+    to_device(block_D, std::vector<Element>(C.size(), Element(99)), 0), LayoutC::packed({m, n}));
+
+  cutlass::reference::device::GemmComplex(
+    problem_size, alpha, ref_A, problem.transform_a, ref_B, problem.transform_b, beta,
+    ref_C, ref_D_tiled, ComputeType(0),
+    batches, batch_stride_A, batch_stride_B, batch_stride_C, batch_stride_C);
+
+  // The untiled kernel, with fewer batch slices than batches so that it also loops over them
+  int const kMblock = 4;
+  int const kNblock = 4;
+  syclcompat::dim3 block(16, 8);
+  syclcompat::dim3 grid(
+    (m + block.x * kMblock - 1) / (block.x * kMblock),
+    (n + block.y * kNblock - 1) / (block.y * kNblock),
+    (batches + 1) / 2);
+
+  syclcompat::launch<cutlass::reference::device::kernel::GemmComplex<
+      Element, LayoutA, Element, LayoutB, Element, LayoutC, Element, ComputeType>>(
+    grid, block,
+    problem_size, alpha, ref_A, problem.transform_a, ref_B, problem.transform_b, beta,
+    ref_C, ref_D, ComputeType(0),
+    batches, batch_stride_A, batch_stride_B, batch_stride_C, batch_stride_C);
+
+  syclcompat::wait();
+
+  auto D_tiled = to_host(ref_D_tiled.data(), C.size());
+  auto D = to_host(ref_D.data(), C.size());
+
+  EXPECT_TRUE(bitwise_equal(D_tiled, D))
+    << "m " << m << " n " << n << " k " << k << " batches " << batches
+    << " transform_a " << int(problem.transform_a) << " transform_b " << int(problem.transform_b);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using cutlass::ComplexTransform;
+
+TEST(SYCL_GemmComplexTiled, f32_tn) {
+  // Multiples of the 64 x 64 x 16 tile, then extents that leave partial tiles in every mode
+  run_gemm_complex<float, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, float>(
+    {128, 64, 32}, 2.0f, -1.0f);
+  run_gemm_complex<float, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, float>(
+    {67, 45, 37}, 2.0f, -1.0f);
+  run_gemm_complex<float, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, float>(
+    {1, 130, 5}, 1.0f, 0.0f);
+}
+
+TEST(SYCL_GemmComplexTiled, f32_nt_batched) {
+  run_gemm_complex<float, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor, float>(
+    {70, 33, 19, 3}, 2.0f, -1.0f);
+  run_gemm_complex<float, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor, float>(
+    {64, 64, 16, 4}, 1.0f, 1.0f);
+}
+
+TEST(SYCL_GemmComplexTiled, f64) {
+  run_gemm_complex<double, cutlass::layout::RowMajor, cutlass::layout::RowMajor, double>(
+    {67, 45, 37}, 2.0, -1.0);
+  run_gemm_complex<double, cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor, double>(
+    {33, 129, 17, 3}, 2.0, -1.0);
+}
+
+TEST(SYCL_GemmComplexTiled, c32_conjugate) {
+  using Element = cutlass::complex<float>;
+  Element const alpha(2.0f, 1.0f), beta(-1.0f, 0.0f);
+
+  for (auto transform_a : {ComplexTransform::kNone, ComplexTransform::kConjugate}) {
+    for (auto transform_b : {ComplexTransform::kNone, ComplexTransform::kConjugate}) {
+      run_gemm_complex<Element, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, Element>(
+        {67, 45, 37, 1, transform_a, transform_b}, alpha, beta);
+      run_gemm_complex<Element, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor, Element>(
+        {31, 70, 18, 3, transform_a, transform_b}, alpha, beta);
+    }
+  }
+}
+
+TEST(SYCL_GemmComplexTiled, c64_conjugate_batched) {
+  using Element = cutlass::complex<double>;
+  Element const alpha(1.0, -2.0), beta(0.0, 1.0);
+
+  run_gemm_complex<Element, cutlass::layout::RowMajor, cutlass::layout::RowMajor, Element>(
+    {65, 17, 33, 3, ComplexTransform::kConjugate, ComplexTransform::kNone}, alpha, beta);
+  run_gemm_complex<Element, cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor, Element>(
+    {65, 17, 33, 3, ComplexTransform::kNone, ComplexTransform::kConjugate}, alpha, beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
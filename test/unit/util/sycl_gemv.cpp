@@ -0,0 +1,192 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the SYCL GEMV kernels against a host GEMM reference
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+#include "sycl_test_utils.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_gemv.h"
+
+namespace {
+
+using test::util::to_device;
+using test::util::to_host;
+
+/// Small integers, so that the products and most of the sums are exact
+template <typename T>
+std::vector<T> random_values(size_t count, uint32_t seed, int range) {
+  std::vector<T> values(count);
+  for (auto& value : values) {
+    seed = seed * 1664525u + 1013904223u;
+    value = T(int((seed >> 16) % uint32_t(2 * range + 1)) - range);
+  }
+  return values;
+}
+
+/// Problem of the GEMV tests, D = alpha * X * W^T + beta * C for every batch
+struct GemvProblem {
+  int m;
+  int n;
+  int k;
+  int batch_count = 1;
+  bool w_k_major = true;
+  int offset = 0;                ///< elements by which W, X, C and D are shifted from their allocation
+};
+
+/// Runs cutlass::gemv() and checks D against a host GEMM with the same operands
+template <typename ElementW, typename ElementX, typename ElementD>
+void run_gemv(GemvProblem const& problem) {
+  int const m = problem.m, n = problem.n, k = problem.k, batches = problem.batch_count;
+  float const alpha = 2.0f, beta = -1.0f;
+
+  // W rows are padded so that the leading dimension is not a multiple of the vector width either
+  int64_t const ldw = (problem.w_k_major ? k : n) + (problem.offset ? 1 : 0);
+  int64_t const batch_stride_W = ldw * (problem.w_k_major ? n : k);
+
+  auto W = random_values<ElementW>(size_t(batch_stride_W) * batches, 1, 3);
+  auto X = random_values<ElementX>(size_t(m) * k * batches, 2, 2);
+  auto C = random_values<ElementD>(size_t(m) * n * batches, 3, 4);
+
+  cutlass::DeviceAllocation<ElementW> block_W;
+  cutlass::DeviceAllocation<ElementX> block_X;
+  cutlass::DeviceAllocation<ElementD> block_C;
+  cutlass::DeviceAllocation<ElementD> block_D;
+
+  cutlass::SyclGemvArguments<ElementW, ElementX, ElementD> args;
+  args.m = m;
+  args.n = n;
+  args.k = k;
+  args.batch_count = batches;
+  args.ptr_W = to_device(block_W, W, problem.offset);
+  args.w_k_major = problem.w_k_major;
+  args.ldw = ldw;
+  args.batch_stride_W = batch_stride_W;
+  args.ptr_X = to_device(block_X, X, problem.offset);
+  args.stride_X_m = k;
+  args.batch_stride_X = int64_t(m) * k;
+  args.ptr_C = to_device(block_C, C, problem.offset);
+  args.stride_C_m = n;
+  args.batch_stride_C = int64_t(m) * n;
+  args.ptr_D = to_device(block_D, std::vector<ElementD>(size_t(m) * n * batches), problem.offset);
+  args.stride_D_m = n;
+  args.batch_stride_D = int64_t(m) * n;
+  args.alpha = alpha;
+  args.beta = beta;
+
+  ASSERT_EQ(cutlass::gemv(args), cutlass::Status::kSuccess);
+  syclcompat::wait();
+
+  auto D = to_host(args.ptr_D, size_t(m) * n * batches);
+
+  int mismatches = 0;
+  for (int b = 0; b < batches; ++b) {
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double accum = 0;
+        for (int kk = 0; kk < k; ++kk) {
+          int64_t const w_index = b * batch_stride_W + (problem.w_k_major ? j * ldw + kk : kk * ldw + j);
+          accum += double(float(X[(size_t(b) * m + i) * k + kk])) * double(float(W[w_index]));
+        }
+        size_t const d_index = (size_t(b) * m + i) * n + j;
+        double const expected = alpha * accum + beta * double(float(C[d_index]));
+        double const tolerance = 1e-3 * std::abs(expected) + 1e-3;
+        mismatches += std::abs(double(float(D[d_index])) - expected) > tolerance;
+      }
+    }
+  }
+  EXPECT_EQ(mismatches, 0) << "m " << m << " n " << n << " k " << k << " batches " << batches
+                           << (problem.w_k_major ? " K-major" : " N-major") << " offset " << problem.offset;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SYCL_Gemv, f16_k_major) {
+  for (int m = 1; m <= cutlass::kSyclGemvMaxVectors; ++m) {
+    run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({m, 257, 512});
+  }
+}
+
+TEST(SYCL_Gemv, f16_n_major) {
+  for (int m = 1; m <= cutlass::kSyclGemvMaxVectors; ++m) {
+    run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({m, 264, 512, 1, false});
+  }
+}
+
+TEST(SYCL_Gemv, f16_odd_k) {
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({1, 129, 333});
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({3, 129, 333, 1, false});
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({4, 31, 1});
+}
+
+TEST(SYCL_Gemv, f16_misaligned) {
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({2, 256, 512, 1, true, 1});
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({2, 256, 512, 1, false, 1});
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({1, 255, 333, 1, true, 3});
+}
+
+TEST(SYCL_Gemv, f16_batched) {
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({2, 130, 256, 3});
+  run_gemv<cutlass::half_t, cutlass::half_t, cutlass::half_t>({4, 130, 256, 3, false});
+}
+
+// int8 W takes the 16-element accesses
+TEST(SYCL_Gemv, s8_k_major) {
+  for (int m = 1; m <= cutlass::kSyclGemvMaxVectors; ++m) {
+    run_gemv<int8_t, cutlass::half_t, float>({m, 257, 1024});
+  }
+}
+
+TEST(SYCL_Gemv, s8_n_major) {
+  for (int m = 1; m <= cutlass::kSyclGemvMaxVectors; ++m) {
+    run_gemv<int8_t, cutlass::half_t, float>({m, 272, 1024, 1, false});
+  }
+}
+
+TEST(SYCL_Gemv, s8_odd_k) {
+  run_gemv<int8_t, cutlass::half_t, float>({1, 129, 333});
+  run_gemv<int8_t, cutlass::half_t, float>({2, 129, 335, 1, false});
+}
+
+TEST(SYCL_Gemv, s8_misaligned) {
+  run_gemv<int8_t, cutlass::half_t, float>({1, 256, 1024, 1, true, 1});
+  run_gemv<int8_t, cutlass::half_t, float>({3, 256, 1024, 2, false, 5});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that SyclGraph replays the state of the capture, with and without command graphs
+*/
+
+#include <stdexcept>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+#include <syclcompat.hpp>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_graph.hpp"
+
+namespace {
+
+constexpr int kCount = 1000;
+
+/// State of one launch of add_value
+struct AddState {
+  int* data;
+  int value;
+};
+
+/// Adds state.value to every element of state.data
+void add_value(sycl::queue& queue, AddState& state) {
+  int* data = state.data;
+  int const value = state.value;
+  queue.parallel_for(sycl::range<1>(kCount), [=](sycl::id<1> idx) {
+    data[idx] += value;
+  });
+}
+
+std::vector<int> read_back(cutlass::DeviceAllocation<int> const& block) {
+  std::vector<int> host(block.size());
+  block.copy_to_host(host.data());
+  return host;
+}
+
+cutlass::DeviceAllocation<int> make_zeroed_block(sycl::queue& queue) {
+  cutlass::DeviceAllocation<int> block(kCount);
+  queue.memset(block.get(), 0, kCount * sizeof(int)).wait();
+  return block;
+}
+
+/// Captures from a scope the captured state does not outlive
+void capture_add_value(cutlass::SyclGraph& graph, int* data, int value) {
+  AddState state{data, value};
+  graph.capture(add_value, state);
+}
+
+/// Captures, changes the original state, and replays twice
+void run_replays_captured_state(bool record) {
+  cutlass::SyclGraph graph(syclcompat::get_default_queue(), record);
+  if (record && !graph.records()) {
+    GTEST_SKIP() << "The device does not support command graphs";
+  }
+
+  auto block = make_zeroed_block(graph.queue());
+
+  AddState state{block.get(), 3};
+  graph.capture(add_value, state);
+  EXPECT_TRUE(graph.captured());
+
+  // Nothing runs before the first replay, and replays do not see later changes
+  EXPECT_EQ(read_back(block), std::vector<int>(kCount, 0));
+  state.value = 100;
+
+  graph.replay();
+  graph.replay().wait();
+  EXPECT_EQ(read_back(block), std::vector<int>(kCount, 6));
+}
+
+void run_state_outlives_capture(bool record) {
+  cutlass::SyclGraph graph(syclcompat::get_default_queue(), record);
+  if (record && !graph.records()) {
+    GTEST_SKIP() << "The device does not support command graphs";
+  }
+
+  auto block = make_zeroed_block(graph.queue());
+
+  capture_add_value(graph, block.get(), 5);
+  graph.replay().wait();
+  EXPECT_EQ(read_back(block), std::vector<int>(kCount, 5));
+}
+
+/// Re-captures the sequence pointing at another buffer
+void run_recapture(bool record) {
+  cutlass::SyclGraph graph(syclcompat::get_default_queue(), record);
+  if (record && !graph.records()) {
+    GTEST_SKIP() << "The device does not support command graphs";
+  }
+
+  auto block_a = make_zeroed_block(graph.queue());
+  auto block_b = make_zeroed_block(graph.queue());
+
+  graph.capture([](sycl::queue& queue, AddState& first, AddState& second) {
+    add_value(queue, first);
+    add_value(queue, second);
+  }, AddState{block_a.get(), 1}, AddState{block_a.get(), 2});
+  graph.replay().wait();
+
+  graph.capture([](sycl::queue& queue, AddState& first, AddState& second) {
+    add_value(queue, first);
+    add_value(queue, second);
+  }, AddState{block_b.get(), 4}, AddState{block_b.get(), 8});
+  graph.replay().wait();
+
+  EXPECT_EQ(read_back(block_a), std::vector<int>(kCount, 3));
+  EXPECT_EQ(read_back(block_b), std::vector<int>(kCount, 12));
+
+  graph.reset();
+  EXPECT_FALSE(graph.captured());
+  EXPECT_THROW(graph.replay(), std::runtime_error);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SyclGraph, graph_replays_captured_state) {
+  run_replays_captured_state(true);
+}
+
+TEST(SyclGraph, fallback_replays_captured_state) {
+  run_replays_captured_state(false);
+}
+
+TEST(SyclGraph, graph_state_outlives_capture) {
+  run_state_outlives_capture(true);
+}
+
+TEST(SyclGraph, fallback_state_outlives_capture) {
+  run_state_outlives_capture(false);
+}
+
+TEST(SyclGraph, graph_recapture) {
+  run_recapture(true);
+}
+
+TEST(SyclGraph, fallback_recapture) {
+  run_recapture(false);
+}
+
+TEST(SyclGraph, replay_before_capture) {
+  cutlass::SyclGraph graph;
+  EXPECT_FALSE(graph.captured());
+  EXPECT_THROW(graph.replay(), std::runtime_error);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the SYCL NCHW <-> NHWC transforms, channel padding and pooling kernels against
+           host references
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+#include "sycl_test_utils.h"
+
+#include "cutlass/core_io.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_nchw_to_nhwc.h"
+#include "cutlass/util/sycl_nhwc_padding.h"
+#include "cutlass/util/sycl_nhwc_pooling.h"
+#include "cutlass/util/sycl_nhwc_to_nchw.h"
+
+namespace {
+
+using test::util::to_device;
+using test::util::to_host;
+
+/// Quarter steps in [-range, range], exactly representable in every tested type
+template <typename T>
+std::vector<T> random_values(size_t count, uint32_t seed, int range) {
+  std::vector<T> values(count);
+  for (auto& value : values) {
+    seed = seed * 1664525u + 1013904223u;
+    value = T(float(int((seed >> 16) % uint32_t(8 * range + 1)) - 4 * range) / 4.0f);
+  }
+  return values;
+}
+
+template <typename T>
+bool bitwise_equal(std::vector<T> const& lhs, std::vector<T> const& rhs) {
+  return lhs.size() == rhs.size() && !std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T));
+}
+
+/// Output of the transforms and of the padding before the kernels write it, so that elements
+/// the kernels skip are detected
+template <typename T>
+std::vector<T> poisoned(size_t count) {
+  return std::vector<T>(count, T(-1000.0f));
+}
+
+/// Runs cutlass::nchw_to_nhwc_padded() on an (N, C, H, W) tensor padded to c_out channels, or
+/// cutlass::nchw_to_nhwc() when c_out is C, and checks the NHWC result element by element
+template <typename T>
+void run_nchw_to_nhwc(int N, int C, int H, int W, int c_out) {
+  size_t const count = size_t(N) * C * H * W;
+  auto input = random_values<T>(count, 1, 8);
+
+  cutlass::DeviceAllocation<T> block_input, block_output;
+  T* output = to_device(block_output, poisoned<T>(size_t(N) * H * W * c_out), 0);
+
+  cutlass::TensorRef<T, cutlass::layout::TensorNCHW> ref_input(
+    to_device(block_input, input, 0), cutlass::layout::TensorNCHW::packed({N, H, W, C}));
+  cutlass::TensorRef<T, cutlass::layout::TensorNHWC> ref_output(
+    output, cutlass::layout::TensorNHWC::packed({N, H, W, c_out}));
+
+  if (c_out == C) {
+    cutlass::nchw_to_nhwc<T>({N, C, H, W}, {N, H, W, C}, ref_input, ref_output, nullptr);
+  }
+  else {
+    cutlass::nchw_to_nhwc_padded<T>({N, H, W, C}, {N, H, W, c_out}, ref_input, ref_output, nullptr);
+  }
+  syclcompat::wait();
+
+  std::vector<T> expected(size_t(N) * H * W * c_out);
+  for (int n = 0; n < N; ++n) {
+    for (int p = 0; p < H * W; ++p) {
+      for (int c = 0; c < c_out; ++c) {
+        expected[(size_t(n) * H * W + p) * c_out + c] =
+          c < C ? input[(size_t(n) * C + c) * H * W + p] : T(0);
+      }
+    }
+  }
+  EXPECT_TRUE(bitwise_equal(to_host(output, expected.size()), expected))
+    << "N " << N << " C " << C << " H " << H << " W " << W << " c_out " << c_out;
+}
+
+/// Runs cutlass::nhwc_to_nchw() on an (N, H, W, C) tensor and checks the NCHW result
+template <typename T>
+void run_nhwc_to_nchw(int N, int H, int W, int C) {
+  size_t const count = size_t(N) * H * W * C;
+  auto input = random_values<T>(count, 2, 8);
+
+  cutlass::DeviceAllocation<T> block_input, block_output;
+  T* output = to_device(block_output, poisoned<T>(count), 0);
+
+  cutlass::nhwc_to_nchw<T>({N, H, W, C}, {N, C, H, W},
+    cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+      to_device(block_input, input, 0), cutlass::layout::TensorNHWC::packed({N, H, W, C})),
+    cutlass::TensorRef<T, cutlass::layout::TensorNCHW>(
+      output, cutlass::layout::TensorNCHW::packed({N, H, W, C})),
+    nullptr);
+  syclcompat::wait();
+
+  std::vector<T> expected(count);
+  for (int n = 0; n < N; ++n) {
+    for (int p = 0; p < H * W; ++p) {
+      for (int c = 0; c < C; ++c) {
+        expected[(size_t(n) * C + c) * H * W + p] = input[(size_t(n) * H * W + p) * C + c];
+      }
+    }
+  }
+  EXPECT_TRUE(bitwise_equal(to_host(output, count), expected))
+    << "N " << N << " H " << H << " W " << W << " C " << C;
+}
+
+/// Runs cutlass::nhwc_padding() from c_in to c_out channels and checks that the input channels
+/// are copied and the padding channels are zero
+template <typename T>
+void run_nhwc_padding(int N, int H, int W, int c_in, int c_out, int offset = 0) {
+  size_t const pixels = size_t(N) * H * W;
+  auto input = random_values<T>(pixels * c_in, 3, 8);
+
+  cutlass::DeviceAllocation<T> block_input, block_output;
+  T* output = to_device(block_output, poisoned<T>(pixels * c_out), offset);
+
+  cutlass::nhwc_padding<T>({N, H, W, c_in}, {N, H, W, c_out},
+    cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+      to_device(block_input, input, offset), cutlass::layout::TensorNHWC::packed({N, H, W, c_in})),
+    cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+      output, cutlass::layout::TensorNHWC::packed({N, H, W, c_out})),
+    nullptr);
+  syclcompat::wait();
+
+  std::vector<T> expected(pixels * c_out);
+  for (size_t p = 0; p < pixels; ++p) {
+    for (int c = 0; c < c_out; ++c) {
+      expected[p * c_out + c] = c < c_in ? input[p * c_in + c] : T(0);
+    }
+  }
+  EXPECT_TRUE(bitwise_equal(to_host(output, expected.size()), expected))
+    << "N " << N << " H " << H << " W " << W << " c_in " << c_in << " c_out " << c_out
+    << " offset " << offset;
+}
+
+/// Pooling window and strides of the pooling tests
+struct PoolingProblem {
+  cutlass::Tensor4DCoord input;  ///< (N, H, W, C)
+  int kernel_h;
+  int kernel_w;
+  int stride_h = 1;
+  int stride_w = 1;
+  int padding_h = 0;
+  int padding_w = 0;
+  int offset = 0;                ///< elements by which the input and output are shifted
+};
+
+/// Runs cutlass::pooling_nhwc() and checks it against a host reference. Average pooling divides
+/// by the full window, padding included, like the kernels.
+template <typename T>
+void run_pooling(PoolingProblem const& problem, int pooling_type) {
+  int const N = problem.input.n(), H = problem.input.h(), W = problem.input.w(), C = problem.input.c();
+  int const output_h = cutlass::getOutputSize(H, problem.padding_h, problem.kernel_h, problem.stride_h);
+  int const output_w = cutlass::getOutputSize(W, problem.padding_w, problem.kernel_w, problem.stride_w);
+  size_t const output_count = size_t(N) * output_h * output_w * C;
+
+  auto input = random_values<T>(size_t(N) * H * W * C, 4, 8);
+
+  cutlass::DeviceAllocation<T> block_input, block_output;
+  T* output = to_device(block_output, poisoned<T>(output_count), problem.offset);
+
+  cutlass::Tensor4DCoord const output_extent(N, output_h, output_w, C);
+  cutlass::pooling_nhwc<T>(problem.input, {1, problem.kernel_h, problem.kernel_w, C}, output_extent,
+    {0, problem.padding_h, problem.padding_w, 0}, {problem.stride_h, problem.stride_w},
+    cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+      to_device(block_input, input, problem.offset), cutlass::layout::TensorNHWC::packed(problem.input)),
+    cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+      output, cutlass::layout::TensorNHWC::packed(output_extent)),
+    pooling_type, nullptr);
+  syclcompat::wait();
+
+  auto result = to_host(output, output_count);
+
+  int mismatches = 0;
+  for (int n = 0; n < N; ++n) {
+    for (int oh = 0; oh < output_h; ++oh) {
+      for (int ow = 0; ow < output_w; ++ow) {
+        int const h_begin = std::max(0, oh * problem.stride_h - problem.padding_h);
+        int const h_end = std::min(H, oh * problem.stride_h - problem.padding_h + problem.kernel_h);
+        int const w_begin = std::max(0, ow * problem.stride_w - problem.padding_w);
+        int const w_end = std::min(W, ow * problem.stride_w - problem.padding_w + problem.kernel_w);
+
+        for (int c = 0; c < C; ++c) {
+          double expected = pooling_type == 0 ? 0.0 : -1e30;
+          for (int h = h_begin; h < h_end; ++h) {
+            for (int w = w_begin; w < w_end; ++w) {
+              double const x = float(input[((size_t(n) * H + h) * W + w) * C + c]);
+              expected = pooling_type == 0 ? expected + x : std::max(expected, x);
+            }
+          }
+          if (pooling_type == 0) {
+            expected /= problem.kernel_h * problem.kernel_w;
+          }
+          double const actual = float(result[((size_t(n) * output_h + oh) * output_w + ow) * C + c]);
+          double const tolerance = sizeof(T) == 2 ? 1e-2 * (std::abs(expected) + 1) : 1e-5;
+          mismatches += std::abs(actual - expected) > tolerance;
+        }
+      }
+    }
+  }
+  EXPECT_EQ(mismatches, 0) << "input " << problem.input << " kernel " << problem.kernel_h << "x"
+                           << problem.kernel_w << (pooling_type == 0 ? " avg" : " max")
+                           << " offset " << problem.offset;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Extents that are not multiples of the tile leave partial tiles in both dimensions
+TEST(SyclNchwToNhwc, float) {
+  run_nchw_to_nhwc<float>(2, 3, 5, 7, 3);
+  run_nchw_to_nhwc<float>(1, 64, 33, 17, 64);
+  run_nchw_to_nhwc<float>(3, 37, 1, 1, 37);
+}
+
+TEST(SyclNchwToNhwc, half_t) {
+  run_nchw_to_nhwc<cutlass::half_t>(2, 3, 5, 7, 3);
+  run_nchw_to_nhwc<cutlass::half_t>(1, 64, 33, 17, 64);
+  run_nchw_to_nhwc<cutlass::half_t>(2, 129, 3, 11, 129);
+}
+
+TEST(SyclNchwToNhwc, padded) {
+  run_nchw_to_nhwc<float>(2, 3, 5, 7, 4);
+  run_nchw_to_nhwc<cutlass::half_t>(2, 3, 9, 9, 8);
+  run_nchw_to_nhwc<cutlass::half_t>(1, 5, 13, 3, 40);
+}
+
+TEST(SyclNhwcToNchw, float) {
+  run_nhwc_to_nchw<float>(2, 5, 7, 3);
+  run_nhwc_to_nchw<float>(1, 33, 17, 64);
+  run_nhwc_to_nchw<float>(3, 1, 1, 37);
+}
+
+TEST(SyclNhwcToNchw, half_t) {
+  run_nhwc_to_nchw<cutlass::half_t>(2, 5, 7, 3);
+  run_nhwc_to_nchw<cutlass::half_t>(1, 33, 17, 64);
+  run_nhwc_to_nchw<cutlass::half_t>(2, 3, 11, 129);
+}
+
+// 3 to 4 and 3 to 8 channels take the staged kernel, unless the output is misaligned
+TEST(SyclNhwcPadding, three_channels) {
+  run_nhwc_padding<float>(2, 9, 11, 3, 4);
+  run_nhwc_padding<float>(2, 9, 11, 3, 8);
+  run_nhwc_padding<cutlass::half_t>(1, 17, 15, 3, 4);
+  run_nhwc_padding<cutlass::half_t>(1, 17, 15, 3, 8);
+  run_nhwc_padding<cutlass::half_t>(1, 17, 15, 3, 8, 1);
+}
+
+TEST(SyclNhwcPadding, other_channels) {
+  run_nhwc_padding<float>(2, 5, 7, 3, 16);
+  run_nhwc_padding<float>(2, 5, 7, 6, 10);
+  run_nhwc_padding<cutlass::half_t>(1, 7, 9, 8, 32);
+  run_nhwc_padding<cutlass::half_t>(1, 7, 9, 16, 24, 1);
+  run_nhwc_padding<cutlass::half_t>(1, 7, 9, 12, 12);
+}
+
+TEST(SyclPoolingNhwc, float) {
+  for (int pooling_type : {0, 1}) {
+    run_pooling<float>({{2, 9, 11, 3}, 3, 3, 2, 2, 1, 1}, pooling_type);
+    run_pooling<float>({{1, 8, 8, 64}, 2, 2, 2, 2}, pooling_type);
+    run_pooling<float>({{1, 7, 5, 20}, 3, 2, 1, 2, 1, 0, 1}, pooling_type);
+  }
+}
+
+TEST(SyclPoolingNhwc, half_t) {
+  for (int pooling_type : {0, 1}) {
+    run_pooling<cutlass::half_t>({{2, 9, 11, 3}, 3, 3, 2, 2, 1, 1}, pooling_type);
+    run_pooling<cutlass::half_t>({{1, 8, 8, 64}, 2, 2, 2, 2}, pooling_type);
+    run_pooling<cutlass::half_t>({{1, 7, 5, 24}, 3, 2, 1, 2, 1, 0, 1}, pooling_type);
+  }
+}
+
+// A window covering the whole unpadded image reduces every (batch, channels) pair in a work-group
+TEST(SyclPoolingNhwc, global) {
+  for (int pooling_type : {0, 1}) {
+    run_pooling<float>({{2, 7, 9, 5}, 7, 9}, pooling_type);
+    run_pooling<float>({{1, 32, 33, 16}, 32, 33}, pooling_type);
+    run_pooling<cutlass::half_t>({{3, 5, 5, 40}, 5, 5}, pooling_type);
+    run_pooling<cutlass::half_t>({{1, 16, 16, 8}, 16, 16, 1, 1, 0, 0, 1}, pooling_type);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,291 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the SYCL RMSNorm, LayerNorm and GroupNorm kernels against host references
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+#include "sycl_test_utils.h"
+
+#include "cutlass/core_io.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/sycl_groupnorm.h"
+#include "cutlass/util/sycl_layernorm.h"
+#include "cutlass/util/sycl_rmsnorm.h"
+
+namespace {
+
+using test::util::to_device;
+using test::util::to_host;
+
+/// Quarter steps in [-range, range], exactly representable in every tested type
+template <typename T>
+std::vector<T> random_values(size_t count, uint32_t seed, int range) {
+  std::vector<T> values(count);
+  for (auto& value : values) {
+    seed = seed * 1664525u + 1013904223u;
+    value = T(float(int((seed >> 16) % uint32_t(8 * range + 1)) - 4 * range) / 4.0f);
+  }
+  return values;
+}
+
+/// Half precision outputs keep about three significant digits
+template <typename T>
+double tolerance(double expected) {
+  double const epsilon = sizeof(T) == 2 ? 1e-2 : 1e-4;
+  return epsilon * (std::abs(expected) + 1);
+}
+
+/// Runs cutlass::rmsnorm() on an m-by-n row-major tensor and checks it against a host reference
+template <typename T>
+void run_rmsnorm(int m, int n, int offset = 0) {
+  using Layout = cutlass::layout::RowMajor;
+  float const epsilon = 1e-5f;
+
+  auto input = random_values<T>(size_t(m) * n, 1, 4);
+  auto weight = random_values<T>(n, 2, 2);
+
+  cutlass::DeviceAllocation<T> block_output, block_input, block_weight;
+  T* output = to_device(block_output, std::vector<T>(size_t(m) * n), offset);
+
+  cutlass::rmsnorm<T>({m, n},
+    cutlass::TensorRef<T, Layout>(output, Layout(n)),
+    cutlass::TensorRef<T, Layout>(to_device(block_input, input, offset), Layout(n)),
+    cutlass::TensorRef<T, Layout>(to_device(block_weight, weight, offset), Layout(n)),
+    nullptr, epsilon);
+  syclcompat::wait();
+
+  auto result = to_host(output, size_t(m) * n);
+
+  int mismatches = 0;
+  for (int i = 0; i < m; ++i) {
+    double sum_squares = 0;
+    for (int j = 0; j < n; ++j) {
+      double const x = float(input[size_t(i) * n + j]);
+      sum_squares += x * x;
+    }
+    double const rms = 1.0 / std::sqrt(sum_squares / n + epsilon);
+    for (int j = 0; j < n; ++j) {
+      double const expected = double(float(input[size_t(i) * n + j])) * rms * double(float(weight[j]));
+      mismatches += std::abs(double(float(result[size_t(i) * n + j])) - expected) > tolerance<T>(expected);
+    }
+  }
+  EXPECT_EQ(mismatches, 0) << "m " << m << " n " << n << " offset " << offset;
+}
+
+/// Runs cutlass::layernorm() on an m-by-n row-major tensor and checks it against a host reference
+template <typename T>
+void run_layernorm(int m, int n, int offset = 0) {
+  using Layout = cutlass::layout::RowMajor;
+
+  auto input = random_values<T>(size_t(m) * n, 3, 4);
+  auto gamma = random_values<T>(n, 4, 2);
+  auto beta = random_values<T>(n, 5, 2);
+
+  cutlass::DeviceAllocation<T> block_output, block_input, block_gamma, block_beta;
+  T* output = to_device(block_output, std::vector<T>(size_t(m) * n), offset);
+
+  cutlass::layernorm<T>({m, n},
+    cutlass::TensorRef<T, Layout>(output, Layout(n)),
+    cutlass::TensorRef<T, Layout>(to_device(block_input, input, offset), Layout(n)),
+    cutlass::TensorRef<T, Layout>(to_device(block_gamma, gamma, offset), Layout(n)),
+    cutlass::TensorRef<T, Layout>(to_device(block_beta, beta, offset), Layout(n)),
+    nullptr);
+  syclcompat::wait();
+
+  auto result = to_host(output, size_t(m) * n);
+
+  int mismatches = 0;
+  for (int i = 0; i < m; ++i) {
+    double mean = 0, variance = 0;
+    for (int j = 0; j < n; ++j) {
+      mean += float(input[size_t(i) * n + j]);
+    }
+    mean /= n;
+    for (int j = 0; j < n; ++j) {
+      double const x = double(float(input[size_t(i) * n + j])) - mean;
+      variance += x * x;
+    }
+    double const rstd = 1.0 / std::sqrt(variance / n + 1e-5);
+    for (int j = 0; j < n; ++j) {
+      double const x = float(input[size_t(i) * n + j]);
+      double const expected = (x - mean) * rstd * double(float(gamma[j])) + double(float(beta[j]));
+      mismatches += std::abs(double(float(result[size_t(i) * n + j])) - expected) > tolerance<T>(expected);
+    }
+  }
+  EXPECT_EQ(mismatches, 0) << "m " << m << " n " << n << " offset " << offset;
+}
+
+/// Runs cutlass::groupnorm() on an NHWC tensor and checks it against a host reference
+template <typename T>
+void run_groupnorm(cutlass::Tensor4DCoord extent, int groups, int offset = 0) {
+  using Layout = cutlass::layout::TensorNHWC;
+  float const epsilon = 1e-5f;
+  int const N = extent.n(), C = extent.c();
+  int const channels_per_group = C / groups;
+  size_t const pixels = size_t(extent.h()) * extent.w();
+  size_t const count = size_t(N) * pixels * C;
+
+  auto input = random_values<T>(count, 6, 4);
+  auto gamma = random_values<T>(C, 7, 2);
+  auto beta = random_values<T>(C, 8, 2);
+
+  cutlass::DeviceAllocation<T> block_output, block_input, block_gamma, block_beta;
+  T* output = to_device(block_output, std::vector<T>(count), offset);
+
+  Layout const layout = Layout::packed(extent);
+  Layout const channel_layout = Layout::packed({1, 1, 1, C});
+  cutlass::groupnorm<T>(extent, groups, epsilon,
+    cutlass::TensorRef<T, Layout>(output, layout),
+    cutlass::TensorRef<T, Layout>(to_device(block_input, input, offset), layout),
+    cutlass::TensorRef<T, Layout>(to_device(block_gamma, gamma, offset), channel_layout),
+    cutlass::TensorRef<T, Layout>(to_device(block_beta, beta, offset), channel_layout),
+    nullptr);
+  syclcompat::wait();
+
+  auto result = to_host(output, count);
+
+  int mismatches = 0;
+  for (int n = 0; n < N; ++n) {
+    for (int g = 0; g < groups; ++g) {
+      auto index = [&](size_t p, int c) {
+        return (size_t(n) * pixels + p) * C + g * channels_per_group + c;
+      };
+      double const elements = double(pixels) * channels_per_group;
+
+      double mean = 0, variance = 0;
+      for (size_t p = 0; p < pixels; ++p) {
+        for (int c = 0; c < channels_per_group; ++c) {
+          mean += float(input[index(p, c)]);
+        }
+      }
+      mean /= elements;
+      for (size_t p = 0; p < pixels; ++p) {
+        for (int c = 0; c < channels_per_group; ++c) {
+          double const x = double(float(input[index(p, c)])) - mean;
+          variance += x * x;
+        }
+      }
+      double const rstd = 1.0 / std::sqrt(variance / elements + epsilon);
+
+      for (size_t p = 0; p < pixels; ++p) {
+        for (int c = 0; c < channels_per_group; ++c) {
+          int const channel = g * channels_per_group + c;
+          double const x = float(input[index(p, c)]);
+          double const expected = (x - mean) * rstd * double(float(gamma[channel])) + double(float(beta[channel]));
+          mismatches += std::abs(double(float(result[index(p, c)])) - expected) > tolerance<T>(expected);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(mismatches, 0) << "extent " << extent << " groups " << groups << " offset " << offset;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SyclRmsNorm, float) {
+  run_rmsnorm<float>(16, 1024);
+  run_rmsnorm<float>(3, 127);
+  run_rmsnorm<float>(5, 130);
+  run_rmsnorm<float>(1, 1);
+}
+
+TEST(SyclRmsNorm, half_t) {
+  run_rmsnorm<cutlass::half_t>(16, 1024);
+  run_rmsnorm<cutlass::half_t>(3, 127);
+  run_rmsnorm<cutlass::half_t>(5, 130);
+  run_rmsnorm<cutlass::half_t>(7, 4100);
+}
+
+// Shifted pointers limit every access to a single element
+TEST(SyclRmsNorm, unaligned) {
+  run_rmsnorm<float>(4, 1024, 1);
+  run_rmsnorm<cutlass::half_t>(4, 1026, 1);
+}
+
+// Rows of more than 16 vectors per work-item of the largest work-group are reloaded
+TEST(SyclRmsNorm, wide_rows) {
+  run_rmsnorm<float>(2, 70000);
+  run_rmsnorm<cutlass::half_t>(2, 20000, 1);
+}
+
+TEST(SyclLayerNorm, float) {
+  run_layernorm<float>(16, 1024);
+  run_layernorm<float>(3, 127);
+  run_layernorm<float>(5, 130);
+}
+
+TEST(SyclLayerNorm, half_t) {
+  run_layernorm<cutlass::half_t>(16, 1024);
+  run_layernorm<cutlass::half_t>(3, 127);
+  run_layernorm<cutlass::half_t>(5, 130);
+  run_layernorm<cutlass::half_t>(7, 4100);
+}
+
+TEST(SyclLayerNorm, unaligned) {
+  run_layernorm<float>(4, 1024, 1);
+  run_layernorm<cutlass::half_t>(4, 1026, 1);
+}
+
+TEST(SyclLayerNorm, wide_rows) {
+  run_layernorm<float>(2, 70000);
+  run_layernorm<cutlass::half_t>(2, 20000, 1);
+}
+
+TEST(SyclGroupNorm, float) {
+  run_groupnorm<float>({2, 8, 8, 32}, 4);
+  run_groupnorm<float>({2, 5, 7, 12}, 3);
+  run_groupnorm<float>({1, 9, 9, 30}, 5);
+}
+
+TEST(SyclGroupNorm, half_t) {
+  run_groupnorm<cutlass::half_t>({2, 8, 8, 64}, 2);
+  run_groupnorm<cutlass::half_t>({2, 5, 7, 12}, 3);
+  run_groupnorm<cutlass::half_t>({1, 9, 9, 30}, 5);
+}
+
+TEST(SyclGroupNorm, unaligned) {
+  run_groupnorm<float>({2, 8, 8, 32}, 4, 1);
+  run_groupnorm<cutlass::half_t>({2, 8, 8, 64}, 2, 1);
+}
+
+TEST(SyclGroupNorm, wide_groups) {
+  run_groupnorm<float>({1, 128, 128, 32}, 2);
+  run_groupnorm<cutlass::half_t>({1, 64, 64, 32}, 2, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
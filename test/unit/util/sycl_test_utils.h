@@ -0,0 +1,62 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Helpers shared by the unit tests of the SYCL utilities
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "cutlass/util/device_memory.h"
+
+namespace test {
+namespace util {
+
+/// Copies host values to a device buffer starting `offset` elements into it. A non-zero offset
+/// misaligns the returned pointer for every vector access wider than one element.
+template <typename T>
+T* to_device(cutlass::DeviceAllocation<T>& block, std::vector<T> const& values, int offset) {
+  block.reset(values.size() + offset);
+  cutlass::device_memory::copy_to_device(block.get() + offset, values.data(), values.size());
+  return block.get() + offset;
+}
+
+/// Copies count elements of device memory back to the host
+template <typename T>
+std::vector<T> to_host(T const* ptr, size_t count) {
+  std::vector<T> values(count);
+  cutlass::device_memory::copy_to_host(values.data(), ptr, count);
+  return values;
+}
+
+} // namespace util
+} // namespace test
@@ -0,0 +1,359 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the serial and parallel policies of the host TensorForEach and BlockForEach
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/layout/matrix.h"
+#include "cutlass/tensor_view.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_foreach.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
+
+using Layout = cutlass::layout::RowMajor;
+
+namespace {
+
+/// Runs func over a rows-by-columns tensor under the given policy and returns its contents
+template <typename Element, template <typename, typename> class FillFunc, typename RandomFunc>
+std::vector<Element> fill_tensor(
+  int rows, int columns, RandomFunc const &random_func, cutlass::reference::host::ForEachPolicy policy) {
+
+  std::vector<Element> data(size_t(rows) * columns, Element(-1));
+  cutlass::TensorView<Element, Layout> view(
+    data.data(), Layout::packed({rows, columns}), {rows, columns});
+
+  FillFunc<Element, Layout> func(view, random_func);
+  cutlass::reference::host::TensorForEach(view.extent(), func, policy);
+  return data;
+}
+
+/// Adapts a random functor to the Params-based construction of BlockForEach
+template <typename RandomFunc>
+struct BlockRandomFunc {
+
+  using Params = RandomFunc;
+
+  static bool const kParallelSafe = true;
+
+  RandomFunc func;
+
+  BlockRandomFunc(Params const &params): func(params) { }
+
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
+  auto operator()() {
+    return func();
+  }
+};
+
+/// Counts the points it visits. Not parallel safe.
+struct CountingFunc {
+  int64_t count = 0;
+  std::thread::id thread = std::this_thread::get_id();
+  bool foreign_thread = false;
+
+  void operator()(cutlass::Coord<2> const &) {
+    ++count;
+    foreign_thread |= (std::this_thread::get_id() != thread);
+  }
+};
+
+template <typename Element>
+bool bitwise_equal(std::vector<Element> const &lhs, std::vector<Element> const &rhs) {
+  return lhs.size() == rhs.size() &&
+    !std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(Element));
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using cutlass::reference::host::ForEachPolicy;
+
+TEST(TensorForEach, uniform_fill_keeps_std_rand_sequence) {
+  int const rows = 600;
+  int const columns = 300;
+  std::vector<float> filled(rows * columns), expected(rows * columns);
+
+  // Large enough for the default policy to consider running in parallel
+  cutlass::TensorView<float, Layout> view(filled.data(), Layout::packed({rows, columns}), {rows, columns});
+  cutlass::reference::host::TensorFillRandomUniform(view, 11, 8, -8, 0);
+
+  std::srand(11);
+  for (auto &value : expected) {
+    double rnd = -8 + 16 * (double(std::rand()) / double(RAND_MAX));
+    value = float(double(std::llround(rnd)));
+  }
+
+  EXPECT_TRUE(bitwise_equal(filled, expected));
+}
+
+TEST(TensorForEach, gaussian_block_fill_keeps_std_rand_sequence) {
+  size_t const capacity = 5 * 16384 + 3;
+  std::vector<double> filled(capacity), expected(capacity);
+
+  cutlass::reference::host::BlockFillRandomGaussian(filled.data(), capacity, 5, 1, 3);
+
+  double const pi = std::acos(-1);
+  std::srand(5);
+  for (auto &value : expected) {
+    double u1 = double(std::rand()) / double(RAND_MAX);
+    double u2 = double(std::rand()) / double(RAND_MAX);
+    value = 1 + 3 * (std::sqrt(-2 * std::log(u1)) * std::cos(2 * pi * u2));
+  }
+
+  EXPECT_TRUE(bitwise_equal(filled, expected));
+}
+
+TEST(TensorForEach, uniform_fill_parallel_matches_blocked_serial) {
+  using RandomFunc = cutlass::reference::host::detail::RandomUniformFunc<float>;
+  using FillFunc = cutlass::reference::host::detail::TensorFillRandomUniformFunc<float, Layout>;
+
+  // Odd extents so the last block is partial
+  int const rows = 517;
+  int const columns = 333;
+  RandomFunc random_func(2024, 4, -4, -1, 0.01);
+
+  auto parallel = fill_tensor<float, cutlass::reference::host::detail::TensorFillRandomUniformFunc>(
+    rows, columns, random_func, ForEachPolicy::kParallel);
+  auto again = fill_tensor<float, cutlass::reference::host::detail::TensorFillRandomUniformFunc>(
+    rows, columns, random_func, ForEachPolicy::kParallel);
+
+  // Every block of whole rows draws from the stream of its block index
+  std::vector<float> expected(size_t(rows) * columns, -1.f);
+  cutlass::TensorView<float, Layout> view(expected.data(), Layout::packed({rows, columns}), {rows, columns});
+  int const rows_per_block = int(cutlass::reference::host::detail::kForEachBlockSize / columns);
+  for (int row_begin = 0; row_begin < rows; row_begin += rows_per_block) {
+    FillFunc func(view, random_func);
+    func.seed_block(row_begin / rows_per_block);
+    for (int i = row_begin; i < std::min(rows, row_begin + rows_per_block); ++i) {
+      for (int j = 0; j < columns; ++j) {
+        func(cutlass::make_Coord(i, j));
+      }
+    }
+  }
+
+  EXPECT_TRUE(bitwise_equal(parallel, again));
+  EXPECT_TRUE(bitwise_equal(parallel, expected));
+}
+
+TEST(TensorForEach, gaussian_fill_parallel_is_reproducible) {
+  cutlass::reference::host::detail::RandomGaussianFunc<double> random_func(7, 1, 2, -1, 0.5);
+
+  auto first = fill_tensor<double, cutlass::reference::host::detail::TensorFillGaussianFunc>(
+    1031, 129, random_func, ForEachPolicy::kParallel);
+  auto second = fill_tensor<double, cutlass::reference::host::detail::TensorFillGaussianFunc>(
+    1031, 129, random_func, ForEachPolicy::kParallel);
+
+  EXPECT_TRUE(bitwise_equal(first, second));
+
+  // pnz = 0.5 zeroes roughly half of the elements
+  size_t zeros = 0;
+  for (double value : first) {
+    zeros += (value == 0);
+  }
+  EXPECT_GT(zeros, first.size() / 4);
+  EXPECT_LT(zeros, 3 * first.size() / 4);
+}
+
+TEST(TensorForEach, seeded_fill_is_reproducible) {
+  std::vector<float> first(600 * 300), second(600 * 300), other(600 * 300);
+
+  cutlass::TensorView<float, Layout> first_view(first.data(), Layout::packed({600, 300}), {600, 300});
+  cutlass::TensorView<float, Layout> second_view(second.data(), Layout::packed({600, 300}), {600, 300});
+  cutlass::TensorView<float, Layout> other_view(other.data(), Layout::packed({600, 300}), {600, 300});
+
+  cutlass::reference::host::TensorFillRandomUniform(first_view, 11, 8, -8, 0);
+  cutlass::reference::host::TensorFillRandomUniform(second_view, 11, 8, -8, 0);
+  cutlass::reference::host::TensorFillRandomUniform(other_view, 12, 8, -8, 0);
+
+  EXPECT_TRUE(bitwise_equal(first, second));
+  EXPECT_FALSE(bitwise_equal(first, other));
+}
+
+TEST(TensorForEach, stateful_functor_is_visited_serially) {
+  CountingFunc func;
+  cutlass::reference::host::TensorForEach(cutlass::Coord<2>({700, 300}), func, ForEachPolicy::kParallel);
+
+  EXPECT_EQ(func.count, int64_t(700) * 300);
+  EXPECT_FALSE(func.foreign_thread);
+}
+
+TEST(TensorForEach, parallel_safe_lambda) {
+  std::vector<int> data(900 * 257, 0);
+
+  cutlass::reference::host::TensorForEachLambda(
+    cutlass::Coord<2>({900, 257}),
+    cutlass::reference::host::make_parallel_safe([&](cutlass::Coord<2> const &coord) {
+      data[size_t(coord[0]) * 257 + coord[1]] = coord[0] * 1000 + coord[1];
+    }),
+    ForEachPolicy::kParallel);
+
+  size_t mismatches = 0;
+  for (int i = 0; i < 900; ++i) {
+    for (int j = 0; j < 257; ++j) {
+      mismatches += (data[size_t(i) * 257 + j] != i * 1000 + j);
+    }
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+TEST(BlockForEach, uniform_fill_parallel_matches_blocked_serial) {
+  using RandomFunc = cutlass::reference::host::detail::RandomUniformFunc<float>;
+  using Func = BlockRandomFunc<RandomFunc>;
+  typename Func::Params params(99, 1, -1);
+
+  size_t const capacity = 5 * 16384 + 123;
+  std::vector<float> parallel(capacity), expected(capacity);
+
+  cutlass::reference::host::BlockForEach<float, Func>(
+    parallel.data(), capacity, params, ForEachPolicy::kParallel);
+
+  for (size_t begin = 0; begin < capacity; begin += 16384) {
+    RandomFunc func(params);
+    func.seed_block(int64_t(begin / 16384));
+    for (size_t i = begin; i < std::min(capacity, begin + 16384); ++i) {
+      expected[i] = func();
+    }
+  }
+
+  EXPECT_TRUE(bitwise_equal(parallel, expected));
+
+  // Blocks draw from different streams
+  EXPECT_NE(std::memcmp(parallel.data(), parallel.data() + 16384, 16384 * sizeof(float)), 0);
+}
+
+TEST(BlockForEach, gaussian_parallel_block_fill_matches_block_for_each) {
+  size_t const capacity = 3 * 16384 + 77;
+  std::vector<float> filled(capacity), expected(capacity);
+
+  cutlass::reference::host::BlockFillRandomGaussian(
+    filled.data(), capacity, 5, 0, 3, -1, 1.0, ForEachPolicy::kParallel);
+
+  using Func = BlockRandomFunc<cutlass::reference::host::detail::RandomGaussianFunc<float>>;
+  typename Func::Params params(5, 0, 3);
+  cutlass::reference::host::BlockForEach<float, Func>(
+    expected.data(), capacity, params, ForEachPolicy::kParallel);
+
+  EXPECT_TRUE(bitwise_equal(filled, expected));
+}
+
+TEST(HostParallel, parallel_for_reuses_threads) {
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  std::vector<int> visits(1000, 0);
+
+  for (int call = 0; call < 50; ++call) {
+    cutlass::reference::detail::parallel_for(1000, [&](int64_t i) {
+      visits[i] += 1;
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert(std::this_thread::get_id());
+    });
+  }
+
+  for (int v : visits) {
+    EXPECT_EQ(v, 50);
+  }
+  // Every call shares the same workers plus the calling thread
+  EXPECT_LE(ids.size(), size_t(cutlass::reference::detail::host_thread_count()));
+}
+
+TEST(HostParallel, scoped_thread_count) {
+  auto thread_ids = [](int threads) {
+    cutlass::reference::detail::ScopedHostThreadCount thread_count(threads);
+    EXPECT_EQ(cutlass::reference::detail::host_thread_count(), threads);
+
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    cutlass::reference::detail::parallel_for(4096, [&](int64_t) {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert(std::this_thread::get_id());
+    });
+    return ids;
+  };
+
+  int const default_count = cutlass::reference::detail::host_thread_count();
+
+  std::set<std::thread::id> serial = thread_ids(1);
+  ASSERT_EQ(serial.size(), size_t(1));
+  EXPECT_EQ(*serial.begin(), std::this_thread::get_id());
+
+  // The pool starts workers on demand, whatever the hardware concurrency
+  std::set<std::thread::id> threaded = thread_ids(4);
+  EXPECT_GT(threaded.size(), size_t(1));
+  EXPECT_LE(threaded.size(), size_t(4));
+
+  EXPECT_EQ(cutlass::reference::detail::host_thread_count(), default_count);
+}
+
+TEST(HostParallel, nested_and_concurrent_parallel_for) {
+  std::vector<std::atomic<int>> visits(64 * 64);
+  for (auto& v : visits) {
+    v = 0;
+  }
+
+  auto nested = [&]() {
+    cutlass::reference::detail::parallel_for(64, [&](int64_t i) {
+      cutlass::reference::detail::parallel_for(64, [&](int64_t j) {
+        ++visits[i * 64 + j];
+      });
+    });
+  };
+
+  std::thread other(nested);
+  nested();
+  other.join();
+
+  size_t mismatches = 0;
+  for (auto& v : visits) {
+    mismatches += (v != 2);
+  }
+  EXPECT_EQ(mismatches, size_t(0));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
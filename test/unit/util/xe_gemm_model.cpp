@@ -0,0 +1,210 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests the occupancy, wave and ranking arithmetic of the analytic Xe GEMM model
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/xe_gemm_model.hpp"
+
+using cutlass::gemm::XeDeviceModel;
+using cutlass::gemm::XeGemmConfig;
+using cutlass::gemm::XeGemmProblem;
+
+namespace {
+
+XeGemmConfig make_config(int tile_m, int tile_n, int sg_layout_m, int sg_layout_n, int sg_layout_k = 1) {
+  XeGemmConfig config;
+  config.tile_m = tile_m;
+  config.tile_n = tile_n;
+  config.sg_layout_m = sg_layout_m;
+  config.sg_layout_n = sg_layout_n;
+  config.sg_layout_k = sg_layout_k;
+  return config;
+}
+
+XeGemmProblem make_problem(int64_t m, int64_t n, int64_t k, int64_t batch = 1) {
+  XeGemmProblem problem;
+  problem.m = m;
+  problem.n = n;
+  problem.k = k;
+  problem.batch = batch;
+  return problem;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 32x64 f32 accumulators per subgroup need 8 KiB on their own, so the 256-register mode halves
+// the hardware threads and a 32-subgroup work-group fills the Xe-core
+TEST(XeGemmModel, large_grf_occupancy) {
+  auto prediction = cutlass::gemm::predict_xe_gemm(
+    make_problem(4096, 4096, 4096), make_config(256, 256, 8, 4), XeDeviceModel::pvc_1550_stack());
+
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_TRUE(prediction.large_grf);
+  EXPECT_EQ(prediction.work_groups_per_xe_core, 1);
+  EXPECT_DOUBLE_EQ(prediction.occupancy, 1.0);
+  EXPECT_EQ(prediction.work_groups, 16 * 16);
+}
+
+// A subgroup tile of exactly 8 KiB still fits the default register file
+TEST(XeGemmModel, default_grf_occupancy) {
+  auto device = XeDeviceModel::pvc_1550_stack();
+
+  auto prediction = cutlass::gemm::predict_xe_gemm(
+    make_problem(4096, 4096, 4096), make_config(128, 128, 4, 4), device);
+
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_FALSE(prediction.large_grf);
+  EXPECT_EQ(prediction.work_groups_per_xe_core, 4);
+  EXPECT_DOUBLE_EQ(prediction.occupancy, 1.0);
+
+  // 64 hardware threads per Xe-core hold 21 work-groups of 3 subgroups, one thread stays idle
+  prediction = cutlass::gemm::predict_xe_gemm(
+    make_problem(4096, 4096, 4096), make_config(96, 32, 3, 1), device);
+
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_FALSE(prediction.large_grf);
+  EXPECT_EQ(prediction.work_groups_per_xe_core, 21);
+  EXPECT_DOUBLE_EQ(prediction.occupancy, 63.0 / 64.0);
+}
+
+TEST(XeGemmModel, waves) {
+  auto device = XeDeviceModel::pvc_1550_stack();
+  auto config = make_config(128, 128, 4, 4);
+
+  // 32 x 32 work-groups on 64 Xe-cores with 4 slots each
+  auto prediction = cutlass::gemm::predict_xe_gemm(make_problem(4096, 4096, 1024), config, device);
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_EQ(prediction.work_groups, 1024);
+  EXPECT_DOUBLE_EQ(prediction.waves, 4.0);
+  EXPECT_DOUBLE_EQ(prediction.wave_efficiency, 1.0);
+
+  // One more column of tiles starts a fifth, mostly empty wave
+  prediction = cutlass::gemm::predict_xe_gemm(make_problem(4096, 4096 + 1, 1024), config, device);
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_EQ(prediction.work_groups, 32 * 33);
+  EXPECT_DOUBLE_EQ(prediction.waves, 4.125);
+  EXPECT_DOUBLE_EQ(prediction.wave_efficiency, 4.125 / 5.0);
+
+  // Batches multiply the work-groups
+  prediction = cutlass::gemm::predict_xe_gemm(make_problem(256, 256, 1024, 3), config, device);
+  ASSERT_TRUE(prediction.valid);
+  EXPECT_EQ(prediction.work_groups, 2 * 2 * 3);
+  EXPECT_DOUBLE_EQ(prediction.flops, 2.0 * 256 * 256 * 1024 * 3);
+}
+
+TEST(XeGemmModel, invalid_configurations) {
+  auto device = XeDeviceModel::pvc_1550_stack();
+  auto problem = make_problem(1024, 1024, 1024);
+
+  // 128 subgroups of 16 work-items exceed 1024 work-items
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(256, 256, 8, 8, 2), device).valid);
+
+  // 128x128 f32 accumulators per subgroup exceed the 256-register mode
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(512, 512, 4, 4), device).valid);
+
+  // 64 subgroups in the 256-register mode exceed the 32 hardware threads of an Xe-core
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(512, 512, 8, 8), device).valid);
+
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(make_problem(0, 1024, 1024), make_config(256, 256, 8, 4), device).valid);
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(make_problem(1024, 1024, 1024, 0), make_config(256, 256, 8, 4), device).valid);
+}
+
+// Empty tiles and subgroup layouts would divide by zero, and no prefetch stages cover no latency
+TEST(XeGemmModel, degenerate_configurations) {
+  auto device = XeDeviceModel::pvc_1550_stack();
+  auto problem = make_problem(1024, 1024, 1024);
+
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(0, 256, 8, 4), device).valid);
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(256, 0, 8, 4), device).valid);
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(256, 256, 0, 4), device).valid);
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(256, 256, 8, 0), device).valid);
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, make_config(256, 256, 8, 4, 0), device).valid);
+
+  XeGemmConfig config = make_config(256, 256, 8, 4);
+  config.tile_k = 0;
+  EXPECT_FALSE(cutlass::gemm::predict_xe_gemm(problem, config, device).valid);
+
+  config = make_config(256, 256, 8, 4);
+  config.stages = 0;
+  auto prediction = cutlass::gemm::predict_xe_gemm(problem, config, device);
+  EXPECT_FALSE(prediction.valid);
+  EXPECT_FALSE(prediction.reason.empty());
+
+  // None of them is ever selected
+  std::vector<XeGemmConfig> candidates{config, make_config(0, 256, 8, 4), make_config(256, 256, 8, 4)};
+  EXPECT_EQ(cutlass::gemm::select_xe_gemm_config(problem, candidates, device), 2);
+}
+
+TEST(XeGemmModel, ranking) {
+  std::vector<XeGemmConfig> candidates = {
+    make_config(256, 256, 8, 4),
+    make_config(512, 512, 4, 4),            // cannot be launched
+    make_config(128, 128, 4, 4),
+    make_config(128, 256, 4, 8),
+  };
+
+  auto problem = make_problem(512, 512, 4096);
+  auto ranking = cutlass::gemm::rank_xe_gemm_configs(problem, candidates);
+
+  ASSERT_EQ(ranking.size(), size_t(3));
+  for (size_t i = 0; i < ranking.size(); ++i) {
+    EXPECT_NE(ranking[i].index, 1);
+    EXPECT_TRUE(ranking[i].prediction.valid);
+    if (i > 0) {
+      EXPECT_LE(ranking[i - 1].prediction.time_us, ranking[i].prediction.time_us);
+    }
+  }
+
+  // 4 large tiles leave 60 of the 64 Xe-cores idle, 16 smaller tiles spread further
+  EXPECT_EQ(cutlass::gemm::select_xe_gemm_config(problem, candidates), 2);
+  EXPECT_EQ(ranking.front().index, 2);
+}
+
+TEST(XeGemmModel, ranking_without_valid_candidates) {
+  std::vector<XeGemmConfig> candidates = {
+    make_config(512, 512, 4, 4),
+    make_config(256, 256, 8, 8, 2),
+  };
+
+  auto problem = make_problem(1024, 1024, 1024);
+  EXPECT_TRUE(cutlass::gemm::rank_xe_gemm_configs(problem, candidates).empty());
+  EXPECT_EQ(cutlass::gemm::select_xe_gemm_config(problem, candidates), -1);
+  EXPECT_EQ(cutlass::gemm::select_xe_gemm_config(problem, {}), -1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
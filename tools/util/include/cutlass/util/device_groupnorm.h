@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_groupnorm.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels to do group norm on a device memory tensor with NHWC layout. The tensor will be divided into [N, H, W, G, C'] and then we do normalization on [H, W, C'].
@@ -400,3 +404,5 @@ void groupnorm(cutlass::Tensor4DCoord input_size,
 }
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_layernorm.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels to do layernorm on a device memory tensor with RowMajor layout.
@@ -642,3 +646,5 @@ void layernorm(cutlass::MatrixCoord tensor_size,
 }
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
@@ -36,8 +36,17 @@
  * \brief C++ interface to CUDA device memory management functions.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "cutlass/platform/platform.h"
 #include "cutlass/numeric_types.h"
@@ -51,25 +60,23 @@ namespace device_memory {
  * Allocation lifetime
  ******************************************************************************/
 
-/// Allocate a buffer of \p count elements of type \p T on the current CUDA device
-template <typename T>
-T* allocate(size_t count = 1) {
+namespace detail {
 
-  T* ptr = 0;
-  size_t bytes = 0;
+/// Allocate \p bytes bytes on the current device, bypassing the caching allocator
+inline void* allocate_bytes(size_t bytes) {
 
-  bytes = count * sizeof(T);
+  void* ptr = nullptr;
 
 #if defined(CUTLASS_ENABLE_SYCL)
-  if (count > 0) {
-    ptr = reinterpret_cast<T*>(syclcompat::malloc(bytes));
-    if ((void*)ptr == nullptr) {
+  if (bytes > 0) {
+    ptr = syclcompat::malloc(bytes);
+    if (ptr == nullptr) {
       throw std::runtime_error("Failed to allocate memory");
     }
   }
 #else
 
-  cudaError_t cuda_error = cudaMalloc((void**)&ptr, bytes);
+  cudaError_t cuda_error = cudaMalloc(&ptr, bytes);
 
   if (cuda_error != cudaSuccess) {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
@@ -90,24 +97,492 @@ T* allocate(size_t count = 1) {
   return ptr;
 }
 
+/// Free device memory obtained from allocate_bytes()
+inline void free_bytes(void* ptr) {
+  if (ptr) {
+#if defined(CUTLASS_ENABLE_SYCL)
+    syclcompat::free(ptr);
+#else
+    cudaError_t cuda_error = (cudaFree(ptr));
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("Failed to free device memory", cuda_error);
+    }
+#endif
+  }
+}
+
+} // namespace detail
+
+/// Completion handle of work enqueued on a stream, such as an asynchronous copy.
+/// Default-constructed handles are complete.
+class copy_event {
+public:
+
+  copy_event() = default;
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  explicit copy_event(sycl::event event): event_(event) {}
+
+  /// Returns the underlying SYCL event, e.g. to add it as a dependency of a later command
+  sycl::event const& get() const { return event_; }
+
+  /// Blocks until the copy has completed
+  void wait() { event_.wait(); }
+
+  /// Returns true if the copy has completed
+  bool query() const {
+    return event_.get_info<sycl::info::event::command_execution_status>() ==
+           sycl::info::event_command_status::complete;
+  }
+
+private:
+  sycl::event event_;
+#else
+  /// Records an event on \p stream after the work submitted so far
+  explicit copy_event(cudaStream_t stream) {
+    cudaEvent_t event;
+    cudaError_t cuda_error = cudaEventCreateWithFlags(&event, cudaEventDisableTiming);
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("cutlass::device_memory::copy_event: cudaEventCreateWithFlags() failed", cuda_error);
+    }
+    event_.reset(event, [](cudaEvent_t e) { cudaEventDestroy(e); });
+    cuda_error = cudaEventRecord(event, stream);
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("cutlass::device_memory::copy_event: cudaEventRecord() failed", cuda_error);
+    }
+  }
+
+  /// Returns the underlying CUDA event, or nullptr if the handle is complete
+  cudaEvent_t get() const { return event_.get(); }
+
+  /// Blocks until the copy has completed
+  void wait() {
+    if (event_) {
+      cudaError_t cuda_error = cudaEventSynchronize(event_.get());
+      if (cuda_error != cudaSuccess) {
+        throw cuda_exception("cutlass::device_memory::copy_event: cudaEventSynchronize() failed", cuda_error);
+      }
+    }
+  }
+
+  /// Returns true if the copy has completed
+  bool query() const {
+    if (!event_) {
+      return true;
+    }
+    cudaError_t cuda_error = cudaEventQuery(event_.get());
+    if (cuda_error == cudaErrorNotReady) {
+      return false;
+    }
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("cutlass::device_memory::copy_event: cudaEventQuery() failed", cuda_error);
+    }
+    return true;
+  }
+
+private:
+  std::shared_ptr<CUevent_st> event_;
+#endif
+};
+
+/// Caching allocator for device memory. Freed blocks are kept in size classes and handed out
+/// again instead of being returned to the driver, which removes the cost of repeated
+/// malloc/free pairs of the same sizes. The allocator is disabled by default; enable it with
+/// caching_allocator::instance().enable() or by setting CUTLASS_DEVICE_MEMORY_POOL=1.
+///
+/// Blocks are reused in stream order: a block released on a stream is handed out again on the
+/// same stream right away, and on another stream once the work enqueued before its release has
+/// completed. In SYCL builds the stream is a queue, null selecting the default queue. Only
+/// in-order queues reuse their own blocks right away.
+class caching_allocator {
+public:
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  using stream_type = sycl::queue*;
+#else
+  using stream_type = cudaStream_t;
+#endif
+
+  /// Usage statistics, in bytes of the rounded-up size classes
+  struct statistics {
+    size_t bytes_in_use = 0;         ///< bytes currently handed out
+    size_t bytes_cached = 0;         ///< bytes released and held for reuse
+    size_t high_water_mark = 0;      ///< peak of bytes_in_use + bytes_cached
+    size_t allocations = 0;          ///< number of allocations served
+    size_t cache_hits = 0;           ///< number of allocations served from the cache
+  };
+
+  /// Smallest size class
+  static constexpr size_t kMinBinBytes = 512;
+
+private:
+
+  struct block {
+    void* ptr = nullptr;
+    size_t bytes = 0;
+    stream_type stream = nullptr;
+    copy_event ready;                ///< completes once the work enqueued before release is done
+  };
+
+  std::atomic<bool> enabled_;
+  size_t max_cached_bytes_ = size_t(4) << 30;
+
+  mutable std::mutex mutex_;
+  std::multimap<size_t, block> cached_;
+  std::unordered_map<void*, block> live_;
+  statistics stats_;
+
+  caching_allocator() {
+    char const* env = std::getenv("CUTLASS_DEVICE_MEMORY_POOL");
+    enabled_ = env != nullptr && env[0] != '\0' && env[0] != '0';
+  }
+
+  static copy_event record(stream_type stream) {
+#if defined(CUTLASS_ENABLE_SYCL)
+    sycl::queue& queue = stream ? *stream : syclcompat::get_default_queue();
+    return copy_event(queue.ext_oneapi_submit_barrier());
+#else
+    return copy_event(stream);
+#endif
+  }
+
+  /// Returns true if work enqueued on \p stream is ordered after the release of \p b
+  static bool in_stream_order(block const& b, stream_type stream) {
+#if defined(CUTLASS_ENABLE_SYCL)
+    // The default syclcompat queue is in-order
+    return b.stream == stream && (stream == nullptr || stream->is_in_order());
+#else
+    return b.stream == stream;
+#endif
+  }
+
+  /// Removes cached blocks until at most \p max_bytes remain. The caller holds the lock and
+  /// frees the returned blocks after releasing it.
+  std::vector<block> evict(size_t max_bytes) {
+    std::vector<block> evicted;
+    // Evict the largest blocks first
+    while (stats_.bytes_cached > max_bytes && !cached_.empty()) {
+      auto it = std::prev(cached_.end());
+      stats_.bytes_cached -= it->second.bytes;
+      evicted.push_back(std::move(it->second));
+      cached_.erase(it);
+    }
+    return evicted;
+  }
+
+  static void release(std::vector<block> &blocks) {
+    for (auto &b : blocks) {
+      b.ready.wait();
+      detail::free_bytes(b.ptr);
+    }
+  }
+
+public:
+
+  caching_allocator(caching_allocator const &) = delete;
+  caching_allocator & operator=(caching_allocator const &) = delete;
+
+  /// Returns the process-wide allocator. It is intentionally never destroyed, since cached
+  /// blocks must not be freed after the device runtime has been torn down at exit.
+  static caching_allocator & instance() {
+    static caching_allocator* allocator = new caching_allocator();
+    return *allocator;
+  }
+
+  /// Returns the size class serving an allocation of \p bytes. Four classes per power of two
+  /// bound the padding to 25%.
+  static size_t bin_bytes(size_t bytes) {
+    if (bytes <= kMinBinBytes) {
+      return kMinBinBytes;
+    }
+    size_t power = kMinBinBytes;
+    while (power <= bytes / 2) {
+      power *= 2;
+    }
+    size_t const step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+
+  /// Returns true if device_memory::allocate() is served by the cache
+  bool enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /// Routes device_memory::allocate() through the cache. Disabling it releases all cached
+  /// blocks; blocks still in use return to the driver when they are freed.
+  void enable(bool value = true) {
+    enabled_.store(value);
+    if (!value) {
+      trim();
+    }
+  }
+
+  /// Sets the maximum number of bytes held in the cache. Released blocks which do not fit are
+  /// returned to the driver.
+  void set_max_cached_bytes(size_t bytes) {
+    std::vector<block> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      max_cached_bytes_ = bytes;
+      evicted = evict(bytes);
+    }
+    release(evicted);
+  }
+
+  /// Returns cached blocks to the driver until at most \p max_bytes remain cached
+  void trim(size_t max_bytes = 0) {
+    std::vector<block> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      evicted = evict(max_bytes);
+    }
+    release(evicted);
+  }
+
+  /// Returns a snapshot of the usage statistics
+  statistics stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /// Resets the high-water mark to the current footprint
+  void reset_high_water_mark() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.high_water_mark = stats_.bytes_in_use + stats_.bytes_cached;
+  }
+
+  /// Allocates at least \p bytes bytes of device memory for use on \p stream
+  void* allocate(size_t bytes, stream_type stream = nullptr) {
+    if (bytes == 0) {
+      return nullptr;
+    }
+
+    size_t const bytes_bin = bin_bytes(bytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.allocations;
+
+      // Prefer a block released on the same stream, else any block whose release has completed
+      auto range = cached_.equal_range(bytes_bin);
+      auto reuse = range.second;
+      for (auto it = range.first; it != range.second; ++it) {
+        if (in_stream_order(it->second, stream)) {
+          reuse = it;
+          break;
+        }
+        if (reuse == range.second && it->second.ready.query()) {
+          reuse = it;
+        }
+      }
+
+      if (reuse != range.second) {
+        block b = std::move(reuse->second);
+        cached_.erase(reuse);
+        b.stream = stream;
+        b.ready = copy_event();
+
+        stats_.bytes_cached -= bytes_bin;
+        stats_.bytes_in_use += bytes_bin;
+        ++stats_.cache_hits;
+
+        void* ptr = b.ptr;
+        live_.emplace(ptr, std::move(b));
+        return ptr;
+      }
+    }
+
+    void* ptr = nullptr;
+    try {
+      ptr = detail::allocate_bytes(bytes_bin);
+    }
+    catch (...) {
+      // Out of memory: give the cached blocks back and retry once
+      trim();
+      ptr = detail::allocate_bytes(bytes_bin);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    block b;
+    b.ptr = ptr;
+    b.bytes = bytes_bin;
+    b.stream = stream;
+    live_.emplace(ptr, std::move(b));
+
+    stats_.bytes_in_use += bytes_bin;
+    stats_.high_water_mark = std::max(stats_.high_water_mark, stats_.bytes_in_use + stats_.bytes_cached);
+    return ptr;
+  }
+
+  /// Releases a block obtained from allocate() into the cache, ordered after the work already
+  /// enqueued on the stream it was allocated for. Returns false if \p ptr is not owned by the cache.
+  /// While the cache is disabled the block is returned to the driver.
+  bool deallocate(void* ptr) {
+    block b;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = live_.find(ptr);
+      if (it == live_.end()) {
+        return false;
+      }
+      b = std::move(it->second);
+      live_.erase(it);
+      stats_.bytes_in_use -= b.bytes;
+
+      if (enabled() && stats_.bytes_cached + b.bytes <= max_cached_bytes_) {
+        b.ready = record(b.stream);
+        stats_.bytes_cached += b.bytes;
+        cached_.emplace(b.bytes, std::move(b));
+        return true;
+      }
+    }
+    detail::free_bytes(b.ptr);
+    return true;
+  }
+};
+
+#if defined(CUTLASS_ENABLE_SYCL)
+/// Allocate a buffer of \p count elements of type \p T on the current SYCL device for use on
+/// \p queue, which must outlive the buffer. The buffer is served by the caching allocator when it
+/// is enabled.
+template <typename T>
+T* allocate(size_t count, sycl::queue& queue) {
+
+  size_t bytes = count * sizeof(T);
+
+  caching_allocator &pool = caching_allocator::instance();
+  if (pool.enabled()) {
+    return reinterpret_cast<T*>(pool.allocate(bytes, &queue));
+  }
+  return reinterpret_cast<T*>(detail::allocate_bytes(bytes));
+}
+#endif
+
+/// Allocate a buffer of \p count elements of type \p T on the current CUDA device. The buffer is
+/// served by the caching allocator when it is enabled. SYCL builds have no stream handle and use
+/// the default queue; see the sycl::queue overload.
+template <typename T>
+T* allocate(size_t count = 1, cudaStream_t stream = nullptr) {
+
+  size_t bytes = count * sizeof(T);
+
+  caching_allocator &pool = caching_allocator::instance();
+  if (pool.enabled()) {
+#if defined(CUTLASS_ENABLE_SYCL)
+    (void) stream;
+    return reinterpret_cast<T*>(pool.allocate(bytes));
+#else
+    return reinterpret_cast<T*>(pool.allocate(bytes, stream));
+#endif
+  }
+  return reinterpret_cast<T*>(detail::allocate_bytes(bytes));
+}
+
 /// Free the buffer pointed to by \p ptr
 template <typename T>
 void free(T* ptr) {
+  if (ptr) {
+    void* raw_ptr = const_cast<void*>(static_cast<void const*>(ptr));
+    if (!caching_allocator::instance().deallocate(raw_ptr)) {
+      detail::free_bytes(raw_ptr);
+    }
+  }
+}
+
+/******************************************************************************
+ * Page-locked host memory
+ ******************************************************************************/
+
+/// Allocate a buffer of \p count elements of type \p T in page-locked host memory. Under SYCL
+/// this is USM host memory, which the device can transfer from without an intermediate copy.
+template <typename T>
+T* allocate_host(size_t count = 1) {
+
+  T* ptr = nullptr;
+  size_t bytes = count * sizeof(T);
+
+  if (count == 0) {
+    return ptr;
+  }
+
+#if defined(CUTLASS_ENABLE_SYCL)
+  ptr = reinterpret_cast<T*>(syclcompat::malloc_host(bytes));
+  if ((void*)ptr == nullptr) {
+    throw std::runtime_error("Failed to allocate host memory");
+  }
+#else
+  cudaError_t cuda_error = cudaMallocHost((void**)&ptr, bytes);
+
+  if (cuda_error != cudaSuccess) {
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
+    std::ostringstream os;
+    os << "cutlass::device_memory::allocate_host: cudaMallocHost failed: bytes=" << bytes;
+    CUTLASS_TRACE_HOST(os.str());
+#endif
+    throw cuda_exception("Failed to allocate host memory", cuda_error);
+  }
+#endif
+  return ptr;
+}
+
+/// Free the page-locked host buffer pointed to by \p ptr
+template <typename T>
+void free_host(T* ptr) {
   if (ptr) {
 #if defined(CUTLASS_ENABLE_SYCL)
     syclcompat::free(ptr);
-    if (ptr != nullptr) {
-      throw std::runtime_error("Failed to free device memory");
-    }
 #else
-    cudaError_t cuda_error = (cudaFree(ptr));
+    cudaError_t cuda_error = (cudaFreeHost(ptr));
     if (cuda_error != cudaSuccess) {
-      throw cuda_exception("Failed to free device memory", cuda_error);
+      throw cuda_exception("Failed to free host memory", cuda_error);
     }
 #endif
   }
 }
 
+/// Allocator for host-side storage which is optionally page-locked. Pinned storage lets
+/// transfers to and from the device run asynchronously.
+template <typename T>
+struct host_allocator {
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  /// If true, memory is allocated with allocate_host()
+  bool pinned = false;
+
+  host_allocator() = default;
+
+  explicit host_allocator(bool pinned_): pinned(pinned_) {}
+
+  template <typename U>
+  host_allocator(host_allocator<U> const &other): pinned(other.pinned) {}
+
+  T* allocate(size_t count) {
+    return pinned ? allocate_host<T>(count) : std::allocator<T>().allocate(count);
+  }
+
+  void deallocate(T* ptr, size_t count) {
+    if (pinned) {
+      free_host(ptr);
+    }
+    else {
+      std::allocator<T>().deallocate(ptr, count);
+    }
+  }
+
+  template <typename U>
+  bool operator==(host_allocator<U> const &other) const {
+    return pinned == other.pinned;
+  }
+
+  template <typename U>
+  bool operator!=(host_allocator<U> const &other) const {
+    return pinned != other.pinned;
+  }
+};
+
 /******************************************************************************
  * Data movement
  ******************************************************************************/
@@ -186,6 +661,203 @@ void insert_to_device(T* device_begin, InputIterator begin, InputIterator end) {
   copy_to_device(device_begin, &*begin, elements);
 }
 
+/******************************************************************************
+ * Asynchronous data movement
+ ******************************************************************************/
+
+/// Size of each chunk of a staged copy
+static constexpr size_t kStagingChunkBytes = size_t(8) << 20;
+
+/// Enqueues a copy and returns without waiting for it. Neither buffer may be modified or freed
+/// until the returned event has completed. In SYCL builds the copy is submitted to the default
+/// queue and \p stream is ignored.
+template <typename T>
+copy_event copy_async(T* dst, T const* src, size_t count, cudaMemcpyKind kind, cudaStream_t stream = nullptr) {
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes == 0 && count > 0) {
+    bytes = 1;
+  }
+#if defined(CUTLASS_ENABLE_SYCL)
+  (void) kind;
+  (void) stream;
+  return copy_event(syclcompat::memcpy_async(dst, src, bytes));
+#else
+  cudaError_t cuda_error = (cudaMemcpyAsync(dst, src, bytes, kind, stream));
+  if (cuda_error != cudaSuccess) {
+    std::ostringstream os;
+    os << "cutlass::device_memory::copy_async: cudaMemcpyAsync() failed: "
+       << "dst=" << dst << ", src=" << src
+       << ", bytes=" << bytes << ", count=" << count
+       << ", error: " << cudaGetErrorString(cuda_error);
+
+    throw cuda_exception(os.str().c_str(), cuda_error);
+  }
+  return copy_event(stream);
+#endif
+}
+
+template <typename T>
+copy_event copy_to_device_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  return copy_async(dst, src, count, cudaMemcpyHostToDevice, stream);
+}
+
+template <typename T>
+copy_event copy_to_host_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  return copy_async(dst, src, count, cudaMemcpyDeviceToHost, stream);
+}
+
+/// Pair of page-locked buffers used to pipeline transfers from and to pageable memory. The buffers
+/// are allocated by the first staged copy and kept for later ones, so that a caller issuing
+/// repeated staged copies pins its staging memory once. Copies of the object start out empty.
+class staging_buffers {
+public:
+
+  /// Transfers in flight from or to each buffer
+  copy_event pending[2];
+
+  staging_buffers() = default;
+
+  staging_buffers(staging_buffers const&) { }
+
+  staging_buffers& operator=(staging_buffers const&) {
+    return *this;
+  }
+
+  ~staging_buffers() {
+    try {
+      release();
+    }
+    catch (...) { }
+  }
+
+  /// Returns buffer \p i, allocating both buffers with \p chunk_bytes each unless they already
+  /// are at least that large
+  uint8_t* data(int i, size_t chunk_bytes) {
+    if (chunk_bytes_ < chunk_bytes) {
+      release();
+      data_[0] = allocate_host<uint8_t>(chunk_bytes);
+      try {
+        data_[1] = allocate_host<uint8_t>(chunk_bytes);
+      }
+      catch (...) {
+        free_host(data_[0]);
+        data_[0] = nullptr;
+        throw;
+      }
+      chunk_bytes_ = chunk_bytes;
+    }
+    return data_[i];
+  }
+
+  /// Waits for the transfers in flight
+  void wait() {
+    pending[0].wait();
+    pending[1].wait();
+  }
+
+  /// Waits for the transfers in flight and frees the buffers
+  void release() {
+    wait();
+    free_host(data_[0]);
+    free_host(data_[1]);
+    data_[0] = data_[1] = nullptr;
+    chunk_bytes_ = 0;
+  }
+
+private:
+
+  uint8_t* data_[2] = {nullptr, nullptr};
+  size_t chunk_bytes_ = 0;
+};
+
+/// Copies pageable host memory to the device in chunks of \p chunk_bytes, double-buffered through
+/// the page-locked \p staging buffers so that packing one chunk on the host overlaps the transfer
+/// of the previous one. Returns once \p src may be reused; the returned event is complete.
+template <typename T>
+copy_event copy_to_device_staged(
+    T* dst, T const* src, size_t count, staging_buffers& staging, cudaStream_t stream = nullptr,
+    size_t chunk_bytes = kStagingChunkBytes) {
+
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes <= chunk_bytes) {
+    copy_to_device(dst, src, count);
+    return copy_event();
+  }
+
+  auto dst_bytes = reinterpret_cast<uint8_t*>(dst);
+  auto src_bytes = reinterpret_cast<uint8_t const*>(src);
+
+  for (size_t offset = 0, chunk = 0; offset < bytes; offset += chunk_bytes, ++chunk) {
+    int const buffer = int(chunk % 2);
+    size_t const chunk_size = std::min(chunk_bytes, bytes - offset);
+
+    staging.pending[buffer].wait();
+    uint8_t* data = staging.data(buffer, chunk_bytes);
+    std::memcpy(data, src_bytes + offset, chunk_size);
+    staging.pending[buffer] = copy_async(dst_bytes + offset, data, chunk_size, cudaMemcpyHostToDevice, stream);
+  }
+  staging.wait();
+  return copy_event();
+}
+
+/// Copies pageable host memory to the device through staging buffers allocated for this call only
+template <typename T>
+copy_event copy_to_device_staged(
+    T* dst, T const* src, size_t count, cudaStream_t stream = nullptr,
+    size_t chunk_bytes = kStagingChunkBytes) {
+  staging_buffers staging;
+  return copy_to_device_staged(dst, src, count, staging, stream, chunk_bytes);
+}
+
+/// Copies device memory to pageable host memory in chunks of \p chunk_bytes, double-buffered
+/// through the page-locked \p staging buffers so that the transfer of one chunk overlaps unpacking
+/// the previous one on the host. Returns once \p dst holds the data; the returned event is complete.
+template <typename T>
+copy_event copy_to_host_staged(
+    T* dst, T const* src, size_t count, staging_buffers& staging, cudaStream_t stream = nullptr,
+    size_t chunk_bytes = kStagingChunkBytes) {
+
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes <= chunk_bytes) {
+    copy_to_host(dst, src, count);
+    return copy_event();
+  }
+
+  auto dst_bytes = reinterpret_cast<uint8_t*>(dst);
+  auto src_bytes = reinterpret_cast<uint8_t const*>(src);
+  size_t const chunks = (bytes + chunk_bytes - 1) / chunk_bytes;
+
+  staging.wait();
+  staging.pending[0] = copy_async(staging.data(0, chunk_bytes), src_bytes, chunk_bytes,
+                                  cudaMemcpyDeviceToHost, stream);
+
+  for (size_t chunk = 0; chunk < chunks; ++chunk) {
+    int const buffer = int(chunk % 2);
+    size_t const offset = chunk * chunk_bytes;
+
+    // Start the next transfer before draining this one
+    if (chunk + 1 < chunks) {
+      size_t const next_offset = offset + chunk_bytes;
+      staging.pending[buffer ^ 1] = copy_async(
+          staging.data(buffer ^ 1, chunk_bytes), src_bytes + next_offset,
+          std::min(chunk_bytes, bytes - next_offset), cudaMemcpyDeviceToHost, stream);
+    }
+
+    staging.pending[buffer].wait();
+    std::memcpy(dst_bytes + offset, staging.data(buffer, chunk_bytes), std::min(chunk_bytes, bytes - offset));
+  }
+  return copy_event();
+}
+
+/// Copies device memory to pageable host memory through staging buffers allocated for this call only
+template <typename T>
+copy_event copy_to_host_staged(
+    T* dst, T const* src, size_t count, cudaStream_t stream = nullptr,
+    size_t chunk_bytes = kStagingChunkBytes) {
+  staging_buffers staging;
+  return copy_to_host_staged(dst, src, count, staging, stream, chunk_bytes);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 }  // namespace device_memory
@@ -199,16 +871,13 @@ public:
   /// Delete functor for CUDA device memory
   struct deleter {
     void operator()(T* ptr) {
-#if defined(CUTLASS_ENABLE_SYCL)
-      syclcompat::free(ptr);
-#else
-      cudaError_t cuda_error = (cudaFree(ptr));
-      if (cuda_error != cudaSuccess) {
+      try {
+        device_memory::free(ptr);
+      }
+      catch (...) {
         // noexcept
-        //                throw cuda_exception("cudaFree() failed", cuda_error);
         return;
       }
-#endif
     }
   };
 
@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_nchw_to_nhwc.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels to transform a device memory tensor from NCHW layout to NHWC layout.
@@ -139,3 +143,5 @@ void nchw_to_nhwc(cutlass::Tensor4DCoord input_tensor_size,
 }
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
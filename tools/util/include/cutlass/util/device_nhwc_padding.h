@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_nhwc_padding.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels for padding in device memory with NHWC layout.
@@ -274,3 +278,5 @@ void nhwc_padding(cutlass::Tensor4DCoord input_tensor_size,
 
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_nhwc_pooling.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels to do avg/max pooling on a device memory tensor with NHWC layout.
@@ -571,3 +575,5 @@ void pooling_nhwc(cutlass::Tensor4DCoord input_tensor_size,
 }
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_nhwc_to_nchw.h"
+#else
+
 /**
  * \file
  * \brief cuda kernels to transform a device memory tensor from NHWC layout to NCHW layout.
@@ -142,3 +146,5 @@ void nhwc_to_nchw(cutlass::Tensor4DCoord input_tensor_size,
 }
 
 } //namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
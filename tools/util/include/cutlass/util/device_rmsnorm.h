@@ -31,6 +31,10 @@
 
 #pragma once
 
+#if defined(CUTLASS_ENABLE_SYCL)
+#include "cutlass/util/sycl_rmsnorm.h"
+#else
+
 #include "cutlass/cutlass.h"
 #include "cutlass/layout/tensor.h"
 #include "cutlass/numeric_types.h"
@@ -184,3 +188,5 @@ void rmsnorm(cutlass::MatrixCoord tensor_size,
 }
 
 } // namespace cutlass
+
+#endif // defined(CUTLASS_ENABLE_SYCL)
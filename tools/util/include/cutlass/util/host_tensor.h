@@ -37,6 +37,12 @@
   host memory synchronize device memory automatically. Explicit copy operations provide abstractions
   for CUDA memcpy operations.
 
+  Host memory may optionally be page-locked (USM host memory under SYCL), in which case
+  sync_{host, device}_async() return without waiting for the transfer. On large pageable tensors
+  sync_{host, device}_async() transfer double-buffered chunks through page-locked staging memory,
+  which the tensor keeps for later calls, and return once the transfer has completed.
+  sync_{host, device}() always copy directly.
+
   Call {host, device}_{data, ref, view}() for accessing host or device memory.
 
   See cutlass/tensor_ref.h and cutlass/tensor_view.h for more details.
@@ -125,11 +131,14 @@ private:
   Layout layout_;
 
   /// Host-side memory allocation
-  std::vector<StorageUnit> host_;
+  std::vector<StorageUnit, device_memory::host_allocator<StorageUnit>> host_;
 
   /// Device-side memory
   device_memory::allocation<StorageUnit> device_;
 
+  /// Page-locked buffers of the staged copies of pageable host memory, allocated on first use
+  device_memory::staging_buffers staging_;
+
   /// number of containers 
   size_t count_to_container_storage_unit_count(size_t count) {
     return (count + kContainerTypeNumLogicalElements - 1) / kContainerTypeNumLogicalElements * kContainerTypeNumStorageUnit;
@@ -146,20 +155,22 @@ public:
   /// Constructs a tensor given an extent. Assumes a packed layout
   HostTensor(
     TensorCoord const &extent,
-    bool device_backed = true
+    bool device_backed = true,
+    bool host_pinned = false
   ) {
 
-    this->reset(extent, Layout::packed(extent), device_backed);
+    this->reset(extent, Layout::packed(extent), device_backed, host_pinned);
   }
 
   /// Constructs a tensor given an extent and layout
   HostTensor(
     TensorCoord const &extent,
     Layout const &layout,
-    bool device_backed = true
+    bool device_backed = true,
+    bool host_pinned = false
   ) {
 
-    this->reset(extent, layout, device_backed);
+    this->reset(extent, layout, device_backed, host_pinned);
   }
 
   ~HostTensor() { }
@@ -171,14 +182,26 @@ public:
 
     host_.clear();
     device_.reset();
+    staging_.release();
   }
 
-  /// Resizes internal memory allocations without affecting layout or extent
+  /// Resizes internal memory allocations without affecting layout or extent. Host memory keeps
+  /// its current pinning.
   void reserve(
     size_t count,                                        ///< size of tensor in elements
     bool device_backed_ = true) {                        ///< if true, device memory is also allocated
+
+    reserve(count, device_backed_, host_pinned());
+  }
+
+  /// Resizes internal memory allocations without affecting layout or extent
+  void reserve(
+    size_t count,                                        ///< size of tensor in elements
+    bool device_backed_,                                 ///< if true, device memory is also allocated
+    bool host_pinned_) {                                 ///< if true, host memory is page-locked
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-    CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve(count=" << count << ", device_backed_=" << (device_backed_ ? "true" : "false") << ")");
+    CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve(count=" << count << ", device_backed_=" << (device_backed_ ? "true" : "false")
+      << ", host_pinned_=" << (host_pinned_ ? "true" : "false") << ")");
 #endif
 
     device_.reset();
@@ -186,9 +209,10 @@ public:
 
     size_t count_container = count_to_container_storage_unit_count(count);
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-    CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve: host_.resize(" << count_container << ")");
+    CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve: host allocation of " << count_container << " storage units"
+      << (host_pinned_ ? " (pinned)" : ""));
 #endif    
-    host_.resize(count_container);
+    host_ = decltype(host_)(count_container, device_memory::host_allocator<StorageUnit>(host_pinned_));
 
     // Allocate memory
     StorageUnit* device_memory = nullptr;
@@ -202,25 +226,47 @@ public:
   }
 
   /// Updates the extent and layout of the HostTensor. Allocates memory according to the new
-  /// extent and layout.
+  /// extent and layout. Host memory keeps its current pinning.
   void reset(
     TensorCoord const &extent,                           ///< extent of logical tensor
     Layout const &layout,                                ///< layout object of tensor
     bool device_backed_ = true) {                        ///< if true, device memory is also allocated. 
 
+    reset(extent, layout, device_backed_, host_pinned());
+  }
+
+  /// Updates the extent and layout of the HostTensor. Allocates memory according to the new
+  /// extent and layout.
+  void reset(
+    TensorCoord const &extent,                           ///< extent of logical tensor
+    Layout const &layout,                                ///< layout object of tensor
+    bool device_backed_,                                 ///< if true, device memory is also allocated. 
+    bool host_pinned_) {                                 ///< if true, host memory is page-locked
+
     extent_ = extent;
     layout_ = layout;
 
-    reserve(size_t(layout_.capacity(extent_)), device_backed_);
+    reserve(size_t(layout_.capacity(extent_)), device_backed_, host_pinned_);
   }
 
   /// Updates the extent and layout of the HostTensor. Allocates memory according to the new
-  /// extent and layout. Assumes a packed tensor configuration.
+  /// extent and layout. Assumes a packed tensor configuration. Host memory keeps its current
+  /// pinning.
   void reset(
     TensorCoord const &extent,                           ///< extent of logical tensor
     bool device_backed_ = true) {                        ///< if true, device memory is also allocated. 
 
-    reset(extent, Layout::packed(extent), device_backed_);
+    reset(extent, Layout::packed(extent), device_backed_, host_pinned());
+  }
+
+  /// Updates the extent and layout of the HostTensor. Allocates memory according to the new
+  /// extent and layout. Assumes a packed tensor configuration.
+  void reset(
+    TensorCoord const &extent,                           ///< extent of logical tensor
+    bool device_backed_,                                 ///< if true, device memory is also allocated. 
+    bool host_pinned_) {                                 ///< if true, host memory is page-locked
+
+    reset(extent, Layout::packed(extent), device_backed_, host_pinned_);
   }
 
   /// Changes the size of the logical tensor. Only allocates memory if new capacity exceeds reserved capacity.
@@ -237,7 +283,7 @@ public:
     LongIndex new_size_container = count_to_container_storage_unit_count((layout_.capacity(extent_)));
 
     if (static_cast<decltype(host_.size())>(new_size_container) > host_.size()) {
-      reserve(new_size, device_backed_);
+      reserve(new_size, device_backed_, host_pinned());
     }
   }
 
@@ -335,6 +381,11 @@ public:
     return (device_.get() == nullptr) ? false : true;
   }
 
+  /// Returns true if host memory is page-locked
+  bool host_pinned() const {
+    return host_.get_allocator().pinned;
+  }
+
 
   /// Returns the layout object
   Layout & layout() {
@@ -407,6 +458,38 @@ public:
     }
   }
 
+  /// Copies data from device to host. If host memory is pinned, the copy is only enqueued and host
+  /// memory must not be accessed until the returned event has completed. Otherwise the copy is
+  /// done in double-buffered chunks through the staging buffers of the tensor and has completed on
+  /// return.
+  device_memory::copy_event sync_host_async(cudaStream_t stream = nullptr) {
+    if (!device_backed()) {
+      return device_memory::copy_event();
+    }
+    if (host_pinned()) {
+      return device_memory::copy_to_host_async(
+          host_.data(), device_.get(), device_.size(), stream);
+    }
+    return device_memory::copy_to_host_staged(
+        host_.data(), device_.get(), device_.size(), staging_, stream);
+  }
+
+  /// Copies data from host to device. If host memory is pinned, the copy is only enqueued and host
+  /// memory must not be modified until the returned event has completed. Otherwise the copy is
+  /// done in double-buffered chunks through the staging buffers of the tensor and host memory may
+  /// be reused on return.
+  device_memory::copy_event sync_device_async(cudaStream_t stream = nullptr) {
+    if (!device_backed()) {
+      return device_memory::copy_event();
+    }
+    if (host_pinned()) {
+      return device_memory::copy_to_device_async(
+          device_.get(), host_.data(), host_.size(), stream);
+    }
+    return device_memory::copy_to_device_staged(
+        device_.get(), host_.data(), host_.size(), staging_, stream);
+  }
+
   /// Copy data from a caller-supplied device pointer into host memory.
   void copy_in_device_to_host(
     Element const* ptr_device,        ///< source device memory
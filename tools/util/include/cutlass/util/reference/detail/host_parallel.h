@@ -0,0 +1,282 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Thread-parallel loops used by host-side reference implementations.
+*/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/blas3_types.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reference {
+namespace detail {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Thread count forced by ScopedHostThreadCount, or 0 if none is in effect
+inline std::atomic<int>& host_thread_count_override() {
+  static std::atomic<int> count{0};
+  return count;
+}
+
+/// Number of threads used by host reference implementations. The environment variable
+/// CUTLASS_HOST_REFERENCE_THREADS overrides the hardware concurrency; a value of 1 runs serially.
+inline int host_thread_count() {
+  static int const count = [] {
+    if (char const* env = std::getenv("CUTLASS_HOST_REFERENCE_THREADS")) {
+      int requested = std::atoi(env);
+      if (requested > 0) {
+        return requested;
+      }
+    }
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }();
+  int const forced = host_thread_count_override().load(std::memory_order_relaxed);
+  return forced > 0 ? forced : count;
+}
+
+/// Sets host_thread_count() for the lifetime of the object, as CUTLASS_HOST_REFERENCE_THREADS
+/// does for the whole process. Lets tests compare a serial run against a threaded one.
+class ScopedHostThreadCount {
+public:
+
+  explicit ScopedHostThreadCount(int count):
+    previous_(host_thread_count_override().exchange(count)) { }
+
+  ~ScopedHostThreadCount() {
+    host_thread_count_override().store(previous_);
+  }
+
+  ScopedHostThreadCount(ScopedHostThreadCount const&) = delete;
+  ScopedHostThreadCount& operator=(ScopedHostThreadCount const&) = delete;
+
+private:
+
+  int previous_;
+};
+
+/// Worker threads shared by every parallel_for call. Each call runs on host_thread_count() - 1
+/// workers plus the calling thread; the pool starts workers on demand and keeps them for reuse.
+class HostThreadPool {
+public:
+
+  using Task = void (*)(void*);
+
+  static HostThreadPool& instance() {
+    static HostThreadPool pool;
+    return pool;
+  }
+
+  HostThreadPool(HostThreadPool const&) = delete;
+  HostThreadPool& operator=(HostThreadPool const&) = delete;
+
+  ~HostThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /// Runs task(context) on host_thread_count() - 1 workers and on the calling thread, returning
+  /// once all have finished. Returns false without running anything if the calling thread is a
+  /// worker, if only one thread is requested or if another thread is using the pool; the caller
+  /// is expected to fall back to serial execution.
+  bool run(Task task, void* context) {
+    int const active = host_thread_count() - 1;
+    if (inside_pool() || active <= 0) {
+      return false;
+    }
+    std::unique_lock<std::mutex> submit(submit_, std::try_to_lock);
+    if (!submit.owns_lock()) {
+      return false;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      while (static_cast<int>(workers_.size()) < active) {
+        int const index = static_cast<int>(workers_.size());
+        workers_.emplace_back([this, index, seen = generation_] { worker_loop(index, seen); });
+      }
+      task_ = task;
+      context_ = context;
+      active_ = active;
+      pending_ = active;
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    inside_pool() = true;
+    task(context);
+    inside_pool() = false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+    return true;
+  }
+
+private:
+
+  HostThreadPool() = default;
+
+  static bool& inside_pool() {
+    static thread_local bool inside = false;
+    return inside;
+  }
+
+  void worker_loop(int index, uint64_t seen) {
+    inside_pool() = true;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+      if (index >= active_) {
+        continue;
+      }
+      Task task = task_;
+      void* context = context_;
+
+      lock.unlock();
+      task(context);
+      lock.lock();
+
+      if (--pending_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex submit_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  Task task_ = nullptr;
+  void* context_ = nullptr;
+  uint64_t generation_ = 0;
+  int active_ = 0;
+  int pending_ = 0;
+  bool stop_ = false;
+};
+
+/// Calls func(i) for every i in [0, count). Items are handed out one at a time to the threads of
+/// HostThreadPool, so func should process a reasonably sized block of work per call. Calls for
+/// different items may run concurrently and in any order. Nested calls run serially.
+template <class Func>
+void parallel_for(int64_t count, Func&& func) {
+  auto serial = [&]() {
+    for (int64_t i = 0; i < count; ++i) {
+      func(i);
+    }
+  };
+
+  if (count <= 1 || host_thread_count() <= 1) {
+    serial();
+    return;
+  }
+
+  struct Context {
+    std::atomic<int64_t> next{0};
+    int64_t count;
+    std::remove_reference_t<Func>* func;
+  } context;
+  context.count = count;
+  context.func = &func;
+
+  auto worker = [](void* ptr) {
+    auto& ctx = *static_cast<Context*>(ptr);
+    for (int64_t i = ctx.next++; i < ctx.count; i = ctx.next++) {
+      (*ctx.func)(i);
+    }
+  };
+
+  if (!HostThreadPool::instance().run(worker, &context)) {
+    serial();
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Calls func(row_begin, column_begin) for every tile_m-by-tile_n tile of an M-by-N matrix.
+/// For FillMode::kLower and FillMode::kUpper only tiles that intersect that triangle are
+/// scheduled, so the threads share the useful work rather than the whole bounding square.
+template <class Func>
+void parallel_for_matrix_tiles(
+  int M, int N, int tile_m, int tile_n, FillMode fill_mode, Func&& func) {
+
+  std::vector<std::pair<int, int>> tiles;
+  for (int row_begin = 0; row_begin < M; row_begin += tile_m) {
+    for (int column_begin = 0; column_begin < N; column_begin += tile_n) {
+      int const row_last = std::min(M, row_begin + tile_m) - 1;
+      int const column_last = std::min(N, column_begin + tile_n) - 1;
+
+      if (fill_mode == FillMode::kLower && row_last < column_begin) {
+        continue;
+      }
+      if (fill_mode == FillMode::kUpper && row_begin > column_last) {
+        continue;
+      }
+      tiles.emplace_back(row_begin, column_begin);
+    }
+  }
+
+  parallel_for(int64_t(tiles.size()), [&](int64_t idx) {
+    func(tiles[idx].first, tiles[idx].second);
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace reference
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
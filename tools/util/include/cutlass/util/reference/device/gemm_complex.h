@@ -43,12 +43,38 @@
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace cutlass {
 namespace reference {
 namespace device {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+/// Accumulator of the tiled SYCL reference. With the default inner product, real accumulators
+/// narrower than 32 bits are widened to float so that verification does not inherit the rounding
+/// of a half-precision accumulation.
+template <typename ComputeType, typename InnerProductOp>
+struct TiledGemmComplexAccumulator {
+  using Element = ComputeType;
+  using Operator = InnerProductOp;
+};
+
+template <typename ComputeType>
+struct TiledGemmComplexAccumulator<ComputeType, multiply_add<ComputeType>> {
+  static bool const kWiden = sizeof_bits<ComputeType>::value < 32 &&
+                             !std::numeric_limits<ComputeType>::is_integer;
+  using Element = typename platform::conditional<kWiden, float, ComputeType>::type;
+  using Operator = multiply_add<Element>;
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace kernel {
 
 /// Computes a general matrix product among matrices (tensors of rank=2) pointed to by TensorRef
@@ -184,6 +210,199 @@ __global__ void
   } // for (batch_idx)
 }
 
+#if defined (CUTLASS_ENABLE_SYCL)
+
+/// Tiled variant of kernel::GemmComplex used on SYCL devices.
+///
+/// A work-group of kSubgroupSize x kThreadsM work-items computes a kTileM x kTileN tile of D and
+/// stages kTileK-deep panels of A and B in local memory, converted to the accumulator type. Each
+/// sub-group owns kMblock rows of the tile, and each of its work-items owns kNblock columns
+/// strided by the sub-group size. On Intel targets, which launch it with a required sub-group
+/// size of kSubgroupSize, the work-items of a sub-group load one k each from the A panel and
+/// broadcast it to the rest of the sub-group during the inner product. Other targets may pick
+/// a different sub-group size, so there every work-item reads A from the local memory panel.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ScalarType,
+  typename ComputeType,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ScalarType>,
+  typename InnerProductOp = multiply_add<ComputeType>,
+  int kSubgroupSize = 16,
+  int kThreadsM = 16,
+  int kMblock = 4,
+  int kNblock = 4
+>
+void GemmComplexTiled(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRef<ElementA, LayoutA> tensor_a,
+  ComplexTransform transform_a,
+  TensorRef<ElementB, LayoutB> tensor_b,
+  ComplexTransform transform_b,
+  ScalarType beta,
+  TensorRef<ElementC, LayoutC> tensor_c,
+  TensorRef<ElementD, LayoutC> tensor_d,
+  ComputeType initial_accum,
+  int batch_count = 1,
+  int64_t batch_stride_A = 0,
+  int64_t batch_stride_B = 0,
+  int64_t batch_stride_C = 0,
+  int64_t batch_stride_D = 0) {
+
+  static_assert(
+    LayoutA::kRank == 2 &&
+    LayoutB::kRank == 2 &&
+    LayoutC::kRank == 2, "Tensors must be of rank 2");
+
+  using Accumulator = typename detail::TiledGemmComplexAccumulator<ComputeType, InnerProductOp>::Element;
+  using AccumulatorOp = typename detail::TiledGemmComplexAccumulator<ComputeType, InnerProductOp>::Operator;
+
+  int const kTileM = kThreadsM * kMblock;
+  int const kTileN = kSubgroupSize * kNblock;
+  int const kTileK = kSubgroupSize;
+  int const kThreadCount = kSubgroupSize * kThreadsM;
+
+  // Panels of A (kTileM x kTileK) and B (kTileK x kTileN), both row-major
+  Accumulator* smem_a = syclcompat::local_mem<Accumulator[kTileM * kTileK]>();
+  Accumulator* smem_b = syclcompat::local_mem<Accumulator[kTileK * kTileN]>();
+
+  int const M = problem_size.m();
+  int const N = problem_size.n();
+  int const K = problem_size.k();
+
+  ConvertOp convert_op;
+  AccumulatorOp inner_product_op;
+
+  // On Intel targets BlockDimX() is the sub-group size, so each row of work-items forms one sub-group
+  int const lane_idx = ThreadIdxX();
+  int const row_idx = ThreadIdxY();
+  int const thread_idx = row_idx * kSubgroupSize + lane_idx;
+
+  int const tile_row = BlockIdxX() * kTileM;
+  int const tile_col = BlockIdxY() * kTileN;
+  int batch_idx = BlockIdxZ();
+
+  tensor_a.add_pointer_offset(batch_idx * batch_stride_A);
+  tensor_b.add_pointer_offset(batch_idx * batch_stride_B);
+  tensor_c.add_pointer_offset(batch_idx * batch_stride_C);
+  tensor_d.add_pointer_offset(batch_idx * batch_stride_D);
+
+  for (; batch_idx < batch_count; batch_idx += GridDimZ()) {
+
+    Accumulator accum[kMblock][kNblock];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kNblock; j++) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kMblock; i++) {
+        accum[i][j] = Accumulator(initial_accum);
+      }
+    }
+
+    for (int k_tile = 0; k_tile < K; k_tile += kTileK) {
+
+      // Stage the panels, zero-filling outside of the problem
+      for (int idx = thread_idx; idx < kTileM * kTileK; idx += kThreadCount) {
+        int row = tile_row + idx / kTileK;
+        int k = k_tile + idx % kTileK;
+
+        Accumulator a_ik = Accumulator(0);
+        if (row < M && k < K) {
+          a_ik = Accumulator(tensor_a.at(MatrixCoord(row, k)));
+          if (transform_a == ComplexTransform::kConjugate) {
+            a_ik = conj(a_ik);
+          }
+        }
+        smem_a[idx] = a_ik;
+      }
+
+      for (int idx = thread_idx; idx < kTileK * kTileN; idx += kThreadCount) {
+        int k = k_tile + idx / kTileN;
+        int col = tile_col + idx % kTileN;
+
+        Accumulator b_kj = Accumulator(0);
+        if (k < K && col < N) {
+          b_kj = Accumulator(tensor_b.at(MatrixCoord(k, col)));
+          if (transform_b == ComplexTransform::kConjugate) {
+            b_kj = conj(b_kj);
+          }
+        }
+        smem_b[idx] = b_kj;
+      }
+
+      syncthreads();
+
+#if defined (SYCL_INTEL_TARGET)
+      // Work-item lane_idx holds A(row, k_tile + lane_idx) for the rows of its sub-group
+      Accumulator a_frag[kMblock];
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kMblock; i++) {
+        a_frag[i] = smem_a[(row_idx * kMblock + i) * kTileK + lane_idx];
+      }
+#endif
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int k = 0; k < kTileK; k++) {
+        Accumulator b_frag[kNblock];
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kNblock; j++) {
+          b_frag[j] = smem_b[k * kTileN + j * kSubgroupSize + lane_idx];
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kMblock; i++) {
+#if defined (SYCL_INTEL_TARGET)
+          Accumulator a_ik = shfl_sync(0xFFFFFFFF, a_frag[i], k, kSubgroupSize);
+#else
+          Accumulator a_ik = smem_a[(row_idx * kMblock + i) * kTileK + k];
+#endif
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kNblock; j++) {
+            accum[i][j] = inner_product_op(a_ik, b_frag[j], accum[i][j]);
+          }
+        }
+      }
+
+      syncthreads();
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kNblock; j++) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kMblock; i++) {
+        int row = tile_row + row_idx * kMblock + i;
+        int col = tile_col + j * kSubgroupSize + lane_idx;
+
+        MatrixCoord coord = MatrixCoord(row, col);
+
+        if (row < M && col < N) {
+
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]) +
+            beta * ScalarType(tensor_c.at(coord)));
+        }
+      }
+    }
+
+    tensor_a.add_pointer_offset(batch_stride_A * GridDimZ());
+    tensor_b.add_pointer_offset(batch_stride_B * GridDimZ());
+    tensor_c.add_pointer_offset(batch_stride_C * GridDimZ());
+    tensor_d.add_pointer_offset(batch_stride_D * GridDimZ());
+
+  } // for (batch_idx)
+}
+
+#endif
+
 } // namespace kernel
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -230,12 +449,94 @@ void GemmComplex(
     LayoutB::kRank == 2 &&
     LayoutC::kRank == 2, "Tensors must be of rank 2");
  
+#if defined (CUTLASS_ENABLE_SYCL)
+  // SYCL devices use the tiled kernel, which stages panels of A and B in local memory
+  int const kSubgroupSize = 16;
+  int const kThreadsM = 16;
   int const kMblock = 4;
   int const kNblock = 4;
 
-#if defined (CUTLASS_ENABLE_SYCL)
-using syclcompat::dim3;
+  syclcompat::dim3 block(kSubgroupSize, kThreadsM);
+  syclcompat::dim3 grid(
+    (problem_size.m() + kThreadsM * kMblock - 1) / (kThreadsM * kMblock),
+    (problem_size.n() + kSubgroupSize * kNblock - 1) / (kSubgroupSize * kNblock),
+    std::min(batch_count, int(std::numeric_limits<uint16_t>::max()))
+  );
+
+#if defined (SYCL_INTEL_TARGET)
+  using namespace syclcompat::experimental;
+  launch<kernel::GemmComplexTiled<
+      ElementA,
+      LayoutA,
+      ElementB,
+      LayoutB,
+      ElementC,
+      LayoutC,
+      ScalarType,
+      ComputeType,
+      ElementD,
+      ConvertOp,
+      InnerProductOp,
+      kSubgroupSize,
+      kThreadsM,
+      kMblock,
+      kNblock
+    >>(
+    launch_policy{grid, block, kernel_properties{sycl_exp::sub_group_size<kSubgroupSize>}},
+      problem_size,
+      alpha,
+      tensor_a,
+      transform_a,
+      tensor_b,
+      transform_b,
+      beta,
+      tensor_c,
+      tensor_d,
+      initial_accum,
+      batch_count,
+      batch_stride_A,
+      batch_stride_B,
+      batch_stride_C,
+      batch_stride_D
+    );
+#else
+  syclcompat::launch<kernel::GemmComplexTiled<
+      ElementA,
+      LayoutA,
+      ElementB,
+      LayoutB,
+      ElementC,
+      LayoutC,
+      ScalarType,
+      ComputeType,
+      ElementD,
+      ConvertOp,
+      InnerProductOp,
+      kSubgroupSize,
+      kThreadsM,
+      kMblock,
+      kNblock
+    >>(grid, block,
+      problem_size,
+      alpha,
+      tensor_a,
+      transform_a,
+      tensor_b,
+      transform_b,
+      beta,
+      tensor_c,
+      tensor_d,
+      initial_accum,
+      batch_count,
+      batch_stride_A,
+      batch_stride_B,
+      batch_stride_C,
+      batch_stride_D
+    );
 #endif
+#else
+  int const kMblock = 4;
+  int const kNblock = 4;
 
   dim3 block(16, 8);
   dim3 grid(
@@ -245,40 +546,6 @@ using syclcompat::dim3;
   );
 
   if (grid.y <= std::numeric_limits<uint16_t>::max()) {
-#if defined(CUTLASS_ENABLE_SYCL)
-
-  syclcompat::launch<kernel::GemmComplex<
-                      ElementA,
-                      LayoutA,
-                      ElementB,
-                      LayoutB,
-                      ElementC,
-                      LayoutC,
-                      ScalarType,
-                      ComputeType,
-                      ElementD,
-                      ConvertOp,
-                      InnerProductOp,
-                      kMblock,
-                      kNblock
-                    >>(grid, block, 
-                        problem_size,
-                        alpha,
-                        tensor_a,
-                        transform_a,
-                        tensor_b,
-                        transform_b,
-                        beta,
-                        tensor_c,
-                        tensor_d,
-                        initial_accum,
-                        batch_count,
-                        batch_stride_A,
-                        batch_stride_B,
-                        batch_stride_C,
-                        batch_stride_D
-                    );
-#else
     kernel::GemmComplex<
       ElementA,
       LayoutA,
@@ -310,7 +577,6 @@ using syclcompat::dim3;
       batch_stride_C,
       batch_stride_D
     );
-#endif
   } else {
     // Using bigger thread tile size
     int const kBigMblock = 4;
@@ -323,39 +589,6 @@ using syclcompat::dim3;
       batch_count % std::numeric_limits<uint16_t>::max()
     );
 
-#if defined (CUTLASS_ENABLE_SYCL)
-  syclcompat::launch<kernel::GemmComplex<
-                      ElementA,
-                      LayoutA,
-                      ElementB,
-                      LayoutB,
-                      ElementC,
-                      LayoutC,
-                      ScalarType,
-                      ComputeType,
-                      ElementD,
-                      ConvertOp,
-                      InnerProductOp,
-                      kBigMblock,
-                      kBigNblock
-                    >>(Biggrid, Bigblock, 
-                        problem_size,
-                        alpha,
-                        tensor_a,
-                        transform_a,
-                        tensor_b,
-                        transform_b,
-                        beta,
-                        tensor_c,
-                        tensor_d,
-                        initial_accum,
-                        batch_count,
-                        batch_stride_A,
-                        batch_stride_B,
-                        batch_stride_C,
-                        batch_stride_D
-                    );
-#else
     kernel::GemmComplex<
       ElementA,
       LayoutA,
@@ -387,8 +620,8 @@ using syclcompat::dim3;
       batch_stride_C,
       batch_stride_D
     );
-#endif
   }
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
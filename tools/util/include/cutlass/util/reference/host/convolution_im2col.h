@@ -0,0 +1,825 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host-side reference convolution lowered to im2col and a multi-threaded blocked GEMM.
+
+    The functions in this file compute the same results as Conv2d* and Conv3d* in convolution.h
+    for NHWC/NDHWC tensors, and are much faster on large problems. Each output element accumulates
+    its terms in the same order as the direct reference. The im2col matrix is never fully
+    materialized; each worker thread lowers a chunk of at most kConvIm2colChunkBytes at a time.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "cutlass/coord.h"
+#include "cutlass/functional.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/conv3d_problem_size.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Upper bound on the size of the im2col chunk each worker thread builds
+static constexpr size_t kConvIm2colChunkBytes = size_t(4) << 20;
+
+/// Number of GEMM columns accumulated together for one im2col row
+static constexpr int kConvIm2colBlockN = 64;
+
+/// Number of im2col rows of `row_elements` values that fit in one chunk
+template <typename Element>
+int64_t conv_im2col_chunk_rows(int64_t row_elements) {
+  return std::max<int64_t>(1,
+      int64_t(kConvIm2colChunkBytes / (sizeof(Element) * size_t(std::max<int64_t>(1, row_elements)))));
+}
+
+/// Describes a 2-D problem as a 3-D problem of unit depth
+inline conv::Conv3dProblemSize conv_im2col_problem(conv::Conv2dProblemSize const &problem_size) {
+  conv::Conv3dProblemSize problem;
+  static_cast<conv::Conv2dProblemSize &>(problem) = problem_size;
+  problem.D = problem.T = problem.Z = 1;
+  problem.pad_d = 0;
+  problem.stride_d = 1;
+  problem.dilation_d = 1;
+  return problem;
+}
+
+/// Splits a linear index over an (N, D, H, W) extent
+inline void conv_im2col_decompose(int64_t idx, int D, int H, int W, int &n, int &d, int &h, int &w) {
+  w = int(idx % W); idx /= W;
+  h = int(idx % H); idx /= H;
+  d = int(idx % D);
+  n = int(idx / D);
+}
+
+/// Fprop as a grouped GEMM: (N*Z*P*Q) x (T*R*S*C/groups) activations times the
+/// (T*R*S*C/groups) x (K/groups) filter of each group.
+///
+/// load_x(n, d, h, w, c) and load_w(k, t, r, s, c) read the operands, and
+/// store_y(n, z, p, q, k, acc) applies the epilogue.
+template <
+  typename ElementAccumulator,
+  typename InnerProductOp,
+  typename LoadX,
+  typename LoadW,
+  typename StoreY
+>
+void conv_fprop_im2col(
+  conv::Conv3dProblemSize const &problem,
+  LoadX load_x,
+  LoadW load_w,
+  StoreY store_y) {
+
+  int const groups = problem.groups;
+  int const channels_per_group = problem.C / groups;
+  int const filters_per_group = problem.K / groups;
+  int64_t const gemm_k = int64_t(problem.T) * problem.R * problem.S * channels_per_group;
+  int64_t const gemm_m = int64_t(problem.N) * problem.Z * problem.P * problem.Q;
+
+  // Filter of each group packed as a row-major gemm_k x (K/groups) matrix, so that a block of
+  // output channels is updated from contiguous memory
+  std::vector<ElementAccumulator> filter(size_t(problem.K * gemm_k));
+  reference::detail::parallel_for(problem.K, [&](int64_t k) {
+    int64_t const g = k / filters_per_group;
+    ElementAccumulator *col = filter.data() + g * gemm_k * filters_per_group + (k - g * filters_per_group);
+    for (int t = 0; t < problem.T; ++t) {
+      for (int r = 0; r < problem.R; ++r) {
+        for (int s = 0; s < problem.S; ++s) {
+          for (int c = 0; c < channels_per_group; ++c) {
+            *col = ElementAccumulator(load_w(int(k), t, r, s, c));
+            col += filters_per_group;
+          }
+        }
+      }
+    }
+  });
+
+  int64_t const chunk_rows = conv_im2col_chunk_rows<ElementAccumulator>(gemm_k);
+  int64_t const chunk_count = (gemm_m + chunk_rows - 1) / chunk_rows;
+
+  reference::detail::parallel_for(chunk_count, [&](int64_t chunk) {
+    InnerProductOp inner_product_op;
+
+    int64_t const row_begin = chunk * chunk_rows;
+    int64_t const rows = std::min(chunk_rows, gemm_m - row_begin);
+    std::vector<ElementAccumulator> im2col(size_t(rows * gemm_k));
+
+    for (int g = 0; g < groups; ++g) {
+
+      // Lower the activations of this group
+      for (int64_t i = 0; i < rows; ++i) {
+        int n, z, p, q;
+        conv_im2col_decompose(row_begin + i, problem.Z, problem.P, problem.Q, n, z, p, q);
+
+        ElementAccumulator *row = im2col.data() + i * gemm_k;
+        for (int t = 0; t < problem.T; ++t) {
+          for (int r = 0; r < problem.R; ++r) {
+            for (int s = 0; s < problem.S; ++s) {
+
+              int filter_t = t;
+              int filter_r = r;
+              int filter_s = s;
+
+              if (problem.mode == cutlass::conv::Mode::kConvolution) {
+                filter_t = problem.T - 1 - t;
+                filter_r = problem.R - 1 - r;
+                filter_s = problem.S - 1 - s;
+              }
+
+              int d = z * problem.stride_d - problem.pad_d + filter_t * problem.dilation_d;
+              int h = p * problem.stride_h - problem.pad_h + filter_r * problem.dilation_h;
+              int w = q * problem.stride_w - problem.pad_w + filter_s * problem.dilation_w;
+
+              bool valid = d >= 0 && d < problem.D && h >= 0 && h < problem.H && w >= 0 && w < problem.W;
+
+              for (int c = 0; c < channels_per_group; ++c) {
+                *row++ = valid
+                  ? ElementAccumulator(load_x(n, d, h, w, c + g * channels_per_group))
+                  : ElementAccumulator();
+              }
+            }
+          }
+        }
+      }
+
+      // Multiply by the filters of this group, one block of output channels at a time. The
+      // accumulators of a block are independent, so the innermost loop vectorizes while each
+      // of them still sums over gemm_k in order.
+      ElementAccumulator const *group_filter = filter.data() + g * gemm_k * filters_per_group;
+      for (int k_block = 0; k_block < filters_per_group; k_block += kConvIm2colBlockN) {
+        int const block_n = std::min(kConvIm2colBlockN, filters_per_group - k_block);
+
+        for (int64_t i = 0; i < rows; ++i) {
+          int n, z, p, q;
+          conv_im2col_decompose(row_begin + i, problem.Z, problem.P, problem.Q, n, z, p, q);
+
+          ElementAccumulator acc[kConvIm2colBlockN];
+          for (int j = 0; j < block_n; ++j) {
+            acc[j] = ElementAccumulator();
+          }
+
+          ElementAccumulator const *a = im2col.data() + i * gemm_k;
+          for (int64_t kk = 0; kk < gemm_k; ++kk) {
+            ElementAccumulator const *b = group_filter + kk * filters_per_group + k_block;
+            for (int j = 0; j < block_n; ++j) {
+              acc[j] = inner_product_op(a[kk], b[j], acc[j]);
+            }
+          }
+
+          for (int j = 0; j < block_n; ++j) {
+            store_y(n, z, p, q, g * filters_per_group + k_block + j, acc[j]);
+          }
+        }
+      }
+    }
+  });
+}
+
+/// Dgrad as a GEMM: (N*D*H*W) x (T*R*S*K) gathered output gradients times the
+/// (T*R*S*K) x C filter.
+///
+/// load_dy(n, z, p, q, k) and load_w(c, t, r, s, k) read the operands, where load_w resolves the
+/// filter layout for deconvolution, and store_dx(n, d, h, w, c, acc) applies the epilogue.
+template <
+  typename ElementAccumulator,
+  typename InnerProductOp,
+  typename LoadDy,
+  typename LoadW,
+  typename StoreDx
+>
+void conv_dgrad_im2col(
+  conv::Conv3dProblemSize const &problem,
+  LoadDy load_dy,
+  LoadW load_w,
+  StoreDx store_dx) {
+
+  int64_t const gemm_k = int64_t(problem.T) * problem.R * problem.S * problem.K;
+  int64_t const gemm_m = int64_t(problem.N) * problem.D * problem.H * problem.W;
+
+  // Filter packed as a row-major gemm_k x C matrix
+  std::vector<ElementAccumulator> filter(size_t(problem.C * gemm_k));
+  reference::detail::parallel_for(problem.C, [&](int64_t c) {
+    ElementAccumulator *col = filter.data() + c;
+    for (int t = 0; t < problem.T; ++t) {
+      for (int r = 0; r < problem.R; ++r) {
+        for (int s = 0; s < problem.S; ++s) {
+          for (int k = 0; k < problem.K; ++k) {
+            *col = ElementAccumulator(load_w(int(c), t, r, s, k));
+            col += problem.C;
+          }
+        }
+      }
+    }
+  });
+
+  int64_t const chunk_rows = conv_im2col_chunk_rows<ElementAccumulator>(gemm_k);
+  int64_t const chunk_count = (gemm_m + chunk_rows - 1) / chunk_rows;
+
+  reference::detail::parallel_for(chunk_count, [&](int64_t chunk) {
+    InnerProductOp inner_product_op;
+
+    int64_t const row_begin = chunk * chunk_rows;
+    int64_t const rows = std::min(chunk_rows, gemm_m - row_begin);
+    std::vector<ElementAccumulator> im2col(size_t(rows * gemm_k));
+
+    // Gather the output gradients each input position received
+    for (int64_t i = 0; i < rows; ++i) {
+      int n, d, h, w;
+      conv_im2col_decompose(row_begin + i, problem.D, problem.H, problem.W, n, d, h, w);
+
+      ElementAccumulator *row = im2col.data() + i * gemm_k;
+      for (int t = 0; t < problem.T; ++t) {
+        for (int r = 0; r < problem.R; ++r) {
+          for (int s = 0; s < problem.S; ++s) {
+
+            int filter_t = t;
+            int filter_r = r;
+            int filter_s = s;
+
+            if (problem.mode == cutlass::conv::Mode::kConvolution) {
+              filter_t = problem.T - 1 - t;
+              filter_r = problem.R - 1 - r;
+              filter_s = problem.S - 1 - s;
+            }
+
+            int z = d + problem.pad_d - filter_t * problem.dilation_d;
+            int p = h + problem.pad_h - filter_r * problem.dilation_h;
+            int q = w + problem.pad_w - filter_s * problem.dilation_w;
+
+            bool valid = z >= 0 && (z % problem.stride_d) == 0 &&
+                         p >= 0 && (p % problem.stride_h) == 0 &&
+                         q >= 0 && (q % problem.stride_w) == 0;
+
+            if (valid) {
+              z = z / problem.stride_d;
+              p = p / problem.stride_h;
+              q = q / problem.stride_w;
+              valid = z < problem.Z && p < problem.P && q < problem.Q;
+            }
+
+            for (int k = 0; k < problem.K; ++k) {
+              *row++ = valid ? ElementAccumulator(load_dy(n, z, p, q, k)) : ElementAccumulator();
+            }
+          }
+        }
+      }
+    }
+
+    for (int c_block = 0; c_block < problem.C; c_block += kConvIm2colBlockN) {
+      int const block_n = std::min(kConvIm2colBlockN, problem.C - c_block);
+
+      for (int64_t i = 0; i < rows; ++i) {
+        int n, d, h, w;
+        conv_im2col_decompose(row_begin + i, problem.D, problem.H, problem.W, n, d, h, w);
+
+        ElementAccumulator acc[kConvIm2colBlockN];
+        for (int j = 0; j < block_n; ++j) {
+          acc[j] = ElementAccumulator();
+        }
+
+        ElementAccumulator const *a = im2col.data() + i * gemm_k;
+        for (int64_t kk = 0; kk < gemm_k; ++kk) {
+          ElementAccumulator const *b = filter.data() + kk * problem.C + c_block;
+          for (int j = 0; j < block_n; ++j) {
+            acc[j] = inner_product_op(a[kk], b[j], acc[j]);
+          }
+        }
+
+        for (int j = 0; j < block_n; ++j) {
+          store_dx(n, d, h, w, c_block + j, acc[j]);
+        }
+      }
+    }
+  });
+}
+
+/// Wgrad as a GEMM: the K x (N*Z*P*Q) transposed output gradients times the
+/// (N*Z*P*Q) x (T*R*S*C) im2col activations. The reduction runs over N*Z*P*Q, so the im2col
+/// matrix is streamed in chunks of rows while K x (T*R*S*C) accumulators carry across chunks.
+///
+/// load_dy(n, z, p, q, k) and load_x(n, d, h, w, c) read the operands, and
+/// store_dw(k, t, r, s, c, acc) applies the epilogue.
+template <
+  typename ElementAccumulator,
+  typename InnerProductOp,
+  typename LoadDy,
+  typename LoadX,
+  typename StoreDw
+>
+void conv_wgrad_im2col(
+  conv::Conv3dProblemSize const &problem,
+  LoadDy load_dy,
+  LoadX load_x,
+  StoreDw store_dw) {
+
+  int64_t const gemm_n = int64_t(problem.T) * problem.R * problem.S * problem.C;
+  int64_t const gemm_k = int64_t(problem.N) * problem.Z * problem.P * problem.Q;
+
+  std::vector<ElementAccumulator> accumulators(size_t(problem.K * gemm_n), ElementAccumulator());
+
+  int64_t const chunk_rows = conv_im2col_chunk_rows<ElementAccumulator>(gemm_n + problem.K);
+  int64_t const n_blocks = (gemm_n + kConvIm2colBlockN - 1) / kConvIm2colBlockN;
+
+  std::vector<ElementAccumulator> im2col;
+  std::vector<ElementAccumulator> gradients;
+
+  // Chunks are reduced in order so that every accumulator sums its terms in the reference order
+  for (int64_t row_begin = 0; row_begin < gemm_k; row_begin += chunk_rows) {
+    int64_t const rows = std::min(chunk_rows, gemm_k - row_begin);
+    im2col.resize(size_t(rows * gemm_n));
+    gradients.resize(size_t(rows * problem.K));
+
+    reference::detail::parallel_for(rows, [&](int64_t i) {
+      int n, z, p, q;
+      conv_im2col_decompose(row_begin + i, problem.Z, problem.P, problem.Q, n, z, p, q);
+
+      ElementAccumulator *dy_row = gradients.data() + i * problem.K;
+      for (int k = 0; k < problem.K; ++k) {
+        dy_row[k] = ElementAccumulator(load_dy(n, z, p, q, k));
+      }
+
+      ElementAccumulator *row = im2col.data() + i * gemm_n;
+      for (int t = 0; t < problem.T; ++t) {
+        for (int r = 0; r < problem.R; ++r) {
+          for (int s = 0; s < problem.S; ++s) {
+
+            int filter_t = t;
+            int filter_r = r;
+            int filter_s = s;
+
+            if (problem.mode == cutlass::conv::Mode::kConvolution) {
+              filter_t = problem.T - 1 - t;
+              filter_r = problem.R - 1 - r;
+              filter_s = problem.S - 1 - s;
+            }
+
+            int d = z * problem.stride_d - problem.pad_d + filter_t * problem.dilation_d;
+            int h = p * problem.stride_h - problem.pad_h + filter_r * problem.dilation_h;
+            int w = q * problem.stride_w - problem.pad_w + filter_s * problem.dilation_w;
+
+            bool valid = d >= 0 && d < problem.D && h >= 0 && h < problem.H && w >= 0 && w < problem.W;
+
+            for (int c = 0; c < problem.C; ++c) {
+              *row++ = valid ? ElementAccumulator(load_x(n, d, h, w, c)) : ElementAccumulator();
+            }
+          }
+        }
+      }
+    });
+
+    // Each work item owns one row of filters and one block of columns of the accumulators
+    reference::detail::parallel_for(problem.K * n_blocks, [&](int64_t item) {
+      InnerProductOp inner_product_op;
+
+      int const k = int(item / n_blocks);
+      int64_t const j_begin = (item % n_blocks) * kConvIm2colBlockN;
+      int64_t const j_end = std::min<int64_t>(j_begin + kConvIm2colBlockN, gemm_n);
+
+      ElementAccumulator *acc = accumulators.data() + k * gemm_n;
+      for (int64_t i = 0; i < rows; ++i) {
+        ElementAccumulator const a = gradients[i * problem.K + k];
+        ElementAccumulator const *b = im2col.data() + i * gemm_n;
+        for (int64_t j = j_begin; j < j_end; ++j) {
+          acc[j] = inner_product_op(a, b[j], acc[j]);
+        }
+      }
+    });
+  }
+
+  reference::detail::parallel_for(problem.K, [&](int64_t k) {
+    ElementAccumulator const *acc = accumulators.data() + k * gemm_n;
+    for (int t = 0; t < problem.T; ++t) {
+      for (int r = 0; r < problem.R; ++r) {
+        for (int s = 0; s < problem.S; ++s) {
+          for (int c = 0; c < problem.C; ++c) {
+            store_dw(int(k), t, r, s, c, *acc++);
+          }
+        }
+      }
+    }
+  });
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// 2D convolution
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// y = conv2d(x, w), equivalent to Conv2dFprop
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv2dFpropIm2col(
+  conv::Conv2dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_x,
+  TensorRef<ElementB, LayoutB> tensor_w,
+  TensorRef<ElementC, LayoutC> tensor_y_in,
+  TensorRef<ElementD, LayoutC> tensor_y_out,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  detail::conv_fprop_im2col<ElementAccumulator, InnerProductOp>(
+    detail::conv_im2col_problem(problem_size),
+    [&](int n, int, int h, int w, int c) { return tensor_x.at({n, h, w, c}); },
+    [&](int k, int, int r, int s, int c) { return tensor_w.at({k, r, s, c}); },
+    [&](int n, int, int p, int q, int k, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_y_in.at(cutlass::make_Coord(n, p, q, k));
+      }
+      tensor_y_out.at(cutlass::make_Coord(n, p, q, k)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// dx = dgrad(dy, w), equivalent to Conv2dDgrad
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv2dDgradIm2col(
+  cutlass::conv::Conv2dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_dy,
+  TensorRef<ElementB, LayoutB> tensor_w,
+  TensorRef<ElementC, LayoutC> tensor_dx_in,
+  TensorRef<ElementD, LayoutC> tensor_dx_out,
+  ElementCompute alpha,
+  ElementCompute beta,
+  bool is_deconv = false) {
+
+  detail::conv_dgrad_im2col<ElementAccumulator, InnerProductOp>(
+    detail::conv_im2col_problem(problem_size),
+    [&](int n, int, int p, int q, int k) { return tensor_dy.at(cutlass::make_Coord(n, p, q, k)); },
+    [&](int c, int, int r, int s, int k) {
+      return is_deconv ? tensor_w.at(cutlass::make_Coord(c, r, s, k))
+                       : tensor_w.at(cutlass::make_Coord(k, r, s, c));
+    },
+    [&](int n, int, int h, int w, int c, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_dx_in.at(cutlass::make_Coord(n, h, w, c));
+      }
+      tensor_dx_out.at(cutlass::make_Coord(n, h, w, c)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// dw = wgrad(dy, x), equivalent to Conv2dWgrad
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv2dWgradIm2col(
+  cutlass::conv::Conv2dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_dy,
+  TensorRef<ElementB, LayoutB> tensor_x,
+  TensorRef<ElementC, LayoutC> tensor_dw_in,
+  TensorRef<ElementD, LayoutC> tensor_dw_out,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  detail::conv_wgrad_im2col<ElementAccumulator, InnerProductOp>(
+    detail::conv_im2col_problem(problem_size),
+    [&](int n, int, int p, int q, int k) { return tensor_dy.at(cutlass::make_Coord(n, p, q, k)); },
+    [&](int n, int, int h, int w, int c) { return tensor_x.at(cutlass::make_Coord(n, h, w, c)); },
+    [&](int k, int, int r, int s, int c, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_dw_in.at(cutlass::make_Coord(k, r, s, c));
+      }
+      tensor_dw_out.at(cutlass::make_Coord(k, r, s, c)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// Generic 2D convolution targeting Conv2dFpropIm2col, Conv2dDgradIm2col, and Conv2dWgradIm2col.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv2dIm2col(
+  conv::Operator convolutional_operator,
+  conv::Conv2dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_A,
+  TensorRef<ElementB, LayoutB> tensor_B,
+  TensorRef<ElementC, LayoutC> tensor_C,
+  TensorRef<ElementD, LayoutC> tensor_D,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  switch (convolutional_operator) {
+  case conv::Operator::kFprop:
+    Conv2dFpropIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ElementD,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    break;
+
+  case conv::Operator::kDeconv:
+  case conv::Operator::kDgrad:
+    Conv2dDgradIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ElementD,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv));
+    break;
+
+  case conv::Operator::kWgrad:
+    Conv2dWgradIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ElementD,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    break;
+
+  default:
+    break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// 3D convolution
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// y = conv3d(x, w), equivalent to Conv3dFprop. Grouped problems use the same channel
+/// partitioning as Conv2dFprop.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ConvertOp = NumericConverter<ElementC, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv3dFpropIm2col(
+  conv::Conv3dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_x,
+  TensorRef<ElementB, LayoutB> tensor_w,
+  TensorRef<ElementC, LayoutC> tensor_y_in,
+  TensorRef<ElementC, LayoutC> tensor_y_out,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  detail::conv_fprop_im2col<ElementAccumulator, InnerProductOp>(
+    problem_size,
+    [&](int n, int d, int h, int w, int c) { return tensor_x.at({n, d, h, w, c}); },
+    [&](int k, int t, int r, int s, int c) { return tensor_w.at({k, t, r, s, c}); },
+    [&](int n, int z, int p, int q, int k, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_y_in.at(cutlass::make_Coord(n, z, p, q, k));
+      }
+      tensor_y_out.at(cutlass::make_Coord(n, z, p, q, k)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// dx = dgrad(dy, w), equivalent to Conv3dDgrad
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ConvertOp = NumericConverter<ElementC, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv3dDgradIm2col(
+  cutlass::conv::Conv3dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_dy,
+  TensorRef<ElementB, LayoutB> tensor_w,
+  TensorRef<ElementC, LayoutC> tensor_dx_in,
+  TensorRef<ElementC, LayoutC> tensor_dx_out,
+  ElementCompute alpha,
+  ElementCompute beta,
+  bool is_deconv = false) {
+
+  detail::conv_dgrad_im2col<ElementAccumulator, InnerProductOp>(
+    problem_size,
+    [&](int n, int z, int p, int q, int k) { return tensor_dy.at(cutlass::make_Coord(n, z, p, q, k)); },
+    [&](int c, int t, int r, int s, int k) {
+      return is_deconv ? tensor_w.at(cutlass::make_Coord(c, t, r, s, k))
+                       : tensor_w.at(cutlass::make_Coord(k, t, r, s, c));
+    },
+    [&](int n, int d, int h, int w, int c, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_dx_in.at(cutlass::make_Coord(n, d, h, w, c));
+      }
+      tensor_dx_out.at(cutlass::make_Coord(n, d, h, w, c)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// dw = wgrad(dy, x), equivalent to Conv3dWgrad
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ConvertOp = NumericConverter<ElementC, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv3dWgradIm2col(
+  cutlass::conv::Conv3dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_dy,
+  TensorRef<ElementB, LayoutB> tensor_x,
+  TensorRef<ElementC, LayoutC> tensor_dw_in,
+  TensorRef<ElementC, LayoutC> tensor_dw_out,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  detail::conv_wgrad_im2col<ElementAccumulator, InnerProductOp>(
+    problem_size,
+    [&](int n, int z, int p, int q, int k) { return tensor_dy.at(cutlass::make_Coord(n, z, p, q, k)); },
+    [&](int n, int d, int h, int w, int c) { return tensor_x.at(cutlass::make_Coord(n, d, h, w, c)); },
+    [&](int k, int t, int r, int s, int c, ElementAccumulator acc) {
+      ConvertOp convert_op;
+      ElementC c_ref = ElementC();
+      if (beta != ElementCompute()) {
+        c_ref = tensor_dw_in.at(cutlass::make_Coord(k, t, r, s, c));
+      }
+      tensor_dw_out.at(cutlass::make_Coord(k, t, r, s, c)) =
+          convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+    });
+}
+
+/// Generic 3D convolution targeting Conv3dFpropIm2col, Conv3dDgradIm2col, and Conv3dWgradIm2col.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator = ElementCompute,
+  typename ConvertOp = NumericConverter<ElementC, ElementCompute>,
+  typename InnerProductOp = multiply_add<ElementAccumulator>
+>
+void Conv3dIm2col(
+  conv::Operator convolutional_operator,
+  conv::Conv3dProblemSize problem_size,
+  TensorRef<ElementA, LayoutA> tensor_A,
+  TensorRef<ElementB, LayoutB> tensor_B,
+  TensorRef<ElementC, LayoutC> tensor_C,
+  TensorRef<ElementC, LayoutC> tensor_D,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  switch (convolutional_operator) {
+  case conv::Operator::kFprop:
+    Conv3dFpropIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    break;
+
+  case conv::Operator::kDeconv:
+  case conv::Operator::kDgrad:
+    Conv3dDgradIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv));
+    break;
+
+  case conv::Operator::kWgrad:
+    Conv3dWgradIm2col<
+      ElementA, LayoutA,
+      ElementB, LayoutB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ConvertOp, InnerProductOp
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace host
+}  // namespace reference
+}  // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
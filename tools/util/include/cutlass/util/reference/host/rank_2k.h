@@ -43,6 +43,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
 #include "cutlass/util/reference/host/gemm.h"
 
 namespace cutlass {
@@ -103,67 +104,66 @@ void compute_rank2k(
   InnerProductOp inner_product_op;
   CompareOp compare_op;
 
-  for (int row_block = 0; row_block < N; row_block += Nblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
+  reference::detail::parallel_for_matrix_tiles(
+    N, N, Nblock, Nblock, FillModeC, [&](int row_block, int col_block) {
 
-      ComputeType accum[Nblock][Nblock];
+    ComputeType accum[Nblock][Nblock];
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Nblock; i++) {
-          accum[i][j] = initial_accum;
-        }
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Nblock; i++) {
+        accum[i][j] = initial_accum;
       }
+    }
 
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Nblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
+    for (int k_block = 0; k_block < K; ++k_block) {
+      for (int j = 0; j < Nblock; j++) {
+        for (int i = 0; i < Nblock; i++) {
+          int row = row_block + i;
+          int col = col_block + j;
 
-            if (row < N && col < N && compare_op(row, col)) 
-            {
+          if (row < N && col < N && compare_op(row, col)) 
+          {
 
-              // A x B^T
-              ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-              ElementB b_t = tensor_b.at(MatrixCoord(col, k_block));
+            // A x B^T
+            ElementA a = tensor_a.at(MatrixCoord(row, k_block));
+            ElementB b_t = tensor_b.at(MatrixCoord(col, k_block));
 
-              ComputeType compute_a(cast_if_scalar<ComputeType>(a));
-              ComputeType compute_b_t(cast_if_scalar<ComputeType>(b_t));
+            ComputeType compute_a(cast_if_scalar<ComputeType>(a));
+            ComputeType compute_b_t(cast_if_scalar<ComputeType>(b_t));
 
-              accum[i][j] = inner_product_op(compute_a, compute_b_t, accum[i][j]);
+            accum[i][j] = inner_product_op(compute_a, compute_b_t, accum[i][j]);
 
-              // B x A^T
-              ElementB b = tensor_b.at(MatrixCoord(row, k_block));
-              ElementA a_t = tensor_a.at(MatrixCoord(col, k_block));
+            // B x A^T
+            ElementB b = tensor_b.at(MatrixCoord(row, k_block));
+            ElementA a_t = tensor_a.at(MatrixCoord(col, k_block));
 
-              ComputeType compute_b(cast_if_scalar<ComputeType>(b));
-              ComputeType compute_a_t(cast_if_scalar<ComputeType>(a_t));
+            ComputeType compute_b(cast_if_scalar<ComputeType>(b));
+            ComputeType compute_a_t(cast_if_scalar<ComputeType>(a_t));
 
-              accum[i][j] = inner_product_op(compute_b, compute_a_t, accum[i][j]);
-            }
+            accum[i][j] = inner_product_op(compute_b, compute_a_t, accum[i][j]);
           }
         }
       }
+    }
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Nblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Nblock; i++) {
+        int row = row_block + i;
+        int col = col_block + j;
 
-          MatrixCoord coord = MatrixCoord(row, col);
+        MatrixCoord coord = MatrixCoord(row, col);
 
-          if (row < N && col < N && 
-              ( (FillModeC == FillMode::kLower && row >= col) || 
-                (FillModeC == FillMode::kUpper && row <= col) )
-          ) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]) +
-              beta * ScalarType(tensor_c.at(coord)));
-          }
+        if (row < N && col < N && 
+            ( (FillModeC == FillMode::kLower && row >= col) || 
+              (FillModeC == FillMode::kUpper && row <= col) )
+        ) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]) +
+            beta * ScalarType(tensor_c.at(coord)));
         }
       }
     }
-  }
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
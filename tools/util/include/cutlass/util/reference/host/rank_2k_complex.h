@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
 #include <assert.h>
 
 namespace cutlass {
@@ -110,130 +111,55 @@ void Rank2KComplex(
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
     // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
+    reference::detail::parallel_for_matrix_tiles(
+      M, N, Mblock, Nblock, fill_mode_c, [&](int row_block, int col_block) {
 
-        ComputeType accum[Mblock][Nblock];
+      ComputeType accum[Mblock][Nblock];
 
+      for (int j = 0; j < Nblock; j++) {
+        for (int i = 0; i < Mblock; i++) {
+          accum[i][j] = initial_accum;
+        }
+      }
+
+      for (int k_block = 0; k_block < K; ++k_block) {
         for (int j = 0; j < Nblock; j++) {
           for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
-        }
+            int row = row_block + i;
+            int col = col_block + j;
 
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N &&
-                 ( (fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col) )               
-                ) {
-                
-                // A x B^T (Symmetric) or A x B^H (Hermitian)
-                // complex conjugation on operandB (b_t) is function of blas3 computation
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementB b_t = (blas_mode == BlasMode::kHermitian) ? 
-                              conj(tensor_b.at(MatrixCoord(col, k_block))) : 
-                              tensor_b.at(MatrixCoord(col, k_block));
-
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_jk = ComputeType(b_t);
-
-                // complex conjugation is a function of operand layouts
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
-                // complex conjugation is a function of operand layouts
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_jk = conj(b_jk);
-                }
-
-                accum[i][j] = inner_product_op(a_ik, b_jk,  accum[i][j]);
+            if (row < M && col < N &&
+               ( (fill_mode_c == FillMode::kLower && row >= col) || 
+                (fill_mode_c == FillMode::kUpper && row <= col) )               
+              ) {
+              
+              // A x B^T (Symmetric) or A x B^H (Hermitian)
+              // complex conjugation on operandB (b_t) is function of blas3 computation
+              ElementA a = tensor_a.at(MatrixCoord(row, k_block));
+              ElementB b_t = (blas_mode == BlasMode::kHermitian) ? 
+                            conj(tensor_b.at(MatrixCoord(col, k_block))) : 
+                            tensor_b.at(MatrixCoord(col, k_block));
+
+              ComputeType a_ik = ComputeType(a);
+              ComputeType b_jk = ComputeType(b_t);
+
+              // complex conjugation is a function of operand layouts
+              if (transform_a == ComplexTransform::kConjugate) {
+                a_ik = conj(a_ik);
               }
-            }
-          }
-        }
-
-        /* HER2K need two epilogues to handle complex alpha value */
-        if ( blas_mode == BlasMode::kHermitian ) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              MatrixCoord coord = MatrixCoord(row, col);
-
-              if (row < M && col < N && 
-                  ((fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col))
-                ) {
-
-                ScalarType c = tensor_c.at(coord);
-                // The imaginary parts of the diagonal elements of 
-                // a complex data type are assumed and set to zero
-                if (blas_mode == BlasMode::kHermitian) {
-                  c = (row == col) ? real(c) : c;
-                }
-
-                tensor_d.at(coord) = convert_op(alpha * 
-                  ScalarType(accum[i][j]) + 
-                  beta * c);
+              // complex conjugation is a function of operand layouts
+              if (transform_b == ComplexTransform::kConjugate) {
+                b_jk = conj(b_jk);
               }
-            }
-          }
-          
-          /* Zeoring out accum for second HERK */
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              accum[i][j] = initial_accum;
-            }
-          }
-        }
 
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N &&
-                 ( (fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col) )               
-                ) {
-
-                // B x A^T (Symmetric) or B x A^H (Hermitian)
-                // complex conjugation on operandB (a_t) is function of blas3 computation
-                ElementB b = tensor_b.at(MatrixCoord(row, k_block));
-                ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
-                                conj(tensor_a.at(MatrixCoord(col, k_block))):
-                                tensor_a.at(MatrixCoord(col, k_block));
-
-                ComputeType b_ik = ComputeType(b);
-                ComputeType a_jk = ComputeType(a_t);
-                
-                // complex conjugation here is a function of operand layouts
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_ik = conj(b_ik);
-                }
-                // complex conjugation here is a function of operand layouts
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_jk = conj(a_jk);
-                }
-
-                accum[i][j] = inner_product_op(b_ik, a_jk, accum[i][j]);
-              }
+              accum[i][j] = inner_product_op(a_ik, b_jk,  accum[i][j]);
             }
           }
         }
+      }
 
-        ScalarType alpha_hermitian = (blas_mode == BlasMode::kHermitian) ? 
-                                      conj(alpha) : alpha;
-        ScalarType beta_hermitian = (blas_mode == BlasMode::kHermitian) ? 
-                                      1 : beta;
-        
+      /* HER2K need two epilogues to handle complex alpha value */
+      if ( blas_mode == BlasMode::kHermitian ) {
         for (int j = 0; j < Nblock; j++) {
           for (int i = 0; i < Mblock; i++) {
             int row = row_block + i;
@@ -243,27 +169,100 @@ void Rank2KComplex(
 
             if (row < M && col < N && 
                 ((fill_mode_c == FillMode::kLower && row >= col) || 
-                 (fill_mode_c == FillMode::kUpper && row <= col))
+                (fill_mode_c == FillMode::kUpper && row <= col))
               ) {
 
-              ScalarType d = (blas_mode == BlasMode::kHermitian) ? 
-                             tensor_d.at(coord) : tensor_c.at(coord);
+              ScalarType c = tensor_c.at(coord);
+              // The imaginary parts of the diagonal elements of 
+              // a complex data type are assumed and set to zero
+              if (blas_mode == BlasMode::kHermitian) {
+                c = (row == col) ? real(c) : c;
+              }
+
+              tensor_d.at(coord) = convert_op(alpha * 
+                ScalarType(accum[i][j]) + 
+                beta * c);
+            }
+          }
+        }
+        
+        /* Zeoring out accum for second HERK */
+        for (int j = 0; j < Nblock; j++) {
+          for (int i = 0; i < Mblock; i++) {
+            accum[i][j] = initial_accum;
+          }
+        }
+      }
 
-              ScalarType tmp_d = convert_op(
-                alpha_hermitian * ScalarType(accum[i][j]) + 
-                beta_hermitian * d);
+      for (int k_block = 0; k_block < K; ++k_block) {
+        for (int j = 0; j < Nblock; j++) {
+          for (int i = 0; i < Mblock; i++) {
+            int row = row_block + i;
+            int col = col_block + j;
 
-              if (blas_mode == BlasMode::kHermitian && row == col ) {
-                tensor_d.at(coord) = real(tmp_d);
-              } else {
-                tensor_d.at(coord) = tmp_d;
+            if (row < M && col < N &&
+               ( (fill_mode_c == FillMode::kLower && row >= col) || 
+                (fill_mode_c == FillMode::kUpper && row <= col) )               
+              ) {
+
+              // B x A^T (Symmetric) or B x A^H (Hermitian)
+              // complex conjugation on operandB (a_t) is function of blas3 computation
+              ElementB b = tensor_b.at(MatrixCoord(row, k_block));
+              ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
+                              conj(tensor_a.at(MatrixCoord(col, k_block))):
+                              tensor_a.at(MatrixCoord(col, k_block));
+
+              ComputeType b_ik = ComputeType(b);
+              ComputeType a_jk = ComputeType(a_t);
+              
+              // complex conjugation here is a function of operand layouts
+              if (transform_b == ComplexTransform::kConjugate) {
+                b_ik = conj(b_ik);
+              }
+              // complex conjugation here is a function of operand layouts
+              if (transform_a == ComplexTransform::kConjugate) {
+                a_jk = conj(a_jk);
               }
+
+              accum[i][j] = inner_product_op(b_ik, a_jk, accum[i][j]);
             }
           }
         }
-
-      } // for (col_block)
-    } // for (row_block)
+      }
+
+      ScalarType alpha_hermitian = (blas_mode == BlasMode::kHermitian) ? 
+                                    conj(alpha) : alpha;
+      ScalarType beta_hermitian = (blas_mode == BlasMode::kHermitian) ? 
+                                    1 : beta;
+      
+      for (int j = 0; j < Nblock; j++) {
+        for (int i = 0; i < Mblock; i++) {
+          int row = row_block + i;
+          int col = col_block + j;
+
+          MatrixCoord coord = MatrixCoord(row, col);
+
+          if (row < M && col < N && 
+              ((fill_mode_c == FillMode::kLower && row >= col) || 
+               (fill_mode_c == FillMode::kUpper && row <= col))
+            ) {
+
+            ScalarType d = (blas_mode == BlasMode::kHermitian) ? 
+                           tensor_d.at(coord) : tensor_c.at(coord);
+
+            ScalarType tmp_d = convert_op(
+              alpha_hermitian * ScalarType(accum[i][j]) + 
+              beta_hermitian * d);
+
+            if (blas_mode == BlasMode::kHermitian && row == col ) {
+              tensor_d.at(coord) = real(tmp_d);
+            } else {
+              tensor_d.at(coord) = tmp_d;
+            }
+          }
+        }
+      }
+    });
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_b.add_pointer_offset(batch_stride_B);
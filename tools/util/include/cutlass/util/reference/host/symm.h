@@ -44,6 +44,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
 #include "cutlass/util/reference/host/gemm.h"
 
 namespace cutlass {
@@ -110,81 +111,80 @@ void compute_symm(
   CompareOp_w_diag compare_op_1;
   CompareOp_wo_diag compare_op_2;
 
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
+  reference::detail::parallel_for_matrix_tiles(
+    M, N, Mblock, Nblock, FillMode::kFull, [&](int row_block, int col_block) {
 
-      ComputeType accum[Mblock][Nblock];
+    ComputeType accum[Mblock][Nblock];
 
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Mblock; i++) {
+        accum[i][j] = initial_accum;
+      }
+    }
+
+    for (int k_block = 0; k_block < K; ++k_block) {
       for (int j = 0; j < Nblock; j++) {
         for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
+          int row = row_block + i;
+          int col = col_block + j;
+
+          if (row < M && col < N) {
+            ElementA a_1 = ElementA();
+            ElementB b_1 = ElementB();
+            ElementA a_2 = ElementA();
+            ElementB b_2 = ElementB();
+
+            // A x B or B x A (with diagonal)
+            if (SideModeA == SideMode::kLeft) {
+              a_1 = (compare_op_1(row, k_block)) ? 
+                    (tensor_a.at(MatrixCoord(row, k_block))) : ElementA();
+              b_1 = tensor_b.at(MatrixCoord(k_block, col));
+            } else if (SideModeA == SideMode::kRight) {
+              a_1 = tensor_b.at(MatrixCoord(row, k_block));
+              b_1 = (compare_op_1(k_block, col)) ? 
+                    tensor_a.at(MatrixCoord(k_block, col)) : ElementA();
+            }
+
+            ComputeType compute_a_1(cast_if_scalar<ComputeType>(a_1));
+            ComputeType compute_b_1(cast_if_scalar<ComputeType>(b_1));
 
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < M && col < N) {
-              ElementA a_1 = ElementA();
-              ElementB b_1 = ElementB();
-              ElementA a_2 = ElementA();
-              ElementB b_2 = ElementB();
-
-              // A x B or B x A (with diagonal)
-              if (SideModeA == SideMode::kLeft) {
-                a_1 = (compare_op_1(row, k_block)) ? 
-                      (tensor_a.at(MatrixCoord(row, k_block))) : ElementA();
-                b_1 = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a_1 = tensor_b.at(MatrixCoord(row, k_block));
-                b_1 = (compare_op_1(k_block, col)) ? 
-                      tensor_a.at(MatrixCoord(k_block, col)) : ElementA();
-              }
-
-              ComputeType compute_a_1(cast_if_scalar<ComputeType>(a_1));
-              ComputeType compute_b_1(cast_if_scalar<ComputeType>(b_1));
-
-              accum[i][j] = inner_product_op(compute_a_1, compute_b_1, accum[i][j]);
-
-              // A^T x B or B x A^T (without diagonal)
-              if (SideModeA == SideMode::kLeft) {
-                a_2 = (compare_op_2(k_block, row)) ? 
-                      (tensor_a.at(MatrixCoord(k_block, row))) : ElementA();
-                b_2 = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a_2 = tensor_b.at(MatrixCoord(row, k_block));
-                b_2 = (compare_op_2(col, k_block)) ? 
-                      tensor_a.at(MatrixCoord(col, k_block)) : ElementA();
-              }
-
-              ComputeType compute_a_2(cast_if_scalar<ComputeType>(a_2));
-              ComputeType compute_b_2(cast_if_scalar<ComputeType>(b_2));
-
-              accum[i][j] = inner_product_op(compute_a_2, compute_b_2, accum[i][j]);
+            accum[i][j] = inner_product_op(compute_a_1, compute_b_1, accum[i][j]);
+
+            // A^T x B or B x A^T (without diagonal)
+            if (SideModeA == SideMode::kLeft) {
+              a_2 = (compare_op_2(k_block, row)) ? 
+                    (tensor_a.at(MatrixCoord(k_block, row))) : ElementA();
+              b_2 = tensor_b.at(MatrixCoord(k_block, col));
+            } else if (SideModeA == SideMode::kRight) {
+              a_2 = tensor_b.at(MatrixCoord(row, k_block));
+              b_2 = (compare_op_2(col, k_block)) ? 
+                    tensor_a.at(MatrixCoord(col, k_block)) : ElementA();
             }
+
+            ComputeType compute_a_2(cast_if_scalar<ComputeType>(a_2));
+            ComputeType compute_b_2(cast_if_scalar<ComputeType>(b_2));
+
+            accum[i][j] = inner_product_op(compute_a_2, compute_b_2, accum[i][j]);
           }
         }
       }
+    }
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Mblock; i++) {
+        int row = row_block + i;
+        int col = col_block + j;
 
-          MatrixCoord coord = MatrixCoord(row, col);
+        MatrixCoord coord = MatrixCoord(row, col);
 
-          if (row < M && col < N) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]) +
-              beta * ScalarType(tensor_c.at(coord)));
-          }
+        if (row < M && col < N) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]) +
+            beta * ScalarType(tensor_c.at(coord)));
         }
       }
     }
-  }
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
 #include <assert.h>
 
 namespace cutlass {
@@ -124,97 +125,95 @@ void compute_symm_complex(
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
     // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
+    reference::detail::parallel_for_matrix_tiles(
+      M, N, Mblock, Nblock, FillMode::kFull, [&](int row_block, int col_block) {
 
-        ComputeType accum[Mblock][Nblock];
+      ComputeType accum[Mblock][Nblock];
 
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
-        }
-
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N) 
-              {
-                ElementA a_1 = ElementA();
-                ElementB b_1 = ElementB();
-                ElementA a_2 = ElementA();
-                ElementB b_2 = ElementB();
-                
-                // A x B or B x A (with diagonal)
-                if (kSideModeA == SideMode::kLeft) {
-                  a_1 = (compare_op_1(row, k_block)) ? 
-                        (tensor_a.at(MatrixCoord(row, k_block))) : ElementA();
-                  b_1 = tensor_b.at(MatrixCoord(k_block, col));
-                } else if (kSideModeA == SideMode::kRight) {
-                  a_1 = tensor_b.at(MatrixCoord(row, k_block));
-                  b_1 = (compare_op_1(k_block, col)) ? 
-                        tensor_a.at(MatrixCoord(k_block, col)) : ElementA();
-                }
-                ComputeType compute_a_1 = ComputeType(a_1);
-                ComputeType compute_b_1 = ComputeType(b_1);
-
-                // The imaginary parts of the diagonal elements of 
-                // a complex data type are assumed and set to zero
-                if (kBlasMode == BlasMode::kHermitian && kSideModeA == SideMode::kLeft && row == k_block) {
-                  compute_a_1 = real(compute_a_1);
-                } else if (kBlasMode == BlasMode::kHermitian && kSideModeA == SideMode::kRight && k_block == col) {
-                  compute_b_1 = real(compute_b_1);
-                }
-
-                accum[i][j] = inner_product_op(compute_a_1, compute_b_1,  accum[i][j]);
-
-                // A^T x B or B x A^T (without diagonal)
-                if (kSideModeA == SideMode::kLeft) {
-                  a_2 = (compare_op_2(k_block, row)) ? 
-                        (tensor_a.at(MatrixCoord(k_block, row))) : ElementA();
-                  b_2 = tensor_b.at(MatrixCoord(k_block, col));
-                  if (kBlasMode == BlasMode::kHermitian)
-                    a_2 = conj(a_2);
-                } else if (kSideModeA == SideMode::kRight) {
-                  a_2 = tensor_b.at(MatrixCoord(row, k_block));
-                  b_2 = (compare_op_2(col, k_block)) ? 
-                        tensor_a.at(MatrixCoord(col, k_block)) : ElementA();
-                  if (kBlasMode == BlasMode::kHermitian)
-                    b_2 = conj(b_2);
-                }
-
-                ComputeType compute_a_2 = ComputeType(a_2);
-                ComputeType compute_b_2 = ComputeType(b_2);
-
-                accum[i][j] = inner_product_op(compute_a_2, compute_b_2, accum[i][j]);
-              }
-            }
-          }
+      for (int j = 0; j < Nblock; j++) {
+        for (int i = 0; i < Mblock; i++) {
+          accum[i][j] = initial_accum;
         }
+      }
 
+      for (int k_block = 0; k_block < K; ++k_block) {
         for (int j = 0; j < Nblock; j++) {
           for (int i = 0; i < Mblock; i++) {
             int row = row_block + i;
             int col = col_block + j;
 
-            MatrixCoord coord = MatrixCoord(row, col);
+            if (row < M && col < N) 
+            {
+              ElementA a_1 = ElementA();
+              ElementB b_1 = ElementB();
+              ElementA a_2 = ElementA();
+              ElementB b_2 = ElementB();
+              
+              // A x B or B x A (with diagonal)
+              if (kSideModeA == SideMode::kLeft) {
+                a_1 = (compare_op_1(row, k_block)) ? 
+                      (tensor_a.at(MatrixCoord(row, k_block))) : ElementA();
+                b_1 = tensor_b.at(MatrixCoord(k_block, col));
+              } else if (kSideModeA == SideMode::kRight) {
+                a_1 = tensor_b.at(MatrixCoord(row, k_block));
+                b_1 = (compare_op_1(k_block, col)) ? 
+                      tensor_a.at(MatrixCoord(k_block, col)) : ElementA();
+              }
+              ComputeType compute_a_1 = ComputeType(a_1);
+              ComputeType compute_b_1 = ComputeType(b_1);
+
+              // The imaginary parts of the diagonal elements of 
+              // a complex data type are assumed and set to zero
+              if (kBlasMode == BlasMode::kHermitian && kSideModeA == SideMode::kLeft && row == k_block) {
+                compute_a_1 = real(compute_a_1);
+              } else if (kBlasMode == BlasMode::kHermitian && kSideModeA == SideMode::kRight && k_block == col) {
+                compute_b_1 = real(compute_b_1);
+              }
 
-            if (row < M && col < N) {
+              accum[i][j] = inner_product_op(compute_a_1, compute_b_1,  accum[i][j]);
+
+              // A^T x B or B x A^T (without diagonal)
+              if (kSideModeA == SideMode::kLeft) {
+                a_2 = (compare_op_2(k_block, row)) ? 
+                      (tensor_a.at(MatrixCoord(k_block, row))) : ElementA();
+                b_2 = tensor_b.at(MatrixCoord(k_block, col));
+                if (kBlasMode == BlasMode::kHermitian)
+                  a_2 = conj(a_2);
+              } else if (kSideModeA == SideMode::kRight) {
+                a_2 = tensor_b.at(MatrixCoord(row, k_block));
+                b_2 = (compare_op_2(col, k_block)) ? 
+                      tensor_a.at(MatrixCoord(col, k_block)) : ElementA();
+                if (kBlasMode == BlasMode::kHermitian)
+                  b_2 = conj(b_2);
+              }
 
-              ScalarType c = tensor_c.at(coord);
+              ComputeType compute_a_2 = ComputeType(a_2);
+              ComputeType compute_b_2 = ComputeType(b_2);
 
-              tensor_d.at(coord) = convert_op(
-                alpha * ScalarType(accum[i][j]) + 
-                beta * c);
+              accum[i][j] = inner_product_op(compute_a_2, compute_b_2, accum[i][j]);
             }
           }
         }
+      }
+
+      for (int j = 0; j < Nblock; j++) {
+        for (int i = 0; i < Mblock; i++) {
+          int row = row_block + i;
+          int col = col_block + j;
+
+          MatrixCoord coord = MatrixCoord(row, col);
 
-      } // for (col_block)
-    } // for (row_block)
+          if (row < M && col < N) {
+
+            ScalarType c = tensor_c.at(coord);
+
+            tensor_d.at(coord) = convert_op(
+              alpha * ScalarType(accum[i][j]) + 
+              beta * c);
+          }
+        }
+      }
+    });
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_b.add_pointer_offset(batch_stride_B);
@@ -39,6 +39,7 @@
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
 #include "tensor_foreach.h"
 
 namespace cutlass {
@@ -76,6 +77,9 @@ struct TensorCopyIf {
   using DstTensorView = TensorView<DstElement, DstLayout>;
   using SrcTensorView = TensorView<SrcElement, SrcLayout>;
 
+  /// Destinations narrower than a byte are read-modify-written and must be copied serially
+  static bool const kParallelSafe = (sizeof_bits<DstElement>::value >= 8);
+
   //
   // Data members
   //
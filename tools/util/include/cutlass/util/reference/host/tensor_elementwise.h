@@ -37,6 +37,7 @@
 // Cutlass includes
 #include "cutlass/cutlass.h"
 #include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
 
 #include "tensor_foreach.h"
 
@@ -62,6 +63,9 @@ template <
   typename BinaryFunc>
 struct TensorFuncBinaryOp {
 
+  /// Safe to visit concurrently unless ElementD packs several elements per byte
+  static bool const kParallelSafe = (sizeof_bits<ElementD>::value >= 8);
+
   //
   // Data members
   //
@@ -73,6 +73,9 @@ struct TensorFillFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// Writes depend only on the coordinate. Sub-byte elements share storage and are filled serially.
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -94,6 +97,74 @@ struct TensorFillFunc {
   }
 };
 
+/// Counter-based random number generator. The i-th value of a stream is a SplitMix64 hash of
+/// (seed, stream, i), so every block of a parallel fill can draw from its own stream without
+/// sharing state with the other blocks.
+struct CounterBasedRandom {
+
+  uint64_t key;
+  uint64_t counter;
+
+  static uint64_t mix(uint64_t z) {
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  CounterBasedRandom(uint64_t seed = 0, uint64_t stream = 0):
+    key(mix(seed ^ mix(stream))), counter(0) { }
+
+  /// Returns the next 64 random bits of the stream
+  uint64_t next() {
+    return mix(key + 0x9e3779b97f4a7c15ull * (++counter));
+  }
+
+  /// Returns a value uniformly distributed in (0, 1]
+  double uniform() {
+    return (double(next() >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+  }
+
+  /// Returns true with probability p
+  bool bernoulli(double p) {
+    return uniform() < p;
+  }
+};
+
+/// Source of the uniform values drawn by the random fill functors. It draws from std::rand(),
+/// which the functors seed on construction, so seeded fills reproduce their existing data. Once
+/// seed_block() is called it draws from the CounterBasedRandom stream of (seed, block) instead;
+/// the parallel for-each policy does this for every block of a fill.
+struct BlockRandomSource {
+
+  bool block_seeded = false;
+  CounterBasedRandom rng;
+
+  void seed_block(uint64_t seed, int64_t block) {
+    rng = CounterBasedRandom(seed, uint64_t(block));
+    block_seeded = true;
+  }
+
+  /// Returns a value uniformly distributed in [0, 1], or in (0, 1] once block-seeded
+  double uniform() {
+    return block_seeded ? rng.uniform() : double(std::rand()) / double(RAND_MAX);
+  }
+
+  /// Returns true with probability p
+  bool nonzero(double p) {
+    if (p >= 1.0) {
+      return true;
+    }
+    if (block_seeded) {
+      return rng.bernoulli(p);
+    }
+    std::random_device rnd_device;
+    std::mt19937 bernoulli_rnd(rnd_device());
+    std::bernoulli_distribution bernoulli_dist(p);
+    return bernoulli_dist(bernoulli_rnd);
+  }
+};
+
 /// Returns a pair of values of the Gaussian distribution generated by the Box Muller method 
 struct BoxMullerFunc {
 
@@ -105,8 +176,19 @@ struct BoxMullerFunc {
     double  stddev = 1,              ///< Standard deviation of the Gaussian distribution
     double  pi = std::acos(-1)) const {
 
-    double u1 = double(std::rand()) / double(RAND_MAX);
-    double u2 = double(std::rand()) / double(RAND_MAX);
+    BlockRandomSource source;
+    (*this)(source, rnd, mean, stddev, pi);
+  }
+
+  void operator()(
+    BlockRandomSource &source,       ///< Source of uniform random values
+    double* rnd,                     ///< Size-2 vector to be filled with random values
+    double  mean = 0,                ///< Mean of the Gaussian distribution
+    double  stddev = 1,              ///< Standard deviation of the Gaussian distribution
+    double  pi = std::acos(-1)) const {
+
+    double u1 = source.uniform();
+    double u2 = source.uniform();
     rnd[0] = std::sqrt(-2 * std::log(u1)) * std::cos(2 * pi * u2);
     rnd[1] = std::sqrt(-2 * std::log(u1)) * std::sin(2 * pi * u2);
     rnd[0] = mean + stddev * rnd[0];
@@ -160,6 +242,10 @@ struct RandomGaussianFunc {
   double pi;
   double pnz;
   bool exclude_zero;
+  mutable BlockRandomSource source;
+
+  /// Every block of a parallel fill draws from its own stream, so blocks may be filled concurrently
+  static bool const kParallelSafe = true;
 
   //
   // Methods
@@ -176,12 +262,17 @@ struct RandomGaussianFunc {
       std::srand((unsigned)seed);
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
+
   /// Compute random value and update RNG state
   Element operator()() const {
 
     // Box-Muller transform to generate random numbers with Normal distribution
-    double u1 = double(std::rand()) / double(RAND_MAX);
-    double u2 = double(std::rand()) / double(RAND_MAX);
+    double u1 = source.uniform();
+    double u2 = source.uniform();
 
     // Compute Gaussian random value
     double rnd = std::sqrt(-2 * std::log(u1)) * std::cos(2 * pi * u2);
@@ -191,10 +282,7 @@ struct RandomGaussianFunc {
     Element result;
 
     // Sample from the Bernoulli distribution, and use the result to sample from the Gaussian
-    std::random_device rnd_device;
-    std::mt19937 bernoulli_rnd(rnd_device());
-    std::bernoulli_distribution bernoulli_dist(pnz);
-    bool bernoulli_result = bernoulli_dist(bernoulli_rnd);
+    bool bernoulli_result = source.nonzero(pnz);
 
     // Sample from the Gaussian distribution for a nonzero element
     if (bernoulli_result) {
@@ -235,6 +323,10 @@ struct RandomGaussianFunc<complex<Element> > {
   double pi;
   double pnz;
   bool exclude_zero;
+  mutable BlockRandomSource source;
+
+  /// See RandomGaussianFunc
+  static bool const kParallelSafe = true;
 
   //
   // Methods
@@ -251,6 +343,11 @@ struct RandomGaussianFunc<complex<Element> > {
       std::srand((unsigned)seed);
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
+
   /// Compute random value and update RNG state
   complex<Element> operator()() const {
 
@@ -258,13 +355,10 @@ struct RandomGaussianFunc<complex<Element> > {
 
     double rnd[2];
     detail::BoxMullerFunc func;
-    func(rnd, mean, stddev, pi);
+    func(source, rnd, mean, stddev, pi);
 
     // Sample from the Bernoulli distribution, and use the result to sample from the Gaussian
-    std::random_device rnd_device;
-    std::mt19937 bernoulli_rnd(rnd_device());
-    std::bernoulli_distribution bernoulli_dist(pnz);
-    bool bernoulli_result = bernoulli_dist(bernoulli_rnd);
+    bool bernoulli_result = source.nonzero(pnz);
 
     // Sample from the Gaussian distribution for a nonzero element
     if (bernoulli_result) {
@@ -312,6 +406,10 @@ struct RandomGaussianFunc<Quaternion<Element> > {
   double pi;
   double pnz;
   bool exclude_zero;
+  mutable BlockRandomSource source;
+
+  /// See RandomGaussianFunc
+  static bool const kParallelSafe = true;
 
   //
   // Methods
@@ -328,6 +426,11 @@ struct RandomGaussianFunc<Quaternion<Element> > {
       std::srand((unsigned)seed);
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
+
   /// Compute random value and update RNG state
   Quaternion<Element> operator()() const {
 
@@ -336,14 +439,11 @@ struct RandomGaussianFunc<Quaternion<Element> > {
     double rnd1[2];
     double rnd2[2];
     detail::BoxMullerFunc func;
-    func(rnd1, mean, stddev, pi);
-    func(rnd2, mean, stddev, pi);
+    func(source, rnd1, mean, stddev, pi);
+    func(source, rnd2, mean, stddev, pi);
 
     // Sample from the Bernoulli distribution, and use the result to sample from the Gaussian
-    std::random_device rnd_device;
-    std::mt19937 bernoulli_rnd(rnd_device());
-    std::bernoulli_distribution bernoulli_dist(pnz);
-    bool bernoulli_result = bernoulli_dist(bernoulli_rnd);
+    bool bernoulli_result = source.nonzero(pnz);
 
     // Sample from the Gaussian distribution for a nonzero element
     if (bernoulli_result) {
@@ -399,6 +499,9 @@ struct TensorFillGaussianFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// Blocks draw from their own streams. Sub-byte elements share storage and are filled serially.
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -419,6 +522,11 @@ struct TensorFillGaussianFunc {
 
   }
 
+  /// Switches to the random stream of one block of the index space (see TensorForEach)
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
   /// Compute random value and update RNG state
   void operator()(Coord<Layout::kRank> const &coord) const {
     view.at(coord) = func();
@@ -433,6 +541,9 @@ struct TensorFillSymmetricGaussianFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillGaussianFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -455,6 +566,11 @@ struct TensorFillSymmetricGaussianFunc {
 
   }
 
+  /// Switches to the random stream of one block of the index space (see TensorForEach)
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
   /// Compute random value and update RNG state
   void operator()(Coord<Layout::kRank> const &coord) const {
     // Fill half of matrix based on FillMode
@@ -486,7 +602,8 @@ void TensorFillRandomGaussian(
   int bits = -1,                          ///< If non-negative, specifies number of fractional bits that 
   double pnz = 1.0,                     ///  are not truncated to zero. Permits reducing precision of
                                           ///  data.
-  bool exclude_zero = false) {            ///< Exclude zeros from tensor init.
+  bool exclude_zero = false,              ///< Exclude zeros from tensor init.
+  ForEachPolicy policy = ForEachPolicy::kAuto) { ///< kParallel fills blocks from per-block streams
   
   detail::RandomGaussianFunc<Element> random_func(seed, mean, stddev, bits, pnz, exclude_zero);
 
@@ -497,7 +614,8 @@ void TensorFillRandomGaussian(
 
   TensorForEach(
     dst.extent(),
-    func
+    func,
+    policy
   );
 }
 
@@ -550,6 +668,46 @@ void TensorFillSymmetricRandomGaussian(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+/// Fills ptr[0, capacity) from a random functor. Serial fills draw one sequence from the functor
+/// as constructed. Parallel fills reseed a copy of the functor for every block of
+/// kForEachBlockSize elements, so their data does not depend on the number of threads.
+template <typename Element, typename RandomFunc>
+void BlockFillFromRandomFunc(
+  Element *ptr,
+  size_t capacity,
+  RandomFunc &random_func,
+  ForEachPolicy policy) {
+
+  bool const parallel = (sizeof_bits<Element>::value >= 8) &&
+    use_parallel_for_each<RandomFunc>(policy, int64_t(capacity));
+
+  if (!parallel) {
+    for (size_t i = 0; i < capacity; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = random_func();
+    }
+    return;
+  }
+
+  int64_t const blocks = (int64_t(capacity) + kForEachBlockSize - 1) / kForEachBlockSize;
+
+  ForEachBlock(blocks, true, [&](int64_t block) {
+    RandomFunc func(random_func);
+    func.seed_block(block);
+
+    size_t const begin = size_t(block * kForEachBlockSize);
+    size_t const end = std::min(capacity, begin + size_t(kForEachBlockSize));
+    for (size_t i = begin; i < end; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = func();
+    }
+  });
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Fills a tensor with random values of a Gaussian distribution.
 template <
   typename Element                        ///< Element type
@@ -561,15 +719,14 @@ void BlockFillRandomGaussian(
   double mean = 0,                        ///< Gaussian distribution's mean
   double stddev = 1,                      ///< Gaussian distribution's standard deviation
   int bits = -1,                          ///< If non-negative, specifies number of fractional bits that 
-  double pnz = 1.0) {                   ///  are not truncated to zero. Permits reducing precision of
+  double pnz = 1.0,                     ///  are not truncated to zero. Permits reducing precision of
                                           ///  data.
+  ForEachPolicy policy = ForEachPolicy::kAuto) { ///< kParallel fills blocks from per-block streams
   
 
   detail::RandomGaussianFunc<Element> random_func(seed, mean, stddev, bits, pnz);
 
-  for (size_t i = 0; i < capacity; ++i) {
-    ReferenceFactory<Element>::get(ptr, i) = random_func();
-  }
+  detail::BlockFillFromRandomFunc(ptr, capacity, random_func, policy);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -594,6 +751,10 @@ private:
 public:
   engine_type bernoulli_rnd;
   std::bernoulli_distribution bernoulli_dist;
+  BlockRandomSource source;
+
+  /// Every block of a parallel fill draws from its own stream, so blocks may be filled concurrently
+  static bool const kParallelSafe = true;
 
   bool exclude_zero;
 
@@ -619,18 +780,22 @@ public:
       }
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
 
   /// Compute random value and update RNG state
   Element operator()() {
 
     // Sample from NaN distribution.
     if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
-      if (pnan > 0 && bernoulli_dist(bernoulli_rnd)) {
+      if (pnan > 0 && (source.block_seeded ? source.rng.bernoulli(pnan) : bernoulli_dist(bernoulli_rnd))) {
         return Element(NAN);
       }
     }
 
-    double rnd = double(std::rand()) / double(RAND_MAX);
+    double rnd = source.uniform();
 
     rnd = min + range * rnd;
 
@@ -675,6 +840,10 @@ private:
 public:
   engine_type bernoulli_rnd;
   std::bernoulli_distribution bernoulli_dist;
+  BlockRandomSource source;
+
+  /// See RandomUniformFunc
+  static bool const kParallelSafe = true;
 
   bool exclude_zero;
 
@@ -703,13 +872,17 @@ public:
       }
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
 
   /// Compute random value and update RNG state
   complex<Element> operator()() {
 
     // Sample from NaN distribution.
     if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
-      if (pnan > 0 && bernoulli_dist(bernoulli_rnd)) {
+      if (pnan > 0 && (source.block_seeded ? source.rng.bernoulli(pnan) : bernoulli_dist(bernoulli_rnd))) {
         return Element(NAN);
       }
     }
@@ -717,7 +890,7 @@ public:
     Element reals[2];
 
     for (int i = 0; i < 2; ++i) {
-      double rnd = double(std::rand()) / double(RAND_MAX);
+      double rnd = source.uniform();
 
       rnd = min + range * rnd;
 
@@ -767,6 +940,10 @@ private:
 public:
   engine_type bernoulli_rnd;
   std::bernoulli_distribution bernoulli_dist;
+  BlockRandomSource source;
+
+  /// See RandomUniformFunc
+  static bool const kParallelSafe = true;
 
   //
   // Methods
@@ -786,13 +963,17 @@ public:
     std::srand((unsigned)seed);
   }
 
+  /// Switches to the stream of one block of a parallel fill (see BlockForEach)
+  void seed_block(int64_t block) {
+    source.seed_block(seed, block);
+  }
 
   /// Compute random value and update RNG state
   Quaternion<Element> operator()() {
 
     // Sample from NaN distribution.
     if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
-      if (pnan > 0 && bernoulli_dist(bernoulli_rnd)) {
+      if (pnan > 0 && (source.block_seeded ? source.rng.bernoulli(pnan) : bernoulli_dist(bernoulli_rnd))) {
         return Element(NAN);
       }
     }
@@ -800,7 +981,7 @@ public:
     Element reals[4];
 
     for (int i = 0; i < 4; ++i) {
-      double rnd = double(std::rand()) / double(RAND_MAX);
+      double rnd = source.uniform();
 
       rnd = min + range * rnd;
 
@@ -828,6 +1009,9 @@ struct TensorFillRandomUniformFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillGaussianFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -848,6 +1032,11 @@ struct TensorFillRandomUniformFunc {
 
   }
 
+  /// Switches to the random stream of one block of the index space (see TensorForEach)
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
   /// Compute random value and update RNG state
   void operator()(Coord<Layout::kRank> const &coord) {
 
@@ -863,6 +1052,9 @@ struct TensorFillSymmetricRandomUniformFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillGaussianFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -885,6 +1077,11 @@ struct TensorFillSymmetricRandomUniformFunc {
 
   }
 
+  /// Switches to the random stream of one block of the index space (see TensorForEach)
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
   /// Compute random value and update RNG state
   void operator()(Coord<Layout::kRank> const &coord) {
     // Fill half of matrix based on FillMode
@@ -908,6 +1105,9 @@ struct TensorFillPadDiagonalRandomUniformFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillGaussianFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -932,6 +1132,11 @@ struct TensorFillPadDiagonalRandomUniformFunc {
 
   }
 
+  /// Switches to the random stream of one block of the index space (see TensorForEach)
+  void seed_block(int64_t block) {
+    func.seed_block(block);
+  }
+
   /// Compute random value and update RNG state
   void operator()(Coord<Layout::kRank> const &coord) {
     // Fill half of matrix based on FillMode
@@ -966,7 +1171,8 @@ void TensorFillRandomUniform(
                                           ///  are not truncated to zero. Permits reducing precision of
                                           ///  data.
   double pnan = 0,                        ///< Percentage of NaN elements.
-  bool exclude_zero = false) {            ///< Exclude zero from tensor init  
+  bool exclude_zero = false,              ///< Exclude zero from tensor init  
+  ForEachPolicy policy = ForEachPolicy::kAuto) { ///< kParallel fills blocks from per-block streams
   detail::RandomUniformFunc<Element> random_func(seed, max, min, bits, pnan, exclude_zero);
 
   detail::TensorFillRandomUniformFunc<Element, Layout> func(
@@ -976,7 +1182,8 @@ void TensorFillRandomUniform(
 
   TensorForEach(
     dst.extent(),
-    func
+    func,
+    policy
   );
 }
 
@@ -1116,12 +1323,11 @@ void BlockFillRandomUniform(
   int bits = -1,                          ///< If non-negative, specifies number of fractional bits that 
                                           ///  are not truncated to zero. Permits reducing precision of
                                           ///  data.
-  double pnan = 0) {                      ///< Percentage of NaN elements.
+  double pnan = 0,                        ///< Percentage of NaN elements.
+  ForEachPolicy policy = ForEachPolicy::kAuto) { ///< kParallel fills blocks from per-block streams
   detail::RandomUniformFunc<Element> random_func(seed, max, min, bits, pnan);
 
-  for (size_t i = 0; i < capacity; ++i) {
-    ReferenceFactory<Element>::get(ptr, i) = random_func();
-  }
+  detail::BlockFillFromRandomFunc(ptr, capacity, random_func, policy);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1135,6 +1341,9 @@ struct TensorFillDiagonalFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -1238,6 +1447,9 @@ struct TensorUpdateOffDiagonalFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
@@ -1308,6 +1520,9 @@ struct TensorFillLinearFunc {
 
   using TensorView = TensorView<Element, Layout>;
 
+  /// See TensorFillFunc
+  static bool const kParallelSafe = (sizeof_bits<Element>::value >= 8);
+
   //
   // Data members
   //
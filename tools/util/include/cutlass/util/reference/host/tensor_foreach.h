@@ -30,8 +30,15 @@
  **************************************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 #include "cutlass/cutlass.h"
+#include "cutlass/coord.h"
+#include "cutlass/util/reference/detail/host_parallel.h"
 
 namespace cutlass  {
 namespace reference {
@@ -82,6 +89,153 @@ struct TensorForEachHelper<Func, Rank, 0> {
   }
 };
 
+/// Number of points visited by one unit of parallel work
+static int64_t const kForEachBlockSize = int64_t(1) << 14;
+
+/// Functors that draw from a random sequence declare
+///   void seed_block(int64_t block);
+/// Serial loops visit them unchanged, so they keep producing their usual sequence. Parallel loops
+/// give every block its own copy of the functor seeded from (seed, block index), so the data of a
+/// parallel fill does not depend on the number of threads.
+template <typename Func, typename Enable = void>
+struct IsBlockSeeded : std::false_type { };
+
+template <typename Func>
+struct IsBlockSeeded<Func, decltype(std::declval<Func &>().seed_block(int64_t()))>
+  : std::true_type { };
+
+/// Calls visit(block) for every block in [0, blocks), on the host thread pool if parallel is set
+template <typename Visit>
+void ForEachBlock(int64_t blocks, bool parallel, Visit &&visit) {
+  if (parallel) {
+    reference::detail::parallel_for(blocks, visit);
+  }
+  else {
+    for (int64_t block = 0; block < blocks; ++block) {
+      visit(block);
+    }
+  }
+}
+
+/// Visits the index space in fixed, contiguous blocks of rows. The ranks above the innermost one
+/// are linearized, so the points of each block depend only on the extent and not on the number
+/// of threads. Block-seeded functors are copied and reseeded for every block; other functors are
+/// shared by all blocks.
+template <typename Func, int Rank>
+void TensorForEachBlocked(Func &func, Coord<Rank> const &extent, bool parallel) {
+
+  // Rank-1 index spaces are cut into blocks of single points
+  int const kRowRanks = (Rank > 1 ? Rank - 1 : Rank);
+
+  int64_t rows = 1;
+  for (int i = 0; i < kRowRanks; ++i) {
+    rows *= extent[i];
+  }
+  int64_t const columns = (Rank > 1 ? extent[Rank - 1] : 1);
+
+  if (rows <= 0 || columns <= 0) {
+    return;
+  }
+
+  int64_t const rows_per_block = std::max<int64_t>(1, kForEachBlockSize / columns);
+  int64_t const blocks = (rows + rows_per_block - 1) / rows_per_block;
+
+  auto visit_rows = [&](Func &block_func, int64_t block) {
+    Coord<Rank> coord;
+    int64_t const row_end = std::min(rows, (block + 1) * rows_per_block);
+
+    for (int64_t row = block * rows_per_block; row < row_end; ++row) {
+      int64_t residue = row;
+      for (int i = kRowRanks - 1; i >= 0; --i) {
+        coord[i] = int(residue % extent[i]);
+        residue /= extent[i];
+      }
+
+      if (Rank > 1) {
+        for (int j = 0; j < extent[Rank - 1]; ++j) {
+          coord[Rank - 1] = j;
+          block_func(coord);
+        }
+      }
+      else {
+        block_func(coord);
+      }
+    }
+  };
+
+  ForEachBlock(blocks, parallel, [&](int64_t block) {
+    if constexpr (IsBlockSeeded<Func>::value) {
+      Func block_func(func);
+      block_func.seed_block(block);
+      visit_rows(block_func, block);
+    }
+    else {
+      visit_rows(func, block);
+    }
+  });
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Execution policy of TensorForEach and BlockForEach
+enum class ForEachPolicy {
+  kSerial,                ///< visit every point in order on the calling thread
+  kParallel,              ///< split the index space across the host thread pool
+  kAuto                   ///< kParallel for large index spaces, except for block-seeded functors
+};
+
+/// Minimum number of points for which ForEachPolicy::kAuto runs in parallel
+static int64_t const kParallelForEachThreshold = int64_t(1) << 16;
+
+/// Functors that may be invoked concurrently on distinct points opt in by declaring
+///   static bool const kParallelSafe = true;
+/// Functors that accumulate state leave it undeclared and are always visited serially, whatever
+/// the policy says.
+template <typename Func, typename Enable = void>
+struct IsParallelSafe : std::false_type { };
+
+template <typename Func>
+struct IsParallelSafe<Func, std::enable_if_t<Func::kParallelSafe>> : std::true_type { };
+
+/// Wraps a callable, such as a lambda, that may be invoked concurrently on distinct points
+template <typename Func>
+struct ParallelSafeFunc {
+
+  static bool const kParallelSafe = true;
+
+  Func func;
+
+  template <typename... Args>
+  void operator()(Args const &... args) const {
+    func(args...);
+  }
+};
+
+/// Marks func as safe to visit in parallel
+template <typename Func>
+ParallelSafeFunc<Func> make_parallel_safe(Func func) {
+  return ParallelSafeFunc<Func>{func};
+}
+
+namespace detail {
+
+/// Resolves a policy against the functor and the size of the index space
+template <typename Func>
+bool use_parallel_for_each(ForEachPolicy policy, int64_t points) {
+  switch (policy) {
+    case ForEachPolicy::kParallel:
+      return IsParallelSafe<std::decay_t<Func>>::value;
+    case ForEachPolicy::kAuto:
+      // Random fills keep their serial sequence unless kParallel is requested explicitly
+      return IsParallelSafe<std::decay_t<Func>>::value && !IsBlockSeeded<std::decay_t<Func>>::value &&
+        points >= kParallelForEachThreshold;
+    default:
+      return false;
+  }
+}
+
 } // namespace detail
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,18 +244,41 @@ struct TensorForEachHelper<Func, Rank, 0> {
 template <
   typename Func,          ///< function applied to each point in a tensor's index space
   int Rank>               ///< rank of index space
-void TensorForEach(Coord<Rank> extent, Func & func) {
+void TensorForEach(
+  Coord<Rank> extent,
+  Func & func,
+  ForEachPolicy policy = ForEachPolicy::kAuto) {
+
+  bool const parallel = detail::use_parallel_for_each<Func>(policy, int64_t(extent.product()));
+
+  if (parallel) {
+    detail::TensorForEachBlocked<Func, Rank>(func, extent, parallel);
+    return;
+  }
+
   Coord<Rank> coord;
   detail::TensorForEachHelper<Func, Rank, Rank - 1>(func, extent, coord);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Iterates over the index space of a tensor and calls a C++ lambda
+/// Iterates over the index space of a tensor and calls a C++ lambda. Lambdas cannot declare
+/// kParallelSafe and are visited serially unless wrapped with make_parallel_safe().
 template <
   typename Func,          ///< function applied to each point in a tensor's index space
   int Rank>               ///< rank of index space
-void TensorForEachLambda(Coord<Rank> extent, Func func) {
+void TensorForEachLambda(
+  Coord<Rank> extent,
+  Func func,
+  ForEachPolicy policy = ForEachPolicy::kAuto) {
+
+  bool const parallel = detail::use_parallel_for_each<Func>(policy, int64_t(extent.product()));
+
+  if (parallel) {
+    detail::TensorForEachBlocked<Func, Rank>(func, extent, parallel);
+    return;
+  }
+
   Coord<Rank> coord;
   detail::TensorForEachHelper<Func, Rank, Rank - 1>(func, extent, coord);
 }
@@ -111,11 +288,34 @@ void TensorForEachLambda(Coord<Rank> extent, Func func) {
 template <typename Element, typename Func>
 struct BlockForEach {
 
-  /// Constructor performs the operation.
+  /// Constructor performs the operation. Under the parallel policy every block of the
+  /// allocation is produced by its own copy of the functor constructed from params, and
+  /// block-seeded functors are reseeded for every block.
   BlockForEach(
     Element *ptr, 
     size_t capacity,
-    typename Func::Params params = typename Func::Params()) {
+    typename Func::Params params = typename Func::Params(),
+    ForEachPolicy policy = ForEachPolicy::kAuto) {
+
+    bool const parallel = detail::use_parallel_for_each<Func>(policy, int64_t(capacity));
+
+    if (parallel) {
+      int64_t const blocks =
+        (int64_t(capacity) + detail::kForEachBlockSize - 1) / detail::kForEachBlockSize;
+
+      detail::ForEachBlock(blocks, parallel, [&](int64_t block) {
+        Func func(params);
+        if constexpr (detail::IsBlockSeeded<Func>::value) {
+          func.seed_block(block);
+        }
+        size_t const begin = size_t(block * detail::kForEachBlockSize);
+        size_t const end = std::min(capacity, begin + size_t(detail::kForEachBlockSize));
+        for (size_t index = begin; index < end; ++index) {
+          ptr[index] = func();
+        }
+      });
+      return;
+    }
   
     Func func(params);
 
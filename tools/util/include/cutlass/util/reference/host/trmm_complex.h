@@ -42,6 +42,7 @@
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
 
+#include "cutlass/util/reference/detail/host_parallel.h"
 #include "cutlass/util/reference/host/gemm.h"
 
 namespace cutlass {
@@ -101,74 +102,73 @@ void compute_trmm_complex(
   InnerProductOp inner_product_op;
   CompareOp compare_op;
   
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
+  reference::detail::parallel_for_matrix_tiles(
+    M, N, Mblock, Nblock, FillMode::kFull, [&](int row_block, int col_block) {
 
-      ComputeType accum[Mblock][Nblock];
+    ComputeType accum[Mblock][Nblock];
 
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Mblock; i++) {
+        accum[i][j] = initial_accum;
+      }
+    }
+
+    for (int k_block = 0; k_block < K; ++k_block) {
       for (int j = 0; j < Nblock; j++) {
         for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
+          int row = row_block + i;
+          int col = col_block + j;
 
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < M && col < N) {
-              ElementA a = ElementA();
-              ElementB b = ElementB();
-              
-              if (SideModeA == SideMode::kLeft) {
-                a = (compare_op(row, k_block)) ? 
-                              (tensor_a.at(MatrixCoord(row, k_block))) : ElementA(0);
-                if (row == k_block && DiagTypeA == DiagType::kUnit) {
-                  a = ElementA(1);
-                }
-                b = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a = tensor_b.at(MatrixCoord(row, k_block));
-                b = (compare_op(k_block, col)) ? 
-                      tensor_a.at(MatrixCoord(k_block, col)) : ElementA(0);
-                if (k_block == col && DiagTypeA == DiagType::kUnit) {
-                  b = ElementA(1);
-                }
+          if (row < M && col < N) {
+            ElementA a = ElementA();
+            ElementB b = ElementB();
+            
+            if (SideModeA == SideMode::kLeft) {
+              a = (compare_op(row, k_block)) ? 
+                            (tensor_a.at(MatrixCoord(row, k_block))) : ElementA(0);
+              if (row == k_block && DiagTypeA == DiagType::kUnit) {
+                a = ElementA(1);
               }
-
-              ComputeType a_ik = ComputeType(a);
-              ComputeType b_kj = ComputeType(b);
-              
-              // Conjugate, and hence hermitian, is only allowed for the triangular matrix
-              if (SideModeA == SideMode::kLeft && TransformA == ComplexTransform::kConjugate) {
-                a_ik = conj(a_ik);
-              } else if (SideModeA == SideMode::kRight && TransformA == ComplexTransform::kConjugate) {
-                b_kj = conj(b_kj);
+              b = tensor_b.at(MatrixCoord(k_block, col));
+            } else if (SideModeA == SideMode::kRight) {
+              a = tensor_b.at(MatrixCoord(row, k_block));
+              b = (compare_op(k_block, col)) ? 
+                    tensor_a.at(MatrixCoord(k_block, col)) : ElementA(0);
+              if (k_block == col && DiagTypeA == DiagType::kUnit) {
+                b = ElementA(1);
               }
+            }
 
-              accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
+            ComputeType a_ik = ComputeType(a);
+            ComputeType b_kj = ComputeType(b);
+            
+            // Conjugate, and hence hermitian, is only allowed for the triangular matrix
+            if (SideModeA == SideMode::kLeft && TransformA == ComplexTransform::kConjugate) {
+              a_ik = conj(a_ik);
+            } else if (SideModeA == SideMode::kRight && TransformA == ComplexTransform::kConjugate) {
+              b_kj = conj(b_kj);
             }
+
+            accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
           }
         }
       }
+    }
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
+    for (int j = 0; j < Nblock; j++) {
+      for (int i = 0; i < Mblock; i++) {
+        int row = row_block + i;
+        int col = col_block + j;
 
-          MatrixCoord coord = MatrixCoord(row, col);
+        MatrixCoord coord = MatrixCoord(row, col);
 
-          if (row < M && col < N) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]));
-          }
+        if (row < M && col < N) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]));
         }
       }
     }
-  }
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
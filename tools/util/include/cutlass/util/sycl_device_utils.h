@@ -0,0 +1,133 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief Launch configuration helpers shared by the SYCL utility kernels (normalization,
+ *        layout transforms, pooling).
+ */
+
+#include <sycl/sycl.hpp>
+#include <syclcompat.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+
+namespace cutlass {
+namespace detail {
+
+/// Number of elements of T per access: the widest access of up to 16 bytes that divides the
+/// row length and keeps every pointer aligned.
+template <typename T>
+int sycl_vector_width(int n, std::initializer_list<void const*> ptrs) {
+  int width = std::max(1, int(16 / sizeof(T)));
+  for (; width > 1; width /= 2) {
+    bool aligned = n % width == 0;
+    for (void const* ptr : ptrs) {
+      aligned = aligned && reinterpret_cast<uintptr_t>(ptr) % (width * sizeof(T)) == 0;
+    }
+    if (aligned) {
+      break;
+    }
+  }
+  return width;
+}
+
+/// Largest work-group used by the utility kernels. Capped by the device limit, so that the same
+/// kernels also run on CPU devices.
+inline int sycl_max_work_group_size(sycl::queue const& queue) {
+  return int(std::min<size_t>(1024, queue.get_device().get_info<sycl::info::device::max_work_group_size>()));
+}
+
+/// Width of the local-memory tiles used by transposing kernels: the device's sub-group width,
+/// 16 on Intel GPUs and CPUs, 32 on devices which only run 32-wide sub-groups.
+inline int sycl_tile_width(sycl::queue const& queue) {
+  auto sizes = queue.get_device().get_info<sycl::info::device::sub_group_sizes>();
+  return std::find(sizes.begin(), sizes.end(), size_t(16)) != sizes.end() ? 16 : 32;
+}
+
+/// Widest access returned by sycl_vector_width<T>()
+template <typename T>
+constexpr int sycl_max_vector_width = std::max(1, int(16 / sizeof(T)));
+
+/// Calls f(std::integral_constant<int, kVecSize>{}) for a vector width of 1, 2, 4, 8 or 16. Only
+/// widths up to kMaxVecSize are instantiated, wider ones are served by the widest of those.
+template <int kMaxVecSize = 8, typename F>
+void sycl_dispatch_vector_width(int width, F&& f) {
+  if constexpr (kMaxVecSize >= 16) {
+    if (width >= 16) {
+      f(std::integral_constant<int, 16>{});
+      return;
+    }
+  }
+  if (width >= 8) {
+    f(std::integral_constant<int, 8>{});
+  }
+  else if (width >= 4) {
+    f(std::integral_constant<int, 4>{});
+  }
+  else if (width >= 2) {
+    f(std::integral_constant<int, 2>{});
+  }
+  else {
+    f(std::integral_constant<int, 1>{});
+  }
+}
+
+/// Picks the register-resident variant for `vectors` accesses per reduction: calls
+/// f(std::integral_constant<int, kItemsPerThread>{}, work_group_size) with the smallest
+/// kItemsPerThread in {1, 2, 4, 8, 16} whose work-group covers all of them. Returns false if
+/// even 16 items per work-item are not enough, the caller then falls back to reloading.
+template <typename F>
+bool sycl_norm_dispatch_items_per_thread(int vectors, int max_work_group_size, F&& f) {
+  auto work_group_size = [&](int items) {
+    int work_items = (vectors + items - 1) / items;
+    return std::min(max_work_group_size, std::max(32, (work_items + 31) / 32 * 32));
+  };
+  auto fits = [&](int items) {
+    return vectors <= items * max_work_group_size;
+  };
+
+  if (fits(1))  { f(std::integral_constant<int, 1>{},  work_group_size(1));  return true; }
+  if (fits(2))  { f(std::integral_constant<int, 2>{},  work_group_size(2));  return true; }
+  if (fits(4))  { f(std::integral_constant<int, 4>{},  work_group_size(4));  return true; }
+  if (fits(8))  { f(std::integral_constant<int, 8>{},  work_group_size(8));  return true; }
+  if (fits(16)) { f(std::integral_constant<int, 16>{}, work_group_size(16)); return true; }
+  return false;
+}
+
+} // namespace detail
+} // namespace cutlass
@@ -0,0 +1,279 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL elementwise and broadcast kernels over cute tensors, applying any functor (e.g. the
+ *        epilogue/thread activations or cutlass/functional.h operators) to up to four inputs.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+#include "cute/tensor.hpp"
+
+namespace cutlass {
+
+/// Largest number of input tensors of an elementwise kernel
+static constexpr int kSyclElementwiseMaxInputs = 4;
+
+namespace detail {
+
+/// Views a rank-2 (M, N) tensor as a rank-3 (M, N, L) tensor with L = 1
+template <class Engine, class Layout>
+auto sycl_elementwise_mnl(cute::Tensor<Engine, Layout> const& tensor) {
+  static_assert(Layout::rank == 2 || Layout::rank == 3, "Elementwise operands are (M, N) or (M, N, L) tensors.");
+  if constexpr (Layout::rank == 2) {
+    return cute::make_tensor(tensor.data(), cute::append<3>(tensor.layout(), cute::Layout<cute::_1, cute::_0>{}));
+  }
+  else {
+    return tensor;
+  }
+}
+
+/// Whether vec_size consecutive elements along N can be accessed with aligned accesses of up to
+/// 16 bytes for every row and batch. Operands broadcast along N are read once per access instead.
+template <class Engine, class Layout>
+bool sycl_elementwise_vectorizes(cute::Tensor<Engine, Layout> const& tensor, int vec_size) {
+  using Element = typename Engine::value_type;
+  int64_t stride_n = cute::get<1>(tensor.stride());
+  if (stride_n == 0) {
+    return true;
+  }
+  auto ptr = reinterpret_cast<uintptr_t>(cute::raw_pointer_cast(tensor.data()));
+  return stride_n == 1 &&
+         int64_t(cute::get<0>(tensor.stride())) % vec_size == 0 &&
+         int64_t(cute::get<2>(tensor.stride())) % vec_size == 0 &&
+         ptr % std::min<size_t>(vec_size * sizeof(Element), 16) == 0;
+}
+
+/// Loads kVecSize consecutive elements along N starting at (m, n, l), converted to ElementCompute
+template <class ElementCompute, FloatRoundStyle Round, int kVecSize, class Tensor>
+inline Array<ElementCompute, kVecSize> sycl_elementwise_load(Tensor const& tensor, int m, int n, int l) {
+  using Element = cute::remove_cvref_t<typename Tensor::value_type>;
+  constexpr int kMaxVecBits = cute::min(128, kVecSize * sizeof_bits<Element>::value);
+  NumericArrayConverter<ElementCompute, Element, kVecSize, Round> convert;
+
+  auto ptr = tensor.data() + tensor.layout()(m, n, l);
+  AlignedArray<Element, kVecSize> frag;
+  if constexpr (kVecSize == 1) {
+    frag[0] = *ptr;
+  }
+  else {
+    if (cute::get<1>(tensor.stride()) == 0) {
+      frag.fill(*ptr);
+    }
+    else {
+      auto src = cute::make_tensor(ptr, cute::Layout<cute::Int<kVecSize>>{});
+      auto dst = cute::make_tensor(frag.data(), cute::Layout<cute::Int<kVecSize>>{});
+      cute::copy(cute::AutoVectorizingCopyWithAssumedAlignment<kMaxVecBits>{}, src, dst);
+    }
+  }
+  return convert(frag);
+}
+
+/// Applies the functor to whole fragments when it takes them, and to every element otherwise
+template <class Functor, class ElementCompute, int kVecSize, class... Fragments>
+inline Array<ElementCompute, kVecSize> sycl_elementwise_apply(Functor const& functor, Fragments const&... frags) {
+  if constexpr (std::is_invocable_v<Functor const&, Fragments const&...>) {
+    return functor(frags...);
+  }
+  else {
+    Array<ElementCompute, kVecSize> result;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kVecSize; ++i) {
+      result[i] = functor(frags[i]...);
+    }
+    return result;
+  }
+}
+
+/**
+ * out(m, n, l) = functor(in_0(m, n, l), ...) over (M, N, L) tensors. Each work-item computes
+ * kVecSize consecutive elements along N and strides over the problem by the size of the grid, so
+ * the grid can be capped to what keeps the device's memory system busy. The (n, m, l) coordinates
+ * of the first vector and of the stride are decomposed once per work-item, the loop then only
+ * adds them with carries.
+ */
+template <class ElementCompute, FloatRoundStyle Round, int kVecSize, class Functor, class OutTensor, class... InTensors>
+void elementwise_kernel(sycl::queue& queue, OutTensor out, Functor functor, int work_group_size, int max_groups,
+                        InTensors... in) {
+  using ElementOutput = cute::remove_cvref_t<typename OutTensor::value_type>;
+  constexpr int kMaxVecBits = cute::min(128, kVecSize * sizeof_bits<ElementOutput>::value);
+
+  const int M = cute::size<0>(out);
+  const int N = cute::size<1>(out);
+  const int L = cute::size<2>(out);
+  const int vectors_n = N / kVecSize;
+  const int64_t total = int64_t(vectors_n) * M * L;
+  const size_t groups = std::min<int64_t>((total + work_group_size - 1) / work_group_size, max_groups);
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(groups * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      NumericArrayConverter<ElementOutput, ElementCompute, kVecSize, Round> convert_output;
+      const int64_t grid_size = item.get_global_range(0);
+      const int64_t first = item.get_global_id(0);
+      if (first >= total) {
+        return;
+      }
+
+      int vector_n = int(first % vectors_n);
+      int m = int(first / vectors_n % M);
+      int l = int(first / vectors_n / M);
+
+      const int step_n = int(grid_size % vectors_n);
+      const int step_m = int(grid_size / vectors_n % M);
+      const int step_l = int(grid_size / vectors_n / M);
+
+      for (int64_t idx = first; idx < total; idx += grid_size) {
+        const int n = vector_n * kVecSize;
+
+        auto result = sycl_elementwise_apply<Functor, ElementCompute, kVecSize>(
+          functor, sycl_elementwise_load<ElementCompute, Round, kVecSize>(in, m, n, l)...);
+
+        AlignedArray<ElementOutput, kVecSize> frag;
+        static_cast<Array<ElementOutput, kVecSize>&>(frag) = convert_output(result);
+
+        auto ptr = out.data() + out.layout()(m, n, l);
+        if constexpr (kVecSize == 1) {
+          *ptr = frag[0];
+        }
+        else {
+          auto src = cute::make_tensor(frag.data(), cute::Layout<cute::Int<kVecSize>>{});
+          auto dst = cute::make_tensor(ptr, cute::Layout<cute::Int<kVecSize>>{});
+          cute::copy(cute::AutoVectorizingCopyWithAssumedAlignment<kMaxVecBits>{}, src, dst);
+        }
+
+        vector_n += step_n;
+        m += step_m;
+        l += step_l;
+        if (vector_n >= vectors_n) {
+          vector_n -= vectors_n;
+          ++m;
+        }
+        if (m >= M) {
+          m -= M;
+          ++l;
+        }
+      }
+    });
+}
+
+} // namespace detail
+
+/**
+ * \brief out(m, n, l) = functor(in_0(m, n, l), ..., in_k(m, n, l)) for one to four inputs
+ *
+ * All operands are (M, N) or (M, N, L) cute tensors over device memory with the shape of `out`.
+ * An input is broadcast along a mode by giving it a stride of 0 there, e.g. a bias of N elements
+ * is make_tensor(make_gmem_ptr(bias), make_shape(M, N), make_stride(_0{}, _1{})). Inputs are
+ * converted to ElementCompute, and the result is converted to the element type of `out`, with
+ * NumericArrayConverter.
+ *
+ * The functor is called with one Array<ElementCompute, kVecSize> per input when it accepts arrays
+ * of any kVecSize in {1, 2, 4, 8, 16}, and with one ElementCompute per input otherwise, so the scalar
+ * epilogue/thread functors and cutlass/functional.h operators can be used as they are. It is
+ * copied to the device.
+ *
+ * Accesses along N are vectorized up to 16 bytes of the narrowest operand when every operand is
+ * contiguous or broadcast along N and suitably aligned. Other strides fall back to scalar accesses.
+ */
+template <class ElementCompute = float,
+          FloatRoundStyle Round = FloatRoundStyle::round_to_nearest,
+          class Functor, class OutEngine, class OutLayout, class... InEngines, class... InLayouts>
+Status elementwise(sycl::queue queue,
+                   cute::Tensor<OutEngine, OutLayout> const& out,
+                   Functor const& functor,
+                   cute::Tensor<InEngines, InLayouts> const&... in) {
+  static_assert(sizeof...(InEngines) >= 1 && sizeof...(InEngines) <= kSyclElementwiseMaxInputs,
+                "Elementwise kernels take one to four inputs.");
+
+  auto out_mnl = detail::sycl_elementwise_mnl(out);
+
+  // The output is written once per element, and the inputs cover the whole output
+  auto writes_once = [](int64_t extent, int64_t stride) { return extent <= 1 || stride != 0; };
+  bool valid = writes_once(cute::size<0>(out_mnl), cute::get<0>(out_mnl.stride())) &&
+               writes_once(cute::size<1>(out_mnl), cute::get<1>(out_mnl.stride())) &&
+               writes_once(cute::size<2>(out_mnl), cute::get<2>(out_mnl.stride()));
+  valid = valid && (... && bool(cute::shape(detail::sycl_elementwise_mnl(in)) == cute::shape(out_mnl)));
+  if (!valid) {
+    return Status::kErrorInvalidProblem;
+  }
+  if (cute::size(out_mnl) == 0) {
+    return Status::kSuccess;
+  }
+
+  const int N = cute::size<1>(out_mnl);
+  const int min_element_size = std::min({int(sizeof(typename OutEngine::value_type)),
+                                         int(sizeof(typename InEngines::value_type))...});
+  int width = std::max(1, 16 / min_element_size);
+  for (; width > 1; width /= 2) {
+    if (N % width == 0 &&
+        detail::sycl_elementwise_vectorizes(out_mnl, width) &&
+        (... && detail::sycl_elementwise_vectorizes(detail::sycl_elementwise_mnl(in), width))) {
+      break;
+    }
+  }
+
+  // Enough work-groups to keep every compute unit busy, each work-item then loops over the rest:
+  // on Xe this bounds the dispatch overhead, on CPU devices it keeps one chunk per thread hot.
+  const int work_group_size = std::min(256, detail::sycl_max_work_group_size(queue));
+  const int compute_units = int(queue.get_device().get_info<sycl::info::device::max_compute_units>());
+  const int max_groups = std::max(1, compute_units) * 8;
+
+  detail::sycl_dispatch_vector_width<16>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+    detail::elementwise_kernel<ElementCompute, Round, kVecSize>(
+      queue, out_mnl, functor, work_group_size, max_groups, detail::sycl_elementwise_mnl(in)...);
+  });
+
+  return Status::kSuccess;
+}
+
+/// Elementwise kernel on the default SYCL queue
+template <class ElementCompute = float,
+          FloatRoundStyle Round = FloatRoundStyle::round_to_nearest,
+          class Functor, class OutEngine, class OutLayout, class... InEngines, class... InLayouts>
+Status elementwise(cute::Tensor<OutEngine, OutLayout> const& out,
+                   Functor const& functor,
+                   cute::Tensor<InEngines, InLayouts> const&... in) {
+  return elementwise<ElementCompute, Round>(syclcompat::get_default_queue(), out, functor, in...);
+}
+
+} // namespace cutlass
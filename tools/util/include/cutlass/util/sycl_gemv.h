@@ -0,0 +1,468 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL GEMV and batched GEMV kernels for a matrix multiplied by up to four vectors, and a
+ *        dispatcher which routes GEMMs with such a small M to them.
+ */
+
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/util/sycl_device_utils.h"
+
+#include "cute/tensor.hpp"
+
+namespace cutlass {
+
+/// Largest number of vectors (rows of X) the GEMV kernels multiply by the matrix in one pass
+static constexpr int kSyclGemvMaxVectors = 4;
+
+/**
+ * Arguments of the GEMV kernels. For every batch b:
+ *   D[b] = activation(alpha * X[b] * W[b]^T + beta * C[b] + bias)
+ * X [m, k], C and D [m, n], bias [n], W [n, k] when K-major and [k, n] otherwise.
+ *
+ * W is streamed with accesses of up to 16 bytes along its leading dimension. X, C and D are small
+ * and take arbitrary element strides. An integer W can be dequantized with float scales shared by
+ * group_size consecutive elements along k: scales [n, k / group_size] when W is K-major and
+ * [k / group_size, n] otherwise.
+ */
+template <typename ElementW, typename ElementX, typename ElementD, typename ElementC = ElementD>
+struct SyclGemvArguments {
+  int m = 1;                              ///< vectors, 1 to kSyclGemvMaxVectors
+  int n = 0;
+  int k = 0;
+  int batch_count = 1;
+
+  ElementW const* ptr_W = nullptr;
+  bool w_k_major = true;
+  int64_t ldw = 0;
+  int64_t batch_stride_W = 0;
+
+  float const* ptr_scale = nullptr;       ///< optional dequantization scales of W
+  int group_size = 0;
+  int64_t ld_scale = 0;
+  int64_t batch_stride_scale = 0;
+
+  ElementX const* ptr_X = nullptr;
+  int64_t stride_X_m = 0;
+  int64_t stride_X_k = 1;
+  int64_t batch_stride_X = 0;
+
+  ElementC const* ptr_C = nullptr;        ///< only read when beta is non-zero
+  int64_t stride_C_m = 0;
+  int64_t stride_C_n = 1;
+  int64_t batch_stride_C = 0;
+
+  ElementC const* ptr_bias = nullptr;     ///< optional, shared by all the rows and batches
+
+  ElementD* ptr_D = nullptr;
+  int64_t stride_D_m = 0;
+  int64_t stride_D_n = 1;
+  int64_t batch_stride_D = 0;
+
+  float alpha = 1.0f;
+  float beta = 0.0f;
+};
+
+namespace detail {
+
+/// Applies the epilogue to the dot product of row `row` of X and column `col` of W^T in batch b
+template <typename ActivationFn, typename Arguments>
+inline void sycl_gemv_store(Arguments const& args, int b, int row, int col, float accum) {
+  float value = args.alpha * accum;
+  if (args.beta != 0.0f) {
+    value += args.beta * static_cast<float>(
+      args.ptr_C[b * args.batch_stride_C + row * args.stride_C_m + col * args.stride_C_n]);
+  }
+  if (args.ptr_bias != nullptr) {
+    value += static_cast<float>(args.ptr_bias[col]);
+  }
+  ActivationFn activation;
+  using ElementD = std::remove_pointer_t<decltype(args.ptr_D)>;
+  args.ptr_D[b * args.batch_stride_D + row * args.stride_D_m + col * args.stride_D_n] =
+    static_cast<ElementD>(activation(value));
+}
+
+/**
+ * W [n, k] with k contiguous.
+ * Every sub-group computes one column of D for all the kM vectors: its work-items stride over the
+ * row of W with kVecSize-element accesses, so every element of W is loaded once, and the partial
+ * dot products are added with a sub-group reduction.
+ */
+template <typename ActivationFn, int kM, int kVecSize, int kSubgroupSize, int kSubgroupsPerWorkGroup = 8,
+          typename ElementW, typename ElementX, typename ElementD, typename ElementC>
+void gemv_k_major(sycl::queue& queue, SyclGemvArguments<ElementW, ElementX, ElementD, ElementC> const& args) {
+  using Vec = AlignedArray<ElementW, kVecSize>;
+  constexpr int kWorkGroupSize = kSubgroupSize * kSubgroupsPerWorkGroup;
+  const size_t col_groups = (args.n + kSubgroupsPerWorkGroup - 1) / kSubgroupsPerWorkGroup;
+
+  queue.parallel_for(
+    sycl::nd_range<2>(sycl::range<2>(args.batch_count, col_groups * kWorkGroupSize),
+                      sycl::range<2>(1, kWorkGroupSize)),
+    [=](sycl::nd_item<2> item) [[sycl::reqd_sub_group_size(kSubgroupSize)]] {
+      auto sg = item.get_sub_group();
+      const int b = item.get_group(0);
+      const int col = item.get_group(1) * kSubgroupsPerWorkGroup + int(sg.get_group_linear_id());
+      const int lane = sg.get_local_linear_id();
+
+      // The sub-group leaves as a whole, the reduction below only involves its own work-items
+      if (col >= args.n) {
+        return;
+      }
+
+      const Vec* w_vec = reinterpret_cast<const Vec*>(args.ptr_W + b * args.batch_stride_W + col * args.ldw);
+      const float* scale = args.ptr_scale == nullptr ? nullptr
+                         : args.ptr_scale + b * args.batch_stride_scale + col * args.ld_scale;
+      const ElementX* x = args.ptr_X + b * args.batch_stride_X;
+      const int k_vec = args.k / kVecSize;
+
+      float accum[kM];
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kM; ++i) {
+        accum[i] = 0.0f;
+      }
+
+      for (int index = lane; index < k_vec; index += kSubgroupSize) {
+        const Vec w = w_vec[index];
+        const int k0 = index * kVecSize;
+        const float w_scale = scale == nullptr ? 1.0f : scale[k0 / args.group_size];
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          const float w_j = static_cast<float>(w[j]) * w_scale;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kM; ++i) {
+            accum[i] += w_j * static_cast<float>(x[i * args.stride_X_m + (k0 + j) * args.stride_X_k]);
+          }
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kM; ++i) {
+        const float sum = sycl::reduce_over_group(sg, accum[i], sycl::plus<float>());
+        if (lane == 0) {
+          sycl_gemv_store<ActivationFn>(args, b, i, col, sum);
+        }
+      }
+    });
+}
+
+/**
+ * W [k, n] with n contiguous.
+ * Every work-item owns kVecSize consecutive columns of D and the kKSlices rows of the work-group
+ * split k between them. The partial sums meet in local memory, where the first row adds them in
+ * order and applies the epilogue.
+ */
+template <typename ActivationFn, int kM, int kVecSize, int kSubgroupSize, int kKSlices = 8,
+          typename ElementW, typename ElementX, typename ElementD, typename ElementC>
+void gemv_n_major(sycl::queue& queue, SyclGemvArguments<ElementW, ElementX, ElementD, ElementC> const& args) {
+  using Vec = AlignedArray<ElementW, kVecSize>;
+  constexpr int kColsPerWorkGroup = kSubgroupSize * kVecSize;
+  constexpr int kPartialsPerSlice = kM * kVecSize * kSubgroupSize;
+  const size_t col_groups = (args.n + kColsPerWorkGroup - 1) / kColsPerWorkGroup;
+
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<float, 1> partials(sycl::range<1>(kKSlices * kPartialsPerSlice), cgh);
+
+    cgh.parallel_for(
+      sycl::nd_range<3>(sycl::range<3>(args.batch_count, kKSlices, col_groups * kSubgroupSize),
+                        sycl::range<3>(1, kKSlices, kSubgroupSize)),
+      [=](sycl::nd_item<3> item) [[sycl::reqd_sub_group_size(kSubgroupSize)]] {
+        const int b = item.get_group(0);
+        const int slice = item.get_local_id(1);
+        const int lx = item.get_local_id(2);
+        const int col0 = (item.get_group(2) * kSubgroupSize + lx) * kVecSize;
+        const bool valid = col0 < args.n;
+
+        const ElementW* w = args.ptr_W + b * args.batch_stride_W + col0;
+        const float* scale = args.ptr_scale == nullptr ? nullptr
+                           : args.ptr_scale + b * args.batch_stride_scale + col0;
+        const ElementX* x = args.ptr_X + b * args.batch_stride_X;
+
+        float accum[kM][kVecSize];
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kM; ++i) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            accum[i][j] = 0.0f;
+          }
+        }
+
+        for (int k = slice; valid && k < args.k; k += kKSlices) {
+          const Vec w_k = *reinterpret_cast<const Vec*>(w + k * args.ldw);
+          const float* scale_k = scale == nullptr ? nullptr : scale + (k / args.group_size) * args.ld_scale;
+
+          float x_k[kM];
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kM; ++i) {
+            x_k[i] = static_cast<float>(x[i * args.stride_X_m + k * args.stride_X_k]);
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            const float w_j = static_cast<float>(w_k[j]) * (scale_k == nullptr ? 1.0f : scale_k[j]);
+            CUTLASS_PRAGMA_UNROLL
+            for (int i = 0; i < kM; ++i) {
+              accum[i][j] += x_k[i] * w_j;
+            }
+          }
+        }
+
+        // Interleaved across the work-items of a slice so that neighbours write neighbouring words
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kM; ++i) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            partials[slice * kPartialsPerSlice + (i * kVecSize + j) * kSubgroupSize + lx] = accum[i][j];
+          }
+        }
+
+        sycl::group_barrier(item.get_group());
+
+        if (slice != 0 || !valid) {
+          return;
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kM; ++i) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            float sum = accum[i][j];
+            for (int s = 1; s < kKSlices; ++s) {
+              sum += partials[s * kPartialsPerSlice + (i * kVecSize + j) * kSubgroupSize + lx];
+            }
+            sycl_gemv_store<ActivationFn>(args, b, i, col0 + j, sum);
+          }
+        }
+      });
+  });
+}
+
+/// True for the epilogue operations the GEMV kernels implement: a plain linear combination,
+/// without activation, bias or any other fused operation
+template <class Operation>
+struct SyclGemvEpilogueSupported : std::false_type {};
+
+template <class ElementOutput, class ElementCompute, class ElementSource, class ElementScalar, FloatRoundStyle RoundStyle>
+struct SyclGemvEpilogueSupported<
+    epilogue::fusion::LinearCombination<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>>
+  : std::true_type {};
+
+/// Calls f(std::integral_constant<int, kM>{}) for kM = m, 1 <= m <= kSyclGemvMaxVectors
+template <typename F>
+void sycl_gemv_dispatch_vectors(int m, F&& f) {
+  switch (m) {
+    case 1:  f(std::integral_constant<int, 1>{}); break;
+    case 2:  f(std::integral_constant<int, 2>{}); break;
+    case 3:  f(std::integral_constant<int, 3>{}); break;
+    default: f(std::integral_constant<int, 4>{}); break;
+  }
+}
+
+} // namespace detail
+
+/** \brief GEMV and batched GEMV, see SyclGemvArguments.
+ * Every element of W is loaded once for all the m vectors, which is what makes these kernels
+ * faster than a GEMM with mostly empty MMA tiles when m is this small.
+ * \tparam ActivationFn: functor applied to the float result, e.g. epilogue::thread::ReLu<float>
+ */
+template <typename ActivationFn = epilogue::thread::Identity<float>,
+          typename ElementW, typename ElementX, typename ElementD, typename ElementC>
+Status gemv(SyclGemvArguments<ElementW, ElementX, ElementD, ElementC> const& args,
+            sycl::queue queue = syclcompat::get_default_queue()) {
+  if (args.m < 1 || args.m > kSyclGemvMaxVectors || args.n < 0 || args.k < 0 || args.batch_count < 1) {
+    return Status::kErrorInvalidProblem;
+  }
+  if (args.ptr_scale != nullptr && args.group_size <= 0) {
+    return Status::kErrorInvalidProblem;
+  }
+  if (args.n == 0) {
+    return Status::kSuccess;
+  }
+
+  // The accesses to W have to stay aligned from one row and one batch to the next. A K-major
+  // access must also stay within one scale group.
+  int64_t extent = std::gcd(int64_t(args.w_k_major ? args.k : args.n), args.ldw);
+  if (args.batch_count > 1) {
+    extent = std::gcd(extent, args.batch_stride_W);
+  }
+  if (args.w_k_major && args.ptr_scale != nullptr) {
+    extent = std::gcd(extent, int64_t(args.group_size));
+  }
+  // Every candidate width divides 16, so extent modulo 16 has the same divisors among them
+  const int width = detail::sycl_vector_width<ElementW>(extent % 16 == 0 ? 16 : int(extent % 16), {args.ptr_W});
+  const int subgroup_size = detail::sycl_tile_width(queue);
+
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<ElementW>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+    detail::sycl_gemv_dispatch_vectors(args.m, [&](auto vectors) {
+      constexpr int kM = decltype(vectors)::value;
+      if (args.w_k_major) {
+        if (subgroup_size == 16) {
+          detail::gemv_k_major<ActivationFn, kM, kVecSize, 16>(queue, args);
+        }
+        else {
+          detail::gemv_k_major<ActivationFn, kM, kVecSize, 32>(queue, args);
+        }
+      }
+      else {
+        if (subgroup_size == 16) {
+          detail::gemv_n_major<ActivationFn, kM, kVecSize, 16>(queue, args);
+        }
+        else {
+          detail::gemv_n_major<ActivationFn, kM, kVecSize, 32>(queue, args);
+        }
+      }
+    });
+  });
+  return Status::kSuccess;
+}
+
+/** \brief Runs the GEMMs of a 3.x GemmUniversalAdapter with at most kSyclGemvMaxVectors rows
+ * (M <= 4) through the GEMV kernels and all the others through Gemm. The GEMV path is only taken
+ * when the epilogue of Gemm is a plain fusion::LinearCombination with alpha and beta given by
+ * value, and B has a unit stride along N or K. Gemms with any other epilogue, e.g. an activation
+ * or an EVT, always run through Gemm.
+ */
+template <class Gemm>
+class SyclGemmDispatch {
+public:
+  using Arguments = typename Gemm::Arguments;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementD = typename GemmKernel::ElementD;
+  using GemvArguments = SyclGemvArguments<ElementB, ElementA, ElementD, ElementC>;
+
+  /// True if the epilogue of Gemm can be computed by the GEMV kernels
+  static constexpr bool kGemvEpilogue =
+    detail::SyclGemvEpilogueSupported<typename GemmKernel::CollectiveEpilogue::ThreadEpilogueOp>::value;
+
+  /// True if the problem goes through the GEMV kernels
+  static bool use_gemv(Arguments const& args) {
+    if constexpr (kGemvEpilogue) {
+      auto problem_shape_MNKL = cute::append<4>(args.problem_shape, 1);
+      auto const& dB = args.mainloop.dB;
+      return (args.mode == gemm::GemmUniversalMode::kGemm || args.mode == gemm::GemmUniversalMode::kBatched) &&
+             cute::get<0>(problem_shape_MNKL) >= 1 && cute::get<0>(problem_shape_MNKL) <= kSyclGemvMaxVectors &&
+             args.epilogue.thread.alpha_ptr == nullptr && args.epilogue.thread.beta_ptr == nullptr &&
+             (int64_t(cute::get<0>(dB)) == 1 || int64_t(cute::get<1>(dB)) == 1);
+    }
+    else {
+      return false;
+    }
+  }
+
+  /// GEMV arguments equivalent to the GEMM arguments, D = alpha * A * B + beta * C
+  static GemvArguments to_gemv_arguments(Arguments const& args) {
+    static_assert(kGemvEpilogue, "The GEMV kernels only implement a plain LinearCombination epilogue");
+    auto problem_shape_MNKL = cute::append<4>(args.problem_shape, 1);
+    auto const& dA = args.mainloop.dA;
+    auto const& dB = args.mainloop.dB;
+    auto const& dC = args.epilogue.dC;
+    auto const& dD = args.epilogue.dD;
+
+    GemvArguments gemv_args;
+    gemv_args.m = int(cute::get<0>(problem_shape_MNKL));
+    gemv_args.n = int(cute::get<1>(problem_shape_MNKL));
+    gemv_args.k = int(cute::get<2>(problem_shape_MNKL));
+    gemv_args.batch_count = int(cute::get<3>(problem_shape_MNKL));
+
+    gemv_args.ptr_W = args.mainloop.ptr_B;
+    gemv_args.w_k_major = int64_t(cute::get<1>(dB)) == 1;
+    gemv_args.ldw = gemv_args.w_k_major ? int64_t(cute::get<0>(dB)) : int64_t(cute::get<1>(dB));
+    gemv_args.batch_stride_W = int64_t(cute::get<2>(dB));
+
+    gemv_args.ptr_X = args.mainloop.ptr_A;
+    gemv_args.stride_X_m = int64_t(cute::get<0>(dA));
+    gemv_args.stride_X_k = int64_t(cute::get<1>(dA));
+    gemv_args.batch_stride_X = int64_t(cute::get<2>(dA));
+
+    gemv_args.ptr_C = args.epilogue.ptr_C;
+    gemv_args.stride_C_m = int64_t(cute::get<0>(dC));
+    gemv_args.stride_C_n = int64_t(cute::get<1>(dC));
+    gemv_args.batch_stride_C = int64_t(cute::get<2>(dC));
+
+    gemv_args.ptr_D = const_cast<ElementD*>(args.epilogue.ptr_D);
+    gemv_args.stride_D_m = int64_t(cute::get<0>(dD));
+    gemv_args.stride_D_n = int64_t(cute::get<1>(dD));
+    gemv_args.batch_stride_D = int64_t(cute::get<2>(dD));
+
+    gemv_args.alpha = static_cast<float>(args.epilogue.thread.alpha);
+    gemv_args.beta = static_cast<float>(args.epilogue.thread.beta);
+    return gemv_args;
+  }
+
+  static Status can_implement(Arguments const& args) {
+    return use_gemv(args) ? Status::kSuccess : Gemm::can_implement(args);
+  }
+
+  static size_t get_workspace_size(Arguments const& args) {
+    return use_gemv(args) ? 0 : Gemm::get_workspace_size(args);
+  }
+
+  Status initialize(Arguments const& args, void* workspace = nullptr) {
+    use_gemv_ = use_gemv(args);
+    if constexpr (kGemvEpilogue) {
+      if (use_gemv_) {
+        gemv_args_ = to_gemv_arguments(args);
+        return Status::kSuccess;
+      }
+    }
+    return gemm_op_.initialize(args, workspace);
+  }
+
+  Status run() {
+    return use_gemv_ ? gemv(gemv_args_) : gemm_op_.run();
+  }
+
+  Status operator()() {
+    return run();
+  }
+
+private:
+  Gemm gemm_op_;
+  GemvArguments gemv_args_;
+  bool use_gemv_ = false;
+};
+
+} // namespace cutlass
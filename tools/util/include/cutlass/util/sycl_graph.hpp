@@ -0,0 +1,187 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Capture and replay of kernel launch sequences with sycl_ext_oneapi_graph command graphs.
+
+    The host-side cost of a launch (argument conversion, kernel submission) is paid once at capture
+    time; every replay submits the whole sequence at once. Re-capturing the same sequence with new
+    arguments updates the finalized graph in place, which is cheaper than finalizing a new one.
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+#include <syclcompat.hpp>
+
+namespace cutlass {
+
+/// Records the kernel launches a callable enqueues on a SYCL queue and replays them.
+///
+/// Launches are recorded through the queue overloads of the device-level operators, e.g.
+///
+///   SyclGraph graph;
+///   graph.capture([](sycl::queue& queue, Gemm& gemm_op, Gemm::Arguments& arguments, void* workspace) {
+///     gemm_op.initialize(arguments, workspace, queue);
+///     gemm_op.run(queue);
+///   }, gemm_op, arguments, workspace);
+///   for (...) { graph.replay(); }
+///
+/// The callable must not capture anything. The objects it works on are passed to capture(), which
+/// copies them and hands the copies to the callable. Every replay therefore runs with the state of
+/// the capture, whether the launches were recorded into a command graph or, on devices without
+/// graph support, are called again on every replay. Later changes to the originals are only picked
+/// up by capturing again.
+///
+/// Commands recorded in a graph may only depend on events of the same capture, so operators which
+/// initialize a workspace should also be initialized inside the capture.
+class SyclGraph {
+public:
+
+  using ModifiableGraph = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::modifiable>;
+  using ExecutableGraph = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::executable>;
+
+private:
+
+  sycl::queue queue_;
+  bool recordable_;
+  bool updatable_;
+  std::optional<ExecutableGraph> executable_;
+  std::function<void(sycl::queue&)> launches_;   ///< bound to the state of the last capture
+
+public:
+
+  /// Captures launches enqueued on \p queue. With \p record false, or on devices without graph
+  /// support, the captured launches are called again on every replay.
+  explicit SyclGraph(sycl::queue const& queue = syclcompat::get_default_queue(), bool record = true):
+    queue_(queue),
+    recordable_(record && is_supported(queue)),
+    updatable_(queue.get_device().has(sycl::aspect::ext_oneapi_graph)) { }
+
+  /// Returns true if launches on \p queue can be recorded into a command graph
+  static bool is_supported(sycl::queue const& queue) {
+    sycl::device const device = queue.get_device();
+    return device.has(sycl::aspect::ext_oneapi_graph) ||
+           device.has(sycl::aspect::ext_oneapi_limited_graph);
+  }
+
+  /// Returns the queue launches are captured from and replayed on
+  sycl::queue& queue() {
+    return queue_;
+  }
+
+  /// Returns true if captured sequences are recorded into a command graph
+  bool records() const {
+    return recordable_;
+  }
+
+  /// Returns true once a sequence has been captured
+  bool captured() const {
+    return executable_.has_value() || bool(launches_);
+  }
+
+  /// Records the commands launches(queue(), state...) enqueues, where state... are copies of
+  /// \p state taken now. Nothing is executed until replay().
+  ///
+  /// Re-capturing a sequence with the same commands and new state, e.g. to point the replay at
+  /// other buffers, updates the finalized graph in place where the device supports it. Call
+  /// reset() before capturing a different sequence.
+  template <class Launches, class... State>
+  void capture(Launches launches, State const&... state) {
+    static_assert(std::is_empty_v<Launches> || std::is_function_v<std::remove_pointer_t<Launches>>,
+      "SyclGraph::capture() takes a callable without captures; pass the objects it works on as "
+      "arguments of capture() so that replays do not read them after the capture");
+
+    std::function<void(sycl::queue&)> bound =
+      [launches, snapshot = std::make_shared<std::tuple<State...>>(state...)](sycl::queue& queue) {
+        std::apply([&](State&... copies) { launches(queue, copies...); }, *snapshot);
+      };
+
+    if (!recordable_) {
+      launches_ = std::move(bound);
+      return;
+    }
+
+    ModifiableGraph graph(queue_.get_context(), queue_.get_device());
+    graph.begin_recording(queue_);
+    try {
+      bound(queue_);
+    }
+    catch (...) {
+      graph.end_recording(queue_);
+      throw;
+    }
+    graph.end_recording(queue_);
+
+    if (executable_ && updatable_) {
+      executable_->update(graph);
+    }
+    else if (updatable_) {
+      executable_.emplace(graph.finalize(sycl::ext::oneapi::experimental::property::graph::updatable{}));
+    }
+    else {
+      executable_.emplace(graph.finalize());
+    }
+
+    // The graph holds copies of the kernel arguments; the state stays alive with it for commands
+    // which refer to it, such as host tasks
+    launches_ = std::move(bound);
+  }
+
+  /// Discards the captured sequence
+  void reset() {
+    executable_.reset();
+    launches_ = nullptr;
+  }
+
+  /// Submits the captured sequence to queue() and returns its event
+  sycl::event replay() {
+    if (executable_) {
+      return queue_.ext_oneapi_graph(*executable_);
+    }
+    if (!recordable_ && launches_) {
+      launches_(queue_);
+      return queue_.ext_oneapi_submit_barrier();
+    }
+    throw std::runtime_error("SyclGraph::replay() called before capture()");
+  }
+};
+
+} // namespace cutlass
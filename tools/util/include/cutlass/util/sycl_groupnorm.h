@@ -0,0 +1,262 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernels to do group norm on a device memory tensor with NHWC layout. The tensor will be divided into [N, H, W, G, C'] and then we do normalization on [H, W, C'].
+ */
+
+#include <cstdio>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+namespace detail {
+
+/// Offset, in vectors, of the idx-th vector of a group relative to the start of that group
+CUTLASS_HOST_DEVICE
+int groupnorm_offset_in_group(int idx, int v_group_stride, int v_last_dim) {
+  return (idx / v_group_stride) * v_last_dim + idx % v_group_stride;
+}
+
+/**
+ * One work-group per (group, batch) pair, nd_range(dim0, num_groups). The [H, W, C'] slice is
+ * kept in registers between the two reductions and the store: each work-item holds
+ * kItemsPerThread accesses of kVecSize elements.
+ */
+template <typename T, int kVecSize, int kItemsPerThread>
+void groupnorm_twopass_store_locally(sycl::queue& queue, T* output, const T* input,
+                                     const T* gamma, const T* beta,
+                                     int dim0, int num_groups, int prod_dim1_to_last_dim, int last_dim,
+                                     const float eps, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<2>(sycl::range<2>(dim0, size_t(num_groups) * work_group_size),
+                      sycl::range<2>(1, work_group_size)),
+    [=](sycl::nd_item<2> item) {
+      const int bid = item.get_group(0);
+      const int gid = item.get_group(1);
+      const int tid = item.get_local_id(1);
+      const int s_reduce_elements = prod_dim1_to_last_dim / num_groups;
+      const int v_reduce_elements = s_reduce_elements / kVecSize;
+      const int s_group_stride = last_dim / num_groups;
+      const int v_group_stride = s_group_stride / kVecSize;
+      const int v_last_dim = last_dim / kVecSize;
+      const int64_t offset_of_group = (int64_t(bid) * prod_dim1_to_last_dim + gid * s_group_stride) / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input) + offset_of_group;
+      Vec* output_vec = reinterpret_cast<Vec*>(output) + offset_of_group;
+      const Vec* gamma_vec = reinterpret_cast<const Vec*>(gamma) + gid * v_group_stride;
+      const Vec* beta_vec = reinterpret_cast<const Vec*>(beta) + gid * v_group_stride;
+
+      Vec local_val[kItemsPerThread];
+      float local_sum = 0.0f;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int idx = tid + i * work_group_size;
+        if (idx < v_reduce_elements) {
+          local_val[i] = input_vec[groupnorm_offset_in_group(idx, v_group_stride, v_last_dim)];
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            local_sum += static_cast<float>(local_val[i][j]);
+          }
+        }
+      }
+
+      const float mean = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>())
+                         / s_reduce_elements;
+
+      local_sum = 0.0f;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int idx = tid + i * work_group_size;
+        if (idx < v_reduce_elements) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            float tmp = static_cast<float>(local_val[i][j]) - mean;
+            local_sum += tmp * tmp;
+          }
+        }
+      }
+
+      const float variance = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      const float rstd = sycl::rsqrt(variance / s_reduce_elements + eps);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int idx = tid + i * work_group_size;
+        if (idx < v_reduce_elements) {
+          Vec gamma_val = gamma_vec[idx % v_group_stride];
+          Vec beta_val = beta_vec[idx % v_group_stride];
+          Vec tmp;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            tmp[j] = T((static_cast<float>(local_val[i][j]) - mean) * rstd * static_cast<float>(gamma_val[j])
+                       + static_cast<float>(beta_val[j]));
+          }
+          output_vec[groupnorm_offset_in_group(idx, v_group_stride, v_last_dim)] = tmp;
+        }
+      }
+    });
+}
+
+/// Slices too large to be kept in registers are read three times from global memory
+template <typename T, int kVecSize>
+void groupnorm_twopass_multiple_load(sycl::queue& queue, T* output, const T* input,
+                                     const T* gamma, const T* beta,
+                                     int dim0, int num_groups, int prod_dim1_to_last_dim, int last_dim,
+                                     const float eps, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<2>(sycl::range<2>(dim0, size_t(num_groups) * work_group_size),
+                      sycl::range<2>(1, work_group_size)),
+    [=](sycl::nd_item<2> item) {
+      const int bid = item.get_group(0);
+      const int gid = item.get_group(1);
+      const int tid = item.get_local_id(1);
+      const int s_reduce_elements = prod_dim1_to_last_dim / num_groups;
+      const int v_reduce_elements = s_reduce_elements / kVecSize;
+      const int s_group_stride = last_dim / num_groups;
+      const int v_group_stride = s_group_stride / kVecSize;
+      const int v_last_dim = last_dim / kVecSize;
+      const int64_t offset_of_group = (int64_t(bid) * prod_dim1_to_last_dim + gid * s_group_stride) / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input) + offset_of_group;
+      Vec* output_vec = reinterpret_cast<Vec*>(output) + offset_of_group;
+      const Vec* gamma_vec = reinterpret_cast<const Vec*>(gamma) + gid * v_group_stride;
+      const Vec* beta_vec = reinterpret_cast<const Vec*>(beta) + gid * v_group_stride;
+
+      float local_sum = 0.0f;
+      for (int idx = tid; idx < v_reduce_elements; idx += work_group_size) {
+        Vec local_val = input_vec[groupnorm_offset_in_group(idx, v_group_stride, v_last_dim)];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          local_sum += static_cast<float>(local_val[j]);
+        }
+      }
+
+      const float mean = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>())
+                         / s_reduce_elements;
+
+      local_sum = 0.0f;
+      for (int idx = tid; idx < v_reduce_elements; idx += work_group_size) {
+        Vec local_val = input_vec[groupnorm_offset_in_group(idx, v_group_stride, v_last_dim)];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          float tmp = static_cast<float>(local_val[j]) - mean;
+          local_sum += tmp * tmp;
+        }
+      }
+
+      const float variance = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      const float rstd = sycl::rsqrt(variance / s_reduce_elements + eps);
+
+      for (int idx = tid; idx < v_reduce_elements; idx += work_group_size) {
+        const int offset_in_group = groupnorm_offset_in_group(idx, v_group_stride, v_last_dim);
+        Vec local_val = input_vec[offset_in_group];
+        Vec gamma_val = gamma_vec[idx % v_group_stride];
+        Vec beta_val = beta_vec[idx % v_group_stride];
+        Vec tmp;
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          tmp[j] = T((static_cast<float>(local_val[j]) - mean) * rstd * static_cast<float>(gamma_val[j])
+                     + static_cast<float>(beta_val[j]));
+        }
+        output_vec[offset_in_group] = tmp;
+      }
+    });
+}
+
+} // namespace detail
+
+/** \brief interface to do group norm on a device memory tensor with NHWC layout.
+ * The kernels are submitted to the default SYCL queue, `stream` is ignored.
+ * \tparam T: data type
+ */
+template <typename T>
+void groupnorm(cutlass::Tensor4DCoord input_size,
+               const int num_groups,
+               const float eps,
+               TensorRef<T, layout::TensorNHWC> ref_output,
+               TensorRef<T, layout::TensorNHWC> ref_input,
+               TensorRef<T, layout::TensorNHWC> ref_gamma,
+               TensorRef<T, layout::TensorNHWC> ref_beta,
+               cudaStream_t stream){
+  (void) stream;
+  const int N = input_size.n();
+  const int H = input_size.h();
+  const int W = input_size.w();
+  const int C = input_size.c();
+  if (C % num_groups != 0){
+    printf("[ERROR] C should be a multiple of num_groups.\n");
+    return;
+  }
+  T* output = ref_output.data();
+  const T* input = ref_input.data();
+  const T* gamma = ref_gamma.data();
+  const T* beta = ref_beta.data();
+
+  const int dim0 = N;
+  const int last_dim = C;
+  const int prod_dim1_to_last_dim = H*W*C;
+  const int s_reduce_elements = prod_dim1_to_last_dim / num_groups;
+  const int s_group_stride = last_dim / num_groups;
+
+  sycl::queue queue = syclcompat::get_default_queue();
+  const int max_work_group_size = detail::sycl_max_work_group_size(queue);
+  // Each access must stay within one group's channels
+  const int width = detail::sycl_vector_width<T>(s_group_stride, {output, input, gamma, beta});
+
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<T>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+
+    bool stored_locally = detail::sycl_norm_dispatch_items_per_thread(s_reduce_elements / kVecSize, max_work_group_size,
+      [&](auto items_per_thread, int work_group_size) {
+        constexpr int kItemsPerThread = decltype(items_per_thread)::value;
+        detail::groupnorm_twopass_store_locally<T, kVecSize, kItemsPerThread>(
+          queue, output, input, gamma, beta, dim0, num_groups, prod_dim1_to_last_dim, last_dim, eps, work_group_size);
+      });
+
+    if (!stored_locally) {
+      detail::groupnorm_twopass_multiple_load<T, kVecSize>(
+        queue, output, input, gamma, beta, dim0, num_groups, prod_dim1_to_last_dim, last_dim, eps, max_work_group_size);
+    }
+  });
+}
+
+} // namespace cutlass
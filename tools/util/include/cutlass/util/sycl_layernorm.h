@@ -0,0 +1,223 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernels to do layernorm on a device memory tensor with RowMajor layout.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+namespace detail {
+
+/**
+ * output [m, n] row-major
+ * input [m, n] row-major
+ * gamma [n]
+ * beta [n]
+ * One work-group per row, the row is kept in registers for the mean, the variance and the store:
+ * each work-item holds kItemsPerThread accesses of kVecSize elements.
+ */
+template <typename T, int kVecSize, int kItemsPerThread>
+void layernorm_twoPassAlgo_stored_locally(sycl::queue& queue, T* output, const T* input,
+                                          const T* gamma, const T* beta,
+                                          const int m, const int n, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(size_t(m) * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      const int m_idx = item.get_group(0);
+      const int tid = item.get_local_id(0);
+      const int n_vec = n / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input + int64_t(m_idx) * n);
+      const Vec* gamma_vec = reinterpret_cast<const Vec*>(gamma);
+      const Vec* beta_vec = reinterpret_cast<const Vec*>(beta);
+      Vec* output_vec = reinterpret_cast<Vec*>(output + int64_t(m_idx) * n);
+
+      Vec local_val[kItemsPerThread];
+      float local_sum = 0.0f;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int index = tid + i * work_group_size;
+        if (index < n_vec) {
+          local_val[i] = input_vec[index];
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            local_sum += static_cast<float>(local_val[i][j]);
+          }
+        }
+      }
+
+      const float mean = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>()) / n;
+
+      local_sum = 0.0f;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int index = tid + i * work_group_size;
+        if (index < n_vec) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            float tmp = static_cast<float>(local_val[i][j]) - mean;
+            local_sum += tmp * tmp;
+          }
+        }
+      }
+
+      const float variance = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      const float rstd = sycl::rsqrt(variance / n + 1e-5f);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int index = tid + i * work_group_size;
+        if (index < n_vec) {
+          Vec gamma_val = gamma_vec[index];
+          Vec beta_val = beta_vec[index];
+          Vec tmp;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            tmp[j] = T((static_cast<float>(local_val[i][j]) - mean) * rstd * static_cast<float>(gamma_val[j])
+                       + static_cast<float>(beta_val[j]));
+          }
+          output_vec[index] = tmp;
+        }
+      }
+    });
+}
+
+/// Rows too wide to be kept in registers are read three times from global memory
+template <typename T, int kVecSize>
+void layernorm_twoPassAlgo(sycl::queue& queue, T* output, const T* input,
+                           const T* gamma, const T* beta,
+                           const int m, const int n, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(size_t(m) * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      const int m_idx = item.get_group(0);
+      const int tid = item.get_local_id(0);
+      const int n_vec = n / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input + int64_t(m_idx) * n);
+      const Vec* gamma_vec = reinterpret_cast<const Vec*>(gamma);
+      const Vec* beta_vec = reinterpret_cast<const Vec*>(beta);
+      Vec* output_vec = reinterpret_cast<Vec*>(output + int64_t(m_idx) * n);
+
+      float local_sum = 0.0f;
+      for (int index = tid; index < n_vec; index += work_group_size) {
+        Vec local_val = input_vec[index];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          local_sum += static_cast<float>(local_val[j]);
+        }
+      }
+
+      const float mean = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>()) / n;
+
+      local_sum = 0.0f;
+      for (int index = tid; index < n_vec; index += work_group_size) {
+        Vec local_val = input_vec[index];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          float tmp = static_cast<float>(local_val[j]) - mean;
+          local_sum += tmp * tmp;
+        }
+      }
+
+      const float variance = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      const float rstd = sycl::rsqrt(variance / n + 1e-5f);
+
+      for (int index = tid; index < n_vec; index += work_group_size) {
+        Vec local_val = input_vec[index];
+        Vec gamma_val = gamma_vec[index];
+        Vec beta_val = beta_vec[index];
+        Vec tmp;
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          tmp[j] = T((static_cast<float>(local_val[j]) - mean) * rstd * static_cast<float>(gamma_val[j])
+                     + static_cast<float>(beta_val[j]));
+        }
+        output_vec[index] = tmp;
+      }
+    });
+}
+
+} // namespace detail
+
+/** \brief interface to do layernorm on a device memory tensor with RowMajor layout.
+ * The kernels are submitted to the default SYCL queue, `stream` is ignored.
+ * \tparam T: data type
+ */
+template <typename T>
+void layernorm(cutlass::MatrixCoord tensor_size,
+               TensorRef<T, layout::RowMajor> ref_output,
+               TensorRef<T, layout::RowMajor> ref_input,
+               TensorRef<T, layout::RowMajor> ref_gamma,
+               TensorRef<T, layout::RowMajor> ref_beta,
+               cudaStream_t stream){
+  (void) stream;
+  const int m = tensor_size.row();
+  const int n = tensor_size.column();
+  T* output = ref_output.data();
+  const T* input = ref_input.data();
+  const T* gamma = ref_gamma.data();
+  const T* beta = ref_beta.data();
+
+  sycl::queue queue = syclcompat::get_default_queue();
+  const int max_work_group_size = detail::sycl_max_work_group_size(queue);
+  const int width = detail::sycl_vector_width<T>(n, {output, input, gamma, beta});
+
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<T>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+
+    bool stored_locally = detail::sycl_norm_dispatch_items_per_thread(n / kVecSize, max_work_group_size,
+      [&](auto items_per_thread, int work_group_size) {
+        constexpr int kItemsPerThread = decltype(items_per_thread)::value;
+        detail::layernorm_twoPassAlgo_stored_locally<T, kVecSize, kItemsPerThread>(
+          queue, output, input, gamma, beta, m, n, work_group_size);
+      });
+
+    if (!stored_locally) {
+      detail::layernorm_twoPassAlgo<T, kVecSize>(
+        queue, output, input, gamma, beta, m, n, max_work_group_size);
+    }
+  });
+}
+
+} // namespace cutlass
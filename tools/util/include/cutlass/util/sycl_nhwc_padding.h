@@ -0,0 +1,176 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernels for padding in device memory with NHWC layout.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+namespace detail {
+
+/**
+ * input [nhw, c_in], output [nhw, c_out], both counted in accesses of kVecSize elements.
+ * Each work-item writes one access of the output.
+ */
+template <typename T, int kVecSize>
+void nhwc_padding_kernel(sycl::queue& queue, T* output, const T* input,
+                         const int64_t nhw, const int c_in, const int c_out, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  const int v_c_in = c_in / kVecSize;
+  const int v_c_out = c_out / kVecSize;
+  const int64_t total = nhw * v_c_out;
+  const size_t groups = (total + work_group_size - 1) / work_group_size;
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(groups * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      const int64_t idx = item.get_global_id(0);
+      if (idx >= total) {
+        return;
+      }
+      const int c_idx = idx % v_c_out;
+      const int64_t pixel = idx / v_c_out;
+      Vec value;
+      if (c_idx < v_c_in) {
+        value = reinterpret_cast<const Vec*>(input)[pixel * v_c_in + c_idx];
+      }
+      else {
+        value.fill(T(0));
+      }
+      reinterpret_cast<Vec*>(output)[idx] = value;
+    });
+}
+
+/**
+ * Fast path for c_in = 3 and c_out = 4 or 8: the work-group stages the 3-channel pixels it
+ * covers in local memory with contiguous loads, then each work-item writes one pixel as a single
+ * access of kChannelsOut elements.
+ */
+template <typename T, int kChannelsOut>
+void nhwc_padding_channel_3_kernel(sycl::queue& queue, T* output, const T* input,
+                                   const int64_t nhw, const int work_group_size) {
+  using Vec = AlignedArray<T, kChannelsOut>;
+
+  const size_t groups = (nhw + work_group_size - 1) / work_group_size;
+
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<T, 1> shm(sycl::range<1>(3 * work_group_size), cgh);
+
+    cgh.parallel_for(
+      sycl::nd_range<1>(sycl::range<1>(groups * work_group_size), sycl::range<1>(work_group_size)),
+      [=](sycl::nd_item<1> item) {
+        const int lid = item.get_local_id(0);
+        const int64_t pixel0 = int64_t(item.get_group(0)) * work_group_size;
+        const T* in = input + pixel0 * 3;
+        const int64_t remaining = (nhw - pixel0) * 3;
+
+        for (int i = lid; i < 3 * work_group_size; i += work_group_size) {
+          shm[i] = i < remaining ? in[i] : T(0);
+        }
+
+        sycl::group_barrier(item.get_group());
+
+        const int64_t pixel = pixel0 + lid;
+        if (pixel < nhw) {
+          Vec value;
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < kChannelsOut; ++k) {
+            value[k] = k < 3 ? shm[lid * 3 + k] : T(0);
+          }
+          reinterpret_cast<Vec*>(output)[pixel] = value;
+        }
+      });
+  });
+}
+
+} // namespace detail
+
+/** \brief interface for padding in a device memory tensor with NHWC layout
+ * The kernels are submitted to the default SYCL queue, `stream` is ignored.
+ * \tparam T: data type
+ */
+template <typename T>
+void nhwc_padding(cutlass::Tensor4DCoord input_tensor_size,
+                  cutlass::Tensor4DCoord output_tensor_size,
+                  TensorRef<T, layout::TensorNHWC> ref_input,
+                  TensorRef<T, layout::TensorNHWC> ref_output,
+                  cudaStream_t stream){
+  (void) stream;
+  assert(
+    input_tensor_size.n() == output_tensor_size.n() &&
+    input_tensor_size.h() == output_tensor_size.h() &&
+    input_tensor_size.w() == output_tensor_size.w() &&
+    input_tensor_size.c() <= output_tensor_size.c());
+
+  const int64_t nhw = int64_t(input_tensor_size.n()) * input_tensor_size.h() * input_tensor_size.w();
+  const int c_in = input_tensor_size.c();
+  const int c_out = output_tensor_size.c();
+  T* output = ref_output.data();
+  const T* input = ref_input.data();
+
+  sycl::queue queue = syclcompat::get_default_queue();
+  const int work_group_size = std::min(256, detail::sycl_max_work_group_size(queue));
+
+  //case 1 : channel == 3 padding to 4 or 8
+  if (c_in == 3 && (c_out == 4 || c_out == 8) &&
+      reinterpret_cast<uintptr_t>(output) % (c_out * sizeof(T)) == 0) {
+    if (c_out == 4) {
+      detail::nhwc_padding_channel_3_kernel<T, 4>(queue, output, input, nhw, work_group_size);
+    }
+    else {
+      detail::nhwc_padding_channel_3_kernel<T, 8>(queue, output, input, nhw, work_group_size);
+    }
+    return;
+  }
+
+  //case 2 : widest access dividing both channel counts
+  const int width = detail::sycl_vector_width<T>(std::gcd(c_in, c_out), {input, output});
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<T>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+    detail::nhwc_padding_kernel<T, kVecSize>(queue, output, input, nhw, c_in, c_out, work_group_size);
+  });
+}
+
+} //namespace cutlass
@@ -0,0 +1,255 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernels to do avg/max pooling on a device memory tensor with NHWC layout.
+ */
+
+#include <cassert>
+#include <cfloat>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+
+/** get the output size of pooling
+ */
+inline int getOutputSize(int H_W, int padding, int kernel_size, int stride)
+{
+    return (H_W + 2 * padding - kernel_size) / stride + 1;
+}
+
+namespace detail {
+
+/**
+ * input is [N, H, W, C]
+ * output is [N, output_h, output_w, C]
+ * One work-group per output pixel, nd_range(N, output_h, output_w * work_group_size): the
+ * work-items stride over the C channels in accesses of kVecSize elements.
+ */
+template <typename T, int kVecSize, bool IS_AVG_POOLING>
+void pooling_nhwc_kernel(sycl::queue& queue, T* output, const T* input,
+                         const int N, const int H, const int W, const int C,
+                         const int output_H, const int output_W,
+                         const int kernel_H, const int kernel_W,
+                         const int stride_H, const int stride_W,
+                         const int padding_H, const int padding_W,
+                         const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<3>(sycl::range<3>(N, output_H, size_t(output_W) * work_group_size),
+                      sycl::range<3>(1, 1, work_group_size)),
+    [=](sycl::nd_item<3> item) {
+      const int tid = item.get_local_id(2);
+      const int n_idx = item.get_group(0);
+      const int output_h_idx = item.get_group(1);
+      const int output_w_idx = item.get_group(2);
+
+      int h_start_idx = output_h_idx * stride_H - padding_H;
+      int h_end_idx = h_start_idx + kernel_H;
+      h_start_idx = (h_start_idx < 0) ? 0 : h_start_idx;
+      h_end_idx = h_end_idx > H ? H : h_end_idx;
+
+      int w_start_idx = output_w_idx * stride_W - padding_W;
+      int w_end_idx = w_start_idx + kernel_W;
+      w_start_idx = (w_start_idx < 0) ? 0 : w_start_idx;
+      w_end_idx = w_end_idx > W ? W : w_end_idx;
+
+      const int v_C = C / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input + int64_t(n_idx) * H * W * C);
+      Vec* output_vec = reinterpret_cast<Vec*>(
+        output + ((int64_t(n_idx) * output_H + output_h_idx) * output_W + output_w_idx) * C);
+      const int kernel_size2 = kernel_H * kernel_W;
+
+      for (int c_idx = tid; c_idx < v_C; c_idx += work_group_size) {
+        float pooling[kVecSize];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          pooling[j] = IS_AVG_POOLING ? 0.0f : -FLT_MAX;
+        }
+        for (int h = h_start_idx; h < h_end_idx; h++) {
+          for (int w = w_start_idx; w < w_end_idx; w++) {
+            const Vec tmp = input_vec[(h * W + w) * v_C + c_idx];
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < kVecSize; ++j) {
+              const float val = static_cast<float>(tmp[j]);
+              pooling[j] = IS_AVG_POOLING ? pooling[j] + val : sycl::fmax(pooling[j], val);
+            }
+          }
+        }
+
+        Vec output_val;
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          output_val[j] = T(IS_AVG_POOLING ? pooling[j] / kernel_size2 : pooling[j]);
+        }
+        output_vec[c_idx] = output_val;
+      }
+    });
+}
+
+/**
+ * output [N, 1, 1, C]
+ * input [N, H, W, C]
+ * One work-group per (access of kVecSize channels, batch) pair, nd_range(N, C / kVecSize * work_group_size):
+ * each work-item reduces HW / work_group_size pixels, then the work-group reduces the partials.
+ */
+template <typename T, int kVecSize, bool IS_AVG_POOLING>
+void pooling_nxhTo1x1_kernel(sycl::queue& queue, T* output, const T* input,
+                             const int N, const int HW, const int C, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  const int v_C = C / kVecSize;
+
+  queue.parallel_for(
+    sycl::nd_range<2>(sycl::range<2>(N, size_t(v_C) * work_group_size),
+                      sycl::range<2>(1, work_group_size)),
+    [=](sycl::nd_item<2> item) {
+      const int n_idx = item.get_group(0);
+      const int c_idx = item.get_group(1);
+      const int tid = item.get_local_id(1);
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input) + int64_t(n_idx) * HW * v_C + c_idx;
+
+      float pooling[kVecSize];
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kVecSize; ++j) {
+        pooling[j] = IS_AVG_POOLING ? 0.0f : -FLT_MAX;
+      }
+      for (int index = tid; index < HW; index += work_group_size) {
+        const Vec val = input_vec[int64_t(index) * v_C];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          pooling[j] = IS_AVG_POOLING ? pooling[j] + static_cast<float>(val[j])
+                                      : sycl::fmax(pooling[j], static_cast<float>(val[j]));
+        }
+      }
+
+      Vec output_val;
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kVecSize; ++j) {
+        if constexpr (IS_AVG_POOLING) {
+          output_val[j] = T(sycl::reduce_over_group(item.get_group(), pooling[j], sycl::plus<float>()) / HW);
+        }
+        else {
+          output_val[j] = T(sycl::reduce_over_group(item.get_group(), pooling[j], sycl::maximum<float>()));
+        }
+      }
+      if (tid == 0) {
+        reinterpret_cast<Vec*>(output)[int64_t(n_idx) * v_C + c_idx] = output_val;
+      }
+    });
+}
+
+} // namespace detail
+
+/** \brief interface to do avg/max pooling on a device memory tensor with NHWC layout.
+ * The kernels are submitted to the default SYCL queue, `stream` is ignored.
+ * \tparam T: data type
+ */
+template <typename T>
+void pooling_nhwc(cutlass::Tensor4DCoord input_tensor_size,
+                  cutlass::Tensor4DCoord filter_tensor_size,
+                  cutlass::Tensor4DCoord output_tensor_size,
+                  cutlass::Tensor4DCoord padding,
+                  cutlass::MatrixCoord stride,
+                  TensorRef<T, layout::TensorNHWC> ref_input,
+                  TensorRef<T, layout::TensorNHWC> ref_output,
+                  int poolingType, //0 for avg pooling ; 1 for max pooling
+                  cudaStream_t stream) {
+  (void) stream;
+  assert(input_tensor_size.n() == output_tensor_size.n() &&
+         input_tensor_size.c() == output_tensor_size.c());
+
+  const int N = input_tensor_size.n();
+  const int H = input_tensor_size.h();
+  const int W = input_tensor_size.w();
+  const int C = input_tensor_size.c();
+  const int padding_H = padding.h();
+  const int padding_W = padding.w();
+  const int kernel_H = filter_tensor_size.h();
+  const int kernel_W = filter_tensor_size.w();
+  const int stride_H = stride.row();
+  const int stride_W = stride.column();
+
+  const int output_H = getOutputSize(H, padding_H, kernel_H, stride_H);
+  const int output_W = getOutputSize(W, padding_W, kernel_W, stride_W);
+
+  assert(output_tensor_size.h() == output_H &&
+         output_tensor_size.w() == output_W);
+
+  T* output = ref_output.data();
+  const T* input = ref_input.data();
+
+  sycl::queue queue = syclcompat::get_default_queue();
+  const int max_work_group_size = std::min(256, detail::sycl_max_work_group_size(queue));
+  const int width = detail::sycl_vector_width<T>(C, {input, output});
+
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<T>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+    const int v_C = C / kVecSize;
+
+    if ((H == kernel_H && padding_H == 0) && (W == kernel_W && padding_W == 0)) {
+      int work_group_size = max_work_group_size;
+      if (H*W < work_group_size) {
+        work_group_size = std::min(max_work_group_size, (H*W + 31)/32*32);
+      }
+      if (poolingType == 0) {
+        detail::pooling_nxhTo1x1_kernel<T, kVecSize, true>(queue, output, input, N, H*W, C, work_group_size);
+      }
+      else {
+        detail::pooling_nxhTo1x1_kernel<T, kVecSize, false>(queue, output, input, N, H*W, C, work_group_size);
+      }
+    }
+    else {
+      const int work_group_size = std::min(max_work_group_size, v_C);
+      if (poolingType == 0) {
+        detail::pooling_nhwc_kernel<T, kVecSize, true>(
+          queue, output, input, N, H, W, C, output_H, output_W, kernel_H, kernel_W,
+          stride_H, stride_W, padding_H, padding_W, work_group_size);
+      }
+      else {
+        detail::pooling_nhwc_kernel<T, kVecSize, false>(
+          queue, output, input, N, H, W, C, output_H, output_W, kernel_H, kernel_W,
+          stride_H, stride_W, padding_H, padding_W, work_group_size);
+      }
+    }
+  });
+}
+
+} //namespace cutlass
@@ -0,0 +1,187 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernels to do rmsnorm on a device memory tensor with RowMajor layout.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+namespace detail {
+
+/**
+ * output [m, n] row-major
+ * input [m, n] row-major
+ * weight [n]
+ * One work-group per row, the row is kept in registers between the reduction and the store:
+ * each work-item holds kItemsPerThread accesses of kVecSize elements.
+ */
+template <typename T, int kVecSize, int kItemsPerThread>
+void rmsnorm_stored_locally(sycl::queue& queue, T* output, const T* input, const T* weight,
+                            const int m, const int n, float epsilon, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(size_t(m) * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      const int m_idx = item.get_group(0);
+      const int tid = item.get_local_id(0);
+      const int n_vec = n / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input + int64_t(m_idx) * n);
+      const Vec* weight_vec = reinterpret_cast<const Vec*>(weight);
+      Vec* output_vec = reinterpret_cast<Vec*>(output + int64_t(m_idx) * n);
+
+      Vec local_val[kItemsPerThread];
+      float local_sum = 0.0f;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int index = tid + i * work_group_size;
+        if (index < n_vec) {
+          local_val[i] = input_vec[index];
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            float val = static_cast<float>(local_val[i][j]);
+            local_sum += val * val;
+          }
+        }
+      }
+
+      float sum = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      float scale = sycl::rsqrt(sum / n + epsilon);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kItemsPerThread; ++i) {
+        int index = tid + i * work_group_size;
+        if (index < n_vec) {
+          Vec weight_val = weight_vec[index];
+          Vec tmp;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < kVecSize; ++j) {
+            tmp[j] = T(static_cast<float>(local_val[i][j]) * scale * static_cast<float>(weight_val[j]));
+          }
+          output_vec[index] = tmp;
+        }
+      }
+    });
+}
+
+/// Rows too wide to be kept in registers are read twice from global memory
+template <typename T, int kVecSize>
+void rmsnorm_multiple_load(sycl::queue& queue, T* output, const T* input, const T* weight,
+                           const int m, const int n, float epsilon, const int work_group_size) {
+  using Vec = AlignedArray<T, kVecSize>;
+
+  queue.parallel_for(
+    sycl::nd_range<1>(sycl::range<1>(size_t(m) * work_group_size), sycl::range<1>(work_group_size)),
+    [=](sycl::nd_item<1> item) {
+      const int m_idx = item.get_group(0);
+      const int tid = item.get_local_id(0);
+      const int n_vec = n / kVecSize;
+      const Vec* input_vec = reinterpret_cast<const Vec*>(input + int64_t(m_idx) * n);
+      const Vec* weight_vec = reinterpret_cast<const Vec*>(weight);
+      Vec* output_vec = reinterpret_cast<Vec*>(output + int64_t(m_idx) * n);
+
+      float local_sum = 0.0f;
+      for (int index = tid; index < n_vec; index += work_group_size) {
+        Vec local_val = input_vec[index];
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          float val = static_cast<float>(local_val[j]);
+          local_sum += val * val;
+        }
+      }
+
+      float sum = sycl::reduce_over_group(item.get_group(), local_sum, sycl::plus<float>());
+      float scale = sycl::rsqrt(sum / n + epsilon);
+
+      for (int index = tid; index < n_vec; index += work_group_size) {
+        Vec local_val = input_vec[index];
+        Vec weight_val = weight_vec[index];
+        Vec tmp;
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kVecSize; ++j) {
+          tmp[j] = T(static_cast<float>(local_val[j]) * scale * static_cast<float>(weight_val[j]));
+        }
+        output_vec[index] = tmp;
+      }
+    });
+}
+
+} // namespace detail
+
+/** \brief interface to do rmsnorm on a device memory tensor with RowMajor layout.
+ * The kernels are submitted to the default SYCL queue, `stream` is ignored.
+ * \tparam T: data type
+ */
+template <typename T>
+void rmsnorm(cutlass::MatrixCoord tensor_size,
+             TensorRef<T, layout::RowMajor> ref_output,
+             TensorRef<T, layout::RowMajor> ref_input,
+             TensorRef<T, layout::RowMajor> ref_weight,
+             cudaStream_t stream, float epsilon = 1e-5f){
+  (void) stream;
+  const int m = tensor_size.row();
+  const int n = tensor_size.column();
+  T* output = ref_output.data();
+  const T* input = ref_input.data();
+  const T* weight = ref_weight.data();
+
+  sycl::queue queue = syclcompat::get_default_queue();
+  const int max_work_group_size = detail::sycl_max_work_group_size(queue);
+  const int width = detail::sycl_vector_width<T>(n, {output, input, weight});
+
+  detail::sycl_dispatch_vector_width<detail::sycl_max_vector_width<T>>(width, [&](auto vec_size) {
+    constexpr int kVecSize = decltype(vec_size)::value;
+
+    bool stored_locally = detail::sycl_norm_dispatch_items_per_thread(n / kVecSize, max_work_group_size,
+      [&](auto items_per_thread, int work_group_size) {
+        constexpr int kItemsPerThread = decltype(items_per_thread)::value;
+        detail::rmsnorm_stored_locally<T, kVecSize, kItemsPerThread>(
+          queue, output, input, weight, m, n, epsilon, work_group_size);
+      });
+
+    if (!stored_locally) {
+      detail::rmsnorm_multiple_load<T, kVecSize>(
+        queue, output, input, weight, m, n, epsilon, max_work_group_size);
+    }
+  });
+}
+
+} // namespace cutlass
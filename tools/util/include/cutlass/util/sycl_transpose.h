@@ -0,0 +1,115 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+/**
+ * \file
+ * \brief SYCL kernel to transpose a batch of row-major matrices through local memory. Used by the
+ *        NCHW <-> NHWC layout transforms.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/util/sycl_device_utils.h"
+
+namespace cutlass {
+namespace detail {
+
+/**
+ * input [batch, rows, cols] row-major
+ * output [batch, cols, ld_output] row-major, ld_output >= rows. Columns [rows, ld_output) of the
+ * output are zero filled, which fuses channel padding into NCHW -> NHWC.
+ *
+ * Each work-group moves a kTile x kTile tile through local memory. The work-group is
+ * kTile x kRowsPerWorkGroup work-items and the unit-stride dimension of both the loads and the
+ * stores is mapped to the kTile consecutive work-items of a sub-group, whose width the kernel
+ * requires to be kTile. The tile has one extra column to avoid bank conflicts on the transposed
+ * read.
+ */
+template <typename T, int kTile, int kRowsPerWorkGroup = 8>
+void transpose_batched(sycl::queue& queue, T* output, const T* input,
+                       int batch, int rows, int cols, int ld_output) {
+  static_assert(kTile % kRowsPerWorkGroup == 0, "Tile must be a multiple of the work-group rows");
+
+  const size_t row_tiles = (ld_output + kTile - 1) / kTile;
+  const size_t col_tiles = (cols + kTile - 1) / kTile;
+
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<T, 1> tile(sycl::range<1>(kTile * (kTile + 1)), cgh);
+
+    cgh.parallel_for(
+      sycl::nd_range<3>(sycl::range<3>(batch, row_tiles * kRowsPerWorkGroup, col_tiles * kTile),
+                        sycl::range<3>(1, kRowsPerWorkGroup, kTile)),
+      [=](sycl::nd_item<3> item) [[sycl::reqd_sub_group_size(kTile)]] {
+        const int b = item.get_group(0);
+        const int row0 = item.get_group(1) * kTile;
+        const int col0 = item.get_group(2) * kTile;
+        const int ly = item.get_local_id(1);
+        const int lx = item.get_local_id(2);
+
+        const T* in = input + int64_t(b) * rows * cols;
+        T* out = output + int64_t(b) * cols * ld_output;
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = ly; r < kTile; r += kRowsPerWorkGroup) {
+          const int row = row0 + r;
+          const int col = col0 + lx;
+          if (row < rows && col < cols) {
+            tile[r * (kTile + 1) + lx] = in[int64_t(row) * cols + col];
+          }
+        }
+
+        sycl::group_barrier(item.get_group());
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int c = ly; c < kTile; c += kRowsPerWorkGroup) {
+          const int col = col0 + c;
+          const int row = row0 + lx;
+          if (col < cols && row < ld_output) {
+            out[int64_t(col) * ld_output + row] = row < rows ? tile[lx * (kTile + 1) + c] : T(0);
+          }
+        }
+      });
+  });
+}
+
+/// Launches transpose_batched with the tile width matching the device's sub-group width
+template <typename T>
+void transpose_batched(sycl::queue& queue, T* output, const T* input,
+                       int batch, int rows, int cols, int ld_output) {
+  if (sycl_tile_width(queue) == 16) {
+    transpose_batched<T, 16>(queue, output, input, batch, rows, cols, ld_output);
+  }
+  else {
+    transpose_batched<T, 32>(queue, output, input, batch, rows, cols, ld_output);
+  }
+}
+
+} // namespace detail
+} // namespace cutlass
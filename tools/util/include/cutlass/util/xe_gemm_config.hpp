@@ -0,0 +1,89 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Describes Xe GEMM kernel types to the analytic performance model of xe_gemm_model.hpp.
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "cute/tensor.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/xe_gemm_model.hpp"
+
+namespace cutlass {
+namespace gemm {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Describes an Xe GemmUniversal kernel (or anything exposing the same member types) to the model
+template <class GemmKernel>
+XeGemmConfig make_xe_gemm_config(std::string name = {}) {
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using TileShape = typename GemmKernel::TileShape;
+  using ThrLayoutVMNK = typename GemmKernel::TiledMma::ThrLayoutVMNK;
+
+  XeGemmConfig config;
+  config.name = std::move(name);
+
+  config.tile_m = int(cute::get<0>(TileShape{}));
+  config.tile_n = int(cute::get<1>(TileShape{}));
+  config.tile_k = int(cute::get<2>(TileShape{}));
+
+  config.sg_layout_m = int(cute::size<1>(ThrLayoutVMNK{}));
+  config.sg_layout_n = int(cute::size<2>(ThrLayoutVMNK{}));
+  config.sg_layout_k = int(cute::size<3>(ThrLayoutVMNK{}));
+
+  using PrefetchATileSize = typename CollectiveMainloop::PrefetchATileSize;
+  using PrefetchBTileSize = typename CollectiveMainloop::PrefetchBTileSize;
+  config.prefetch_a_m = int(cute::get<0>(PrefetchATileSize{}));
+  config.prefetch_a_k = int(cute::get<1>(PrefetchATileSize{}));
+  config.prefetch_b_k = int(cute::get<0>(PrefetchBTileSize{}));
+  config.prefetch_b_n = int(cute::get<1>(PrefetchBTileSize{}));
+
+  config.stages = CollectiveMainloop::DispatchPolicy::Stages;
+
+  config.bits_a = int(sizeof_bits<typename GemmKernel::ElementA>::value);
+  config.bits_b = int(sizeof_bits<typename GemmKernel::ElementB>::value);
+  config.bits_accumulator = int(sizeof_bits<typename GemmKernel::ElementAccumulator>::value);
+  config.bits_c = int(sizeof_bits<typename GemmKernel::ElementC>::value);
+  config.bits_d = int(sizeof_bits<typename GemmKernel::ElementD>::value);
+
+  return config;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace gemm
+} // namespace cutlass
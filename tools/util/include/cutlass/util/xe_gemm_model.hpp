@@ -0,0 +1,385 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 Codeplay Software Ltd. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Analytic performance model and heuristic selector for Xe GEMM configurations.
+
+    The model runs on the host only and needs neither a SYCL runtime nor a device, so candidate
+    kernels can be shortlisted on build machines. It estimates, for one problem shape:
+
+      - the number of work-groups and how many waves they take on the device,
+      - the register file mode and the number of work-groups resident per Xe-core,
+      - DRAM and L3 traffic, taking the reuse of A and B through L3 into account,
+      - whether the prefetch depth (stages) covers the memory latency,
+      - the resulting compute and memory times, of which the larger is the prediction.
+
+    The predictions are intended for ranking configurations against each other. The default device
+    parameters are nominal data sheet values and should be adjusted for the target part.
+
+    This header only depends on the standard library. xe_gemm_config.hpp describes kernel types to
+    the model.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cutlass {
+namespace gemm {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Parameters of an Xe device used by the GEMM performance model
+struct XeDeviceModel {
+  int xe_core_count = 64;                   ///< Xe-cores visible to a single queue
+  int eus_per_xe_core = 8;                  ///< vector engines per Xe-core
+  int threads_per_eu = 8;                   ///< hardware threads per EU with the default register file
+  int grf_bytes_per_thread = 128 * 64;      ///< default register file (128 x 64B registers)
+  int max_work_group_size = 1024;           ///< work-items per work-group
+  int subgroup_size = 16;                   ///< work-items per subgroup
+  int64_t l1_bytes = 512 * 1024;            ///< L1 cache per Xe-core
+  int64_t l3_bytes = int64_t(204) << 20;    ///< last level cache
+  double clock_ghz = 1.6;                   ///< sustained clock
+  double dpas_flops_per_eu_clk = 512;       ///< DPAS FLOP per EU per clock for 16-bit inputs
+  double dram_bandwidth_gbs = 1638.4;       ///< HBM bandwidth
+  double l3_bandwidth_gbs = 6553.6;         ///< L3 to Xe-core bandwidth, summed over all Xe-cores
+  double memory_latency_ns = 700;           ///< load latency the prefetch pipeline has to hide
+  double launch_overhead_us = 5;            ///< fixed cost of a kernel launch
+
+  /// One stack of an Intel Data Center GPU Max 1550
+  static XeDeviceModel pvc_1550_stack() {
+    return XeDeviceModel{};
+  }
+
+  /// Intel Data Center GPU Max 1100
+  static XeDeviceModel pvc_1100() {
+    XeDeviceModel device;
+    device.xe_core_count = 56;
+    device.l3_bytes = int64_t(108) << 20;
+    device.clock_ghz = 1.55;
+    device.dram_bandwidth_gbs = 1228.8;
+    device.l3_bandwidth_gbs = 56 * 64 * 1.55;
+    return device;
+  }
+
+  /// Peak DPAS throughput in FLOP/s for inputs of the given width
+  double peak_flops(int input_bits) const {
+    return double(xe_core_count) * eus_per_xe_core * dpas_flops_per_eu_clk *
+           (16.0 / std::max(input_bits, 8)) * clock_ghz * 1.0e9;
+  }
+};
+
+/// Tunable parameters of an Xe GEMM kernel. make_xe_gemm_config() in xe_gemm_config.hpp fills them
+/// from a kernel type.
+struct XeGemmConfig {
+  std::string name;
+
+  int tile_m = 256;                         ///< work-group tile
+  int tile_n = 256;
+  int tile_k = 32;
+  int sg_layout_m = 8;                      ///< subgroups of the TiledMma along M, N and K
+  int sg_layout_n = 4;
+  int sg_layout_k = 1;
+  int prefetch_a_m = 32;                    ///< A tile prefetched by one subgroup (rows x columns)
+  int prefetch_a_k = 32;
+  int prefetch_b_k = 32;                    ///< B tile prefetched by one subgroup (rows x columns)
+  int prefetch_b_n = 64;
+  int stages = 3;                           ///< k-tiles prefetched ahead of the MMA
+
+  int bits_a = 16;
+  int bits_b = 16;
+  int bits_accumulator = 32;
+  int bits_c = 32;
+  int bits_d = 32;
+
+  int subgroups() const {
+    return sg_layout_m * sg_layout_n * sg_layout_k;
+  }
+};
+
+/// GEMM problem evaluated by the model
+struct XeGemmProblem {
+  int64_t m = 0;
+  int64_t n = 0;
+  int64_t k = 0;
+  int64_t batch = 1;
+  bool reads_c = true;                      ///< false when beta == 0 and C is not loaded
+};
+
+/// Output of the performance model
+struct XeGemmPrediction {
+  bool valid = false;                       ///< false if the configuration cannot be launched
+  std::string reason;                       ///< why the configuration is invalid
+
+  int64_t work_groups = 0;
+  int work_groups_per_xe_core = 0;          ///< resident work-groups on one Xe-core
+  bool large_grf = false;                   ///< kernel needs the 256-register mode
+  double waves = 0;                         ///< work-groups / resident work-group slots
+  double wave_efficiency = 0;               ///< fraction of slots busy, averaged over all waves
+  double occupancy = 0;                     ///< resident subgroups / hardware threads per Xe-core
+
+  double flops = 0;                         ///< useful FLOP, 2 * m * n * k * batch
+  double dram_bytes = 0;
+  double l3_bytes = 0;                      ///< bytes moved from L3 into the Xe-cores
+  double arithmetic_intensity = 0;          ///< flops / dram_bytes
+  double latency_coverage = 0;              ///< bytes in flight / bytes needed to hide latency
+
+  double compute_time_us = 0;
+  double memory_time_us = 0;
+  double time_us = 0;
+  double tflops = 0;                        ///< flops / time_us
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+inline int64_t xe_model_ceil_div(int64_t a, int64_t b) {
+  return (a + b - 1) / b;
+}
+
+/// Fraction of the DPAS throughput of one Xe-core reached with the given number of resident
+/// subgroups. One subgroup per EU issues DPAS back to back only if nothing else stalls it; two
+/// per EU hide the latency of the operand loads.
+inline double xe_model_core_efficiency(XeDeviceModel const& device, int resident_subgroups) {
+  return std::min(1.0, double(resident_subgroups) / (2.0 * device.eus_per_xe_core));
+}
+
+} // namespace detail
+
+/// Predicts the runtime of one configuration for a problem
+inline XeGemmPrediction
+predict_xe_gemm(XeGemmProblem const& problem, XeGemmConfig const& config, XeDeviceModel const& device) {
+  using detail::xe_model_ceil_div;
+
+  XeGemmPrediction result;
+
+  if (problem.m <= 0 || problem.n <= 0 || problem.k <= 0 || problem.batch <= 0) {
+    result.reason = "empty problem";
+    return result;
+  }
+
+  if (config.tile_m <= 0 || config.tile_n <= 0 || config.tile_k <= 0 ||
+      config.sg_layout_m <= 0 || config.sg_layout_n <= 0 || config.sg_layout_k <= 0) {
+    result.reason = "empty work-group tile or subgroup layout";
+    return result;
+  }
+
+  if (config.stages <= 0) {
+    result.reason = "no k-tiles prefetched ahead of the MMA";
+    return result;
+  }
+
+  int const subgroups = config.subgroups();
+  if (subgroups * device.subgroup_size > device.max_work_group_size) {
+    result.reason = "work-group exceeds the maximum work-group size";
+    return result;
+  }
+
+  //
+  // Register file of one subgroup: accumulators plus one k-tile of A and B fragments
+  //
+
+  int64_t const sg_tile_m = xe_model_ceil_div(config.tile_m, config.sg_layout_m);
+  int64_t const sg_tile_n = xe_model_ceil_div(config.tile_n, config.sg_layout_n);
+  int64_t const sg_tile_k = xe_model_ceil_div(config.tile_k, config.sg_layout_k);
+
+  int64_t const grf_bytes_needed =
+    (sg_tile_m * sg_tile_n * config.bits_accumulator +
+     sg_tile_m * sg_tile_k * config.bits_a +
+     sg_tile_k * sg_tile_n * config.bits_b) / 8;
+
+  int threads_per_eu = device.threads_per_eu;
+  if (grf_bytes_needed > device.grf_bytes_per_thread) {
+    result.large_grf = true;
+    threads_per_eu /= 2;
+    if (grf_bytes_needed > 2 * device.grf_bytes_per_thread) {
+      result.reason = "subgroup tile does not fit in the register file";
+      return result;
+    }
+  }
+
+  int const threads_per_xe_core = device.eus_per_xe_core * threads_per_eu;
+  if (subgroups > threads_per_xe_core) {
+    result.reason = "work-group needs more hardware threads than an Xe-core provides";
+    return result;
+  }
+
+  result.work_groups_per_xe_core = threads_per_xe_core / subgroups;
+  result.occupancy = double(result.work_groups_per_xe_core * subgroups) / threads_per_xe_core;
+
+  //
+  // Work decomposition and waves
+  //
+
+  int64_t const tiles_m = xe_model_ceil_div(problem.m, config.tile_m);
+  int64_t const tiles_n = xe_model_ceil_div(problem.n, config.tile_n);
+  int64_t const k_padded = xe_model_ceil_div(problem.k, config.tile_k) * config.tile_k;
+
+  result.work_groups = tiles_m * tiles_n * problem.batch;
+
+  int64_t const slots = int64_t(device.xe_core_count) * result.work_groups_per_xe_core;
+  result.waves = double(result.work_groups) / double(slots);
+  result.wave_efficiency = result.waves / std::ceil(result.waves);
+
+  //
+  // Compute: the most loaded Xe-core runs full rounds of resident work-groups and then a partial
+  // one, each at the throughput its number of resident subgroups sustains.
+  //
+
+  result.flops = 2.0 * problem.m * problem.n * problem.k * problem.batch;
+
+  double const core_peak = device.peak_flops(std::max(config.bits_a, config.bits_b)) / device.xe_core_count;
+  double const work_group_flops = 2.0 * config.tile_m * config.tile_n * k_padded;
+
+  int64_t const per_core = xe_model_ceil_div(result.work_groups, device.xe_core_count);
+  int64_t const full_rounds = per_core / result.work_groups_per_xe_core;
+  int64_t const remainder = per_core % result.work_groups_per_xe_core;
+
+  auto round_seconds = [&](int64_t resident) {
+    double efficiency = detail::xe_model_core_efficiency(device, int(resident * subgroups));
+    return resident * work_group_flops / (core_peak * efficiency);
+  };
+
+  double compute_seconds = full_rounds * round_seconds(result.work_groups_per_xe_core);
+  if (remainder) {
+    compute_seconds += round_seconds(remainder);
+  }
+
+  //
+  // Memory: every work-group streams its rows of A and columns of B from L3. DRAM sees A and B
+  // once if they fit in L3 and increasingly often as they outgrow it. C and D go to DRAM once.
+  //
+
+  double const a_bytes = double(problem.m) * problem.k * config.bits_a / 8;
+  double const b_bytes = double(problem.n) * problem.k * config.bits_b / 8;
+  double const epilogue_bytes = double(problem.m) * problem.n *
+    ((problem.reads_c ? config.bits_c : 0) + config.bits_d) / 8;
+
+  double const streamed_bytes = (a_bytes * tiles_n + b_bytes * tiles_m) * problem.batch;
+  double const unique_bytes = (a_bytes + b_bytes) * problem.batch;
+  double const l3_hit_fraction = std::min(1.0, double(device.l3_bytes) / (a_bytes + b_bytes));
+
+  result.l3_bytes = streamed_bytes + epilogue_bytes * problem.batch;
+  result.dram_bytes = unique_bytes + (streamed_bytes - unique_bytes) * (1.0 - l3_hit_fraction) +
+                      epilogue_bytes * problem.batch;
+  result.arithmetic_intensity = result.flops / result.dram_bytes;
+
+  // Little's law on one Xe-core: the prefetched k-tiles of all resident work-groups have to cover
+  // the load latency at the Xe-core's share of the L3 bandwidth. Prefetches beyond the L1 capacity
+  // are evicted before use and do not count.
+  double const k_tile_bytes =
+    (double(config.tile_m) * config.tile_k * config.bits_a +
+     double(config.tile_k) * config.tile_n * config.bits_b) / 8;
+  double const resident = double(std::min<int64_t>(result.work_groups_per_xe_core,
+                                                   std::max<int64_t>(per_core, 1)));
+  double const in_flight = std::min(double(device.l1_bytes),
+                                    resident * config.stages * k_tile_bytes);
+  double const needed = device.memory_latency_ns * 1.0e-9 *
+                        device.l3_bandwidth_gbs * 1.0e9 / device.xe_core_count;
+  result.latency_coverage = in_flight / needed;
+
+  // Subgroups prefetching narrower than a cache line waste part of every request
+  double const line_bits = 64 * 8;
+  double const prefetch_efficiency = std::min(
+    std::min(1.0, config.prefetch_a_k * config.bits_a / line_bits),
+    std::min(1.0, config.prefetch_b_n * config.bits_b / line_bits));
+
+  double const bandwidth_efficiency =
+    std::min(1.0, result.latency_coverage) * std::max(prefetch_efficiency, 0.25);
+
+  // Only Xe-cores with work pull data; a handful of them cannot saturate DRAM either
+  double const active_cores = double(std::min<int64_t>(result.work_groups, device.xe_core_count));
+  double const l3_bandwidth = device.l3_bandwidth_gbs * 1.0e9 * active_cores / device.xe_core_count;
+  double const dram_bandwidth = std::min(device.dram_bandwidth_gbs * 1.0e9, l3_bandwidth);
+
+  double const memory_seconds = std::max(
+    result.dram_bytes / dram_bandwidth,
+    result.l3_bytes / l3_bandwidth) / bandwidth_efficiency;
+
+  result.compute_time_us = compute_seconds * 1.0e6;
+  result.memory_time_us = memory_seconds * 1.0e6;
+  result.time_us = std::max(result.compute_time_us, result.memory_time_us) + device.launch_overhead_us;
+  result.tflops = result.flops / (result.time_us * 1.0e6);
+  result.valid = true;
+
+  return result;
+}
+
+/// A candidate configuration and its prediction
+struct XeGemmRanking {
+  int index;                                ///< position of the configuration in the candidate list
+  XeGemmPrediction prediction;
+};
+
+/// Ranks candidate configurations for a problem, fastest first. Configurations which cannot be
+/// launched are omitted.
+inline std::vector<XeGemmRanking>
+rank_xe_gemm_configs(
+  XeGemmProblem const& problem,
+  std::vector<XeGemmConfig> const& candidates,
+  XeDeviceModel const& device = XeDeviceModel{}) {
+
+  std::vector<XeGemmRanking> ranking;
+  for (int i = 0; i < int(candidates.size()); ++i) {
+    XeGemmPrediction prediction = predict_xe_gemm(problem, candidates[i], device);
+    if (prediction.valid) {
+      ranking.push_back({i, prediction});
+    }
+  }
+
+  std::stable_sort(ranking.begin(), ranking.end(),
+    [](XeGemmRanking const& lhs, XeGemmRanking const& rhs) {
+      return lhs.prediction.time_us < rhs.prediction.time_us;
+    });
+
+  return ranking;
+}
+
+/// Returns the index of the predicted fastest configuration, or -1 if none can be launched
+inline int
+select_xe_gemm_config(
+  XeGemmProblem const& problem,
+  std::vector<XeGemmConfig> const& candidates,
+  XeDeviceModel const& device = XeDeviceModel{}) {
+
+  auto ranking = rank_xe_gemm_configs(problem, candidates, device);
+  return ranking.empty() ? -1 : ranking.front().index;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace gemm
+} // namespace cutlass